@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""生成一段 CPS 会话（上位机发往电台的原始字节），用于主机端解析器基准测试。
+
+  python3 scripts/cps_session_gen.py session.bin
+  src/app/opencv/build/.../uve5 --cps-bench session.bin 100
+
+会话内容：0x0514 握手，按 128 字节帧 (0x051B) 读完整个 8 KB EEPROM，
+再开一个批量会话 (0x0630) 按 4 KB 块 (0x0632) 读一遍；--writes 额外加入
+同样范围的 0x051D 写帧（主机端 EEPROM 为桩实现，写入会拉低吞吐）。
+"""
+
+import argparse
+import struct
+import sys
+
+from k5_handshake import packetize
+
+TIMESTAMP = 0xFFFFFFFF
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description="生成 CPS 会话录制文件（主机 --cps-bench 输入）")
+    ap.add_argument('out', help='输出文件')
+    ap.add_argument('--size', type=lambda s: int(s, 0), default=0x2000, help='读取范围（字节）')
+    ap.add_argument('--frame', type=int, default=128, help='0x051B/0x051D 每帧字节数（<=128）')
+    ap.add_argument('--block', type=int, default=4096, help='0x0632 每块字节数（<=4096）')
+    ap.add_argument('--writes', action='store_true', help='加入 0x051D 写帧')
+    args = ap.parse_args(argv)
+
+    frames = [struct.pack('<HHI', 0x0514, 4, TIMESTAMP)]
+    for off in range(0, args.size, args.frame):
+        frames.append(struct.pack('<HHHBBI', 0x051B, 8, off, args.frame, 0, TIMESTAMP))
+    if args.writes:
+        for off in range(0, args.size, args.frame):
+            data = bytes((off + i) & 0xFF for i in range(args.frame))
+            frames.append(struct.pack('<HHHBBI', 0x051D, 8 + len(data), off, len(data), 1, TIMESTAMP) + data)
+    frames.append(struct.pack('<HHHHI', 0x0630, 8, args.block, 0, TIMESTAMP))
+    for off in range(0, args.size, args.block):
+        frames.append(struct.pack('<HHBBHII', 0x0632, 12, 0, 0, min(args.block, args.size - off), off, TIMESTAMP))
+    frames.append(struct.pack('<HHI', 0x0636, 4, TIMESTAMP))
+
+    with open(args.out, 'wb') as f:
+        for payload in frames:
+            f.write(packetize(payload))
+    print(f"{len(frames)} frames -> {args.out}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main(sys.argv[1:]))
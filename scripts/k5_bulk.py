@@ -0,0 +1,299 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""K5 批量传输（0x0630..0x0639）：按协商的块大小整块读写逻辑 EEPROM / shared 分区。
+
+每块带 CRC-32（zlib），写入全部完成后由 0x0636 统一重载一次设置。
+固件支持时（协议版本 2）默认启用：
+  - LZ4 块压缩（字体 / 图片等可压缩数据传输量明显减少）；
+  - 跳过未改变的块：先用 0x0638 取每块 CRC-32，与本地文件比较，只传不同的块。
+    read 时若输出文件已存在，同样只重新读取变化的块。
+
+示例:
+  python3 scripts/k5_bulk.py --port /dev/ttyUSB0 read 0x0 0x2000 backup.bin
+  python3 scripts/k5_bulk.py --port /dev/ttyUSB0 write 0x0 backup.bin
+  python3 scripts/k5_bulk.py --port /dev/ttyUSB0 --shared read 0x0 0x80000 shared.bin
+"""
+
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+import k5_handshake
+from k5_handshake import read_packet, send_packet, serial
+
+TIMESTAMP = 0xFFFFFFFF
+SPACE_EEPROM = 0
+SPACE_SHARED = 1
+SPACE_LZ4 = 0x80
+FLAG_LZ4 = 1 << 0
+FLAG_HASH = 1 << 1
+MAX_HASHES = 1020
+STATUS_TEXT = {0: 'ok', 1: 'no session', 2: 'range', 3: 'crc', 4: 'io', 5: 'space', 6: 'format'}
+
+
+def lz4_encode(src: bytes) -> bytes:
+    """LZ4 block 压缩，与固件 helper/lz4.c 同一贪心算法。"""
+    n = len(src)
+    out = bytearray()
+    table: dict[bytes, int] = {}
+    anchor = i = 0
+    mflimit = n - 12
+    matchlimit = n - 5
+
+    def put(length: int, literals: bytes):
+        token_pos = len(out)
+        out.append(min(length, 15) << 4)
+        if length >= 15:
+            rest = length - 15
+            while rest >= 255:
+                out.append(255)
+                rest -= 255
+            out.append(rest)
+        out.extend(literals)
+        return token_pos
+
+    while i < mflimit:
+        key = src[i:i + 4]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > 0xFFFF:
+            i += 1
+            continue
+        while i > anchor and ref > 0 and src[i - 1] == src[ref - 1]:
+            i -= 1
+            ref -= 1
+        p = i + 4
+        while p < matchlimit and src[p] == src[p - i + ref]:
+            p += 1
+        token_pos = put(i - anchor, src[anchor:i])
+        out += struct.pack('<H', i - ref)
+        mlen = p - i - 4
+        out[token_pos] |= min(mlen, 15)
+        if mlen >= 15:
+            rest = mlen - 15
+            while rest >= 255:
+                out.append(255)
+                rest -= 255
+            out.append(rest)
+        i = anchor = p
+    put(n - anchor, src[anchor:])
+    return bytes(out)
+
+
+def lz4_decode(src: bytes, size: int) -> bytes:
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                b = src[i]
+                i += 1
+                length += b
+                if b != 255:
+                    break
+        out += src[i:i + length]
+        i += length
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        length = token & 15
+        if length == 15:
+            while True:
+                b = src[i]
+                i += 1
+                length += b
+                if b != 255:
+                    break
+        length += 4
+        if offset == 0 or offset > len(out):
+            raise ValueError('lz4: bad offset')
+        for _ in range(length):
+            out.append(out[-offset])
+    if len(out) != size:
+        raise ValueError('lz4: size mismatch')
+    return bytes(out)
+
+
+def request(ser, payload: bytes, reply_id: int, timeout_s: float, verbose: bool, retries: int = 3) -> bytes:
+    for attempt in range(retries):
+        send_packet(ser, payload, verbose=verbose)
+        try:
+            resp = read_packet(ser, expected_first_byte=reply_id & 0xFF, timeout_s=timeout_s, verbose=verbose)
+        except TimeoutError:
+            if verbose:
+                print(f"[RETRY] 0x{reply_id:04X} attempt {attempt + 1}/{retries}")
+            continue
+        if len(resp) >= 2 and struct.unpack_from('<H', resp)[0] == reply_id:
+            return resp
+    raise TimeoutError(f"no reply 0x{reply_id:04X}")
+
+
+def check(status: int, what: str) -> None:
+    if status != 0:
+        raise RuntimeError(f"{what}: {STATUS_TEXT.get(status, status)}")
+
+
+def bulk_open(ser, max_data: int, flags: int, timeout_s: float, verbose: bool):
+    request(ser, struct.pack('<HHI', 0x0514, 4, TIMESTAMP), 0x0515, timeout_s, verbose)
+    resp = request(ser, struct.pack('<HHHHI', 0x0630, 8, max_data, flags, TIMESTAMP), 0x0631, timeout_s, verbose)
+    _, _, version, status, block, eeprom_size, shared_size = struct.unpack_from('<HHBBHII', resp)
+    check(status, 'open')
+    accepted = struct.unpack_from('<H', resp, 16)[0] if version >= 2 and len(resp) >= 18 else 0
+    return version, block, eeprom_size, shared_size, accepted
+
+
+def bulk_close(ser, timeout_s: float, verbose: bool) -> bool:
+    resp = request(ser, struct.pack('<HHI', 0x0636, 4, TIMESTAMP), 0x0637, timeout_s, verbose)
+    _, _, status, reloaded = struct.unpack_from('<HHBB', resp)
+    check(status, 'close')
+    return reloaded != 0
+
+
+def bulk_read(ser, space: int, address: int, size: int, timeout_s: float, verbose: bool) -> bytes:
+    payload = struct.pack('<HHBBHII', 0x0632, 12, space, 0, size, address, TIMESTAMP)
+    for _ in range(3):
+        resp = request(ser, payload, 0x0633, timeout_s, verbose)
+        _, size, space_out, status, n, _, crc = struct.unpack_from('<HHBBHII', resp)
+        check(status, f"read 0x{address:X}")
+        data = resp[16:4 + size]
+        if space_out & SPACE_LZ4:
+            try:
+                data = lz4_decode(data, n)
+            except (ValueError, IndexError):
+                data = b''
+        if len(data) == n and zlib.crc32(data) == crc:
+            return data
+        if verbose:
+            print(f"[CRC] read 0x{address:X} mismatch, retrying")
+    raise RuntimeError(f"read 0x{address:X}: crc")
+
+
+def bulk_write(ser, space: int, address: int, data: bytes, lz4: bool, timeout_s: float, verbose: bool) -> None:
+    body = data
+    if lz4:
+        packed = lz4_encode(data)
+        if len(packed) < len(data):
+            body = packed
+            space |= SPACE_LZ4
+    payload = struct.pack('<HHBBHIII', 0x0634, 16 + len(body), space, 0, len(data), address,
+                          zlib.crc32(data), TIMESTAMP) + body
+    resp = request(ser, payload, 0x0635, timeout_s, verbose)
+    _, _, _, status, _, _ = struct.unpack_from('<HHBBHI', resp)
+    check(status, f"write 0x{address:X}")
+
+
+def bulk_hashes(ser, space: int, address: int, block: int, count: int, timeout_s: float, verbose: bool) -> list[int]:
+    hashes: list[int] = []
+    while len(hashes) < count:
+        n = min(MAX_HASHES, count - len(hashes))
+        payload = struct.pack('<HHBBHIII', 0x0638, 16, space, 0, n, address + len(hashes) * block, block, TIMESTAMP)
+        resp = request(ser, payload, 0x0639, timeout_s, verbose)
+        _, _, _, status, got, _, _ = struct.unpack_from('<HHBBHII', resp)
+        check(status, f"hash 0x{address:X}")
+        hashes += struct.unpack_from(f'<{got}I', resp, 16)
+    return hashes
+
+
+def changed_blocks(ser, space: int, address: int, local: bytes, block: int, timeout_s: float, verbose: bool) -> list[int]:
+    """返回与本地内容不同的块序号；末尾不足一块的部分总是视为已改变。"""
+    full = len(local) // block
+    remote = bulk_hashes(ser, space, address, block, full, timeout_s, verbose) if full else []
+    changed = [i for i in range(full) if zlib.crc32(local[i * block:(i + 1) * block]) != remote[i]]
+    if len(local) % block:
+        changed.append(full)
+    return changed
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description="K5 批量读写（大块 + CRC-32，单次重载设置）")
+    ap.add_argument('--port', default='/dev/cu.usbserial-1130', help='串口设备')
+    ap.add_argument('--baud', type=int, default=38400, help='波特率（k5web 默认 38400）')
+    ap.add_argument('--block', type=lambda s: int(s, 0), default=4096, help='期望的最大块大小，实际值由固件协商')
+    ap.add_argument('--shared', action='store_true', help='访问 shared 分区原始偏移，而不是逻辑 EEPROM')
+    ap.add_argument('--no-lz4', action='store_true', help='不使用 LZ4 压缩')
+    ap.add_argument('--no-skip', action='store_true', help='不比较块哈希，总是传输全部数据')
+    ap.add_argument('--timeout', type=float, default=3.0, help='每块等待回复超时（秒）')
+    ap.add_argument('--settle', type=float, default=1.0, help='打开串口后等待目标稳定的时间（秒）')
+    ap.add_argument('-v', '--verbose', action='store_true', help='打印收发的原始十六进制数据')
+    sub = ap.add_subparsers(dest='cmd', required=True)
+    rd = sub.add_parser('read', help='读取到文件')
+    rd.add_argument('address', type=lambda s: int(s, 0))
+    rd.add_argument('size', type=lambda s: int(s, 0))
+    rd.add_argument('file')
+    wr = sub.add_parser('write', help='从文件写入')
+    wr.add_argument('address', type=lambda s: int(s, 0))
+    wr.add_argument('file')
+    args = ap.parse_args(argv)
+
+    if serial is None:
+        print(f"[FAIL] pyserial 未安装或导入失败: {getattr(k5_handshake, '_import_error', None)}", file=sys.stderr)
+        return 2
+
+    space = SPACE_SHARED if args.shared else SPACE_EEPROM
+    try:
+        with serial.Serial(port=args.port, baudrate=args.baud, timeout=0.05, rtscts=False, dsrdtr=False) as ser:
+            try:
+                ser.dtr = False
+                ser.rts = False
+            except Exception:
+                pass
+            time.sleep(max(0.0, args.settle))
+            ser.reset_input_buffer()
+
+            want = (0 if args.no_lz4 else FLAG_LZ4) | (0 if args.no_skip else FLAG_HASH)
+            version, block, eeprom_size, shared_size, flags = bulk_open(ser, args.block, want, args.timeout, args.verbose)
+            print(f"[OPEN] v{version} block={block} eeprom=0x{eeprom_size:X} shared=0x{shared_size:X}"
+                  f"{' lz4' if flags & FLAG_LZ4 else ''}{' hash' if flags & FLAG_HASH else ''}")
+
+            start = time.monotonic()
+            if args.cmd == 'read':
+                out = bytearray()
+                try:
+                    with open(args.file, 'rb') as f:
+                        out = bytearray(f.read()[:args.size])
+                except OSError:
+                    pass
+                blocks = (args.size + block - 1) // block
+                if flags & FLAG_HASH and out:
+                    todo = changed_blocks(ser, space, args.address, bytes(out), block, args.timeout, args.verbose)
+                    todo += range((len(out) + block - 1) // block, blocks)
+                else:
+                    todo = list(range(blocks))
+                out = out.ljust(args.size, b'\xff')
+                for i in todo:
+                    off = i * block
+                    n = min(block, args.size - off)
+                    out[off:off + n] = bulk_read(ser, space, args.address + off, n, args.timeout, args.verbose)
+                with open(args.file, 'wb') as f:
+                    f.write(out)
+                total = sum(min(block, args.size - i * block) for i in todo)
+            else:
+                with open(args.file, 'rb') as f:
+                    data = f.read()
+                if flags & FLAG_HASH:
+                    todo = changed_blocks(ser, space, args.address, data, block, args.timeout, args.verbose)
+                else:
+                    todo = list(range((len(data) + block - 1) // block))
+                for i in todo:
+                    bulk_write(ser, space, args.address + i * block, data[i * block:(i + 1) * block],
+                               bool(flags & FLAG_LZ4), args.timeout, args.verbose)
+                total = sum(len(data[i * block:(i + 1) * block]) for i in todo)
+            elapsed = time.monotonic() - start
+
+            reloaded = bulk_close(ser, args.timeout, args.verbose)
+            print(f"[OK] {args.cmd} {total} bytes transferred in {elapsed:.2f}s ({total / max(elapsed, 1e-6):.0f} B/s)"
+                  f"{' settings reloaded' if reloaded else ''}")
+            return 0
+    except Exception as e:
+        print(f"[FAIL] {e}", file=sys.stderr)
+        return 2
+
+
+if __name__ == '__main__':
+    raise SystemExit(main(sys.argv[1:]))
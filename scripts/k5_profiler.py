@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""K5 分区段性能计数（0x0650，需 ENABLE_PROFILER）：按累计耗时列出最忙的区段。
+
+每个区段记录调用次数、累计耗时和单次最坏耗时（微秒），含嵌套区段；
+占比 = 累计耗时 / 自上次清零以来的时间，两个核上的区段加起来可以超过 100%。
+
+示例:
+  python3 scripts/k5_profiler.py --port /dev/ttyUSB0
+  python3 scripts/k5_profiler.py --port /dev/ttyUSB0 --clear --watch 5    # 每 5 秒一份，每次清零
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+import k5_handshake
+from k5_handshake import read_packet, send_packet, serial
+
+TIMESTAMP = 0xFFFFFFFF
+# 与 helper/profiler.h 的 PROFILER_Zone_t 顺序一致
+ZONES = ('APP_Update', 'RadioSlice', 'UiSlice', 'Display', 'LcdBlit', 'LcdLine', 'PrintSmall',
+         'BK4819Rd', 'BK4819Wr', 'EepromRd', 'EepromWr', 'UartCmd', 'SpecRssi', 'avr_run')
+
+
+def query(ser, count: int, clear: bool, timeout_s: float, verbose: bool):
+    send_packet(ser, struct.pack('<HHBBHI', 0x0650, 8, count, 1 if clear else 0, 0, TIMESTAMP), verbose=verbose)
+    resp = read_packet(ser, expected_first_byte=0x51, timeout_s=timeout_s, verbose=verbose)
+    elapsed_ms, zone_count, n = struct.unpack_from('<IBB', resp, 4)
+    entries = [struct.unpack_from('<BxxxIII', resp, 12 + i * 16) for i in range(n)]
+    return elapsed_ms, zone_count, entries
+
+
+def show(elapsed_ms: int, zone_count: int, entries) -> None:
+    print(f"[PROF] {elapsed_ms / 1000:.1f}s, {len(entries)}/{zone_count} zones")
+    print(f"  {'zone':<12}{'calls':>10}{'total ms':>11}{'share':>8}{'avg us':>9}{'max us':>9}")
+    for zone, calls, total_us, max_us in entries:
+        name = ZONES[zone] if zone < len(ZONES) else f"#{zone}"
+        share = total_us / 10 / elapsed_ms if elapsed_ms else 0.0
+        print(f"  {name:<12}{calls:>10}{total_us / 1000:>11.1f}{share:>7.1f}%"
+              f"{total_us // max(calls, 1):>9}{max_us:>9}")
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description="K5 分区段性能计数")
+    ap.add_argument('--port', default='/dev/cu.usbserial-1130', help='串口设备')
+    ap.add_argument('--baud', type=int, default=38400, help='波特率（k5web 默认 38400）')
+    ap.add_argument('--count', type=int, default=len(ZONES), help='最多列出多少个区段')
+    ap.add_argument('--clear', action='store_true', help='读完后清零计数')
+    ap.add_argument('--watch', type=float, default=0.0, help='每隔多少秒再读一次，0 = 只读一次')
+    ap.add_argument('--timeout', type=float, default=3.0, help='等待回复超时（秒）')
+    ap.add_argument('--settle', type=float, default=1.0, help='打开串口后等待目标稳定的时间（秒）')
+    ap.add_argument('-v', '--verbose', action='store_true', help='打印收发的原始十六进制数据')
+    args = ap.parse_args(argv)
+
+    if serial is None:
+        print(f"[FAIL] pyserial 未安装或导入失败: {getattr(k5_handshake, '_import_error', None)}", file=sys.stderr)
+        return 2
+
+    try:
+        with serial.Serial(port=args.port, baudrate=args.baud, timeout=0.05, rtscts=False, dsrdtr=False) as ser:
+            try:
+                ser.dtr = False
+                ser.rts = False
+            except Exception:
+                pass
+            time.sleep(max(0.0, args.settle))
+            ser.reset_input_buffer()
+
+            send_packet(ser, struct.pack('<HHI', 0x0514, 4, TIMESTAMP), verbose=args.verbose)
+            read_packet(ser, expected_first_byte=0x15, timeout_s=args.timeout, verbose=args.verbose)
+
+            try:
+                while True:
+                    show(*query(ser, args.count, args.clear, args.timeout, args.verbose))
+                    if args.watch <= 0:
+                        break
+                    time.sleep(args.watch)
+            except KeyboardInterrupt:
+                pass
+            return 0
+    except Exception as e:
+        print(f"[FAIL] {e}", file=sys.stderr)
+        return 2
+
+
+if __name__ == '__main__':
+    raise SystemExit(main(sys.argv[1:]))
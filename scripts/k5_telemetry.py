@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""K5 二进制遥测流（0x0640 开启）：实时 RSSI / 静噪 / 亚音 / AF 电平、频谱扫描行、主循环耗时。
+
+遥测帧与 CPS 回复共用串口，但使用独立的同步字且不做异或：
+  5A A5 | 类型 | 序号 | 长度(LE16) | 负载 | CRC16-XMODEM(LE16，覆盖 类型..负载)
+扫描行首值为 LE16，其余为相对左邻的 int8 差值，0x80 后跟 LE16 绝对值。
+
+示例:
+  python3 scripts/k5_telemetry.py --port /dev/ttyUSB0
+  python3 scripts/k5_telemetry.py --port /dev/ttyUSB0 --mask sweep --interval 50 --csv sweep.csv
+  python3 scripts/k5_telemetry.py --decode capture.bin        # 离线解析抓包
+"""
+
+import argparse
+import struct
+import sys
+import time
+from typing import Optional
+
+import k5_handshake
+from k5_handshake import crc16_xmodem, read_packet, send_packet, serial
+
+TIMESTAMP = 0xFFFFFFFF
+SYNC = b"\x5A\xA5"
+TYPE_STATUS = 1
+TYPE_SWEEP = 2
+TYPE_TIMING = 3
+MASKS = {'status': 1, 'sweep': 2, 'timing': 4}
+FLAG_TEXT = ((1, 'SQL'), (2, 'CTCSS'), (4, 'DCS'), (8, 'SPECTRUM'))
+
+
+def decode_sweep(payload: bytes):
+    t, fstart, step, sweep_us, count, _ = struct.unpack_from('<IIIIHH', payload)
+    i = 20
+    values = [struct.unpack_from('<H', payload, i)[0]]
+    i += 2
+    while len(values) < count:
+        b = payload[i]
+        if b == 0x80:
+            values.append(struct.unpack_from('<H', payload, i + 1)[0])
+            i += 3
+        else:
+            values.append((values[-1] + (b - 256 if b > 127 else b)) & 0xFFFF)
+            i += 1
+    return t, fstart, step, sweep_us, values
+
+
+def parse_frames(buf: bytearray):
+    """从 buf 中取出完整的遥测帧 (type, seq, payload)，其余字节（CPS 回复、文本日志）丢弃。"""
+    while True:
+        idx = buf.find(SYNC)
+        if idx < 0:
+            del buf[:max(0, len(buf) - 1)]
+            return
+        del buf[:idx]
+        if len(buf) < 6:
+            return
+        length = buf[4] | (buf[5] << 8)
+        if length > 1024:
+            del buf[:1]
+            continue
+        if len(buf) < 8 + length:
+            return
+        crc = buf[6 + length] | (buf[7 + length] << 8)
+        if crc16_xmodem(bytes(buf[2:6 + length])) != crc:
+            del buf[:1]
+            continue
+        frame = bytes(buf[:8 + length])
+        del buf[:8 + length]
+        yield frame[2], frame[3], frame[6:6 + length]
+
+
+class Printer:
+    def __init__(self, csv_path: Optional[str]):
+        self.csv = open(csv_path, 'w') if csv_path else None
+        self.last_seq = None
+        self.lost = 0
+
+    def close(self) -> None:
+        if self.csv:
+            self.csv.close()
+
+    def frame(self, ftype: int, seq: int, payload: bytes) -> None:
+        if self.last_seq is not None:
+            self.lost += (seq - self.last_seq - 1) & 0xFF
+        self.last_seq = seq
+
+        if ftype == TYPE_STATUS:
+            t, freq, rssi, noise, glitch, af, flags, func, code_type, code, dropped = \
+                struct.unpack_from('<IIHBBHBBBBH', payload)
+            dbm = rssi / 2 - 160
+            text = ' '.join(name for bit, name in FLAG_TEXT if flags & bit)
+            print(f"{t:10d} STATUS f={freq * 10 / 1e6:.5f}MHz rssi={rssi}({dbm:.1f}dBm) noise={noise} "
+                  f"glitch={glitch} af={af} fn={func} tone={code_type}/{code} {text} dropped={dropped}")
+            if self.csv:
+                self.csv.write(f"status,{t},{freq},{rssi},{noise},{glitch},{af},{flags},{func},{code_type},{code}\n")
+        elif ftype == TYPE_SWEEP:
+            t, fstart, step, sweep_us, values = decode_sweep(payload)
+            peak = max(range(len(values)), key=lambda i: values[i] if values[i] != 0xFFFF else 0)
+            print(f"{t:10d} SWEEP  f={fstart * 10 / 1e6:.5f}MHz step={step * 10}Hz n={len(values)} "
+                  f"sweep={sweep_us / 1000:.1f}ms peak={(fstart + peak * step) * 10 / 1e6:.5f}MHz/{values[peak]} "
+                  f"({len(payload)} B)")
+            if self.csv:
+                self.csv.write(f"sweep,{t},{fstart},{step}," + ','.join(map(str, values)) + "\n")
+        elif ftype == TYPE_TIMING:
+            t, passes, avg_us, max_us = struct.unpack_from('<IIHH', payload)
+            # idle share and tick jitter were added later; older firmware sends 12 bytes
+            idle, jitter = struct.unpack_from('<HH', payload, 12) if len(payload) >= 16 else (None, None)
+            extra = f" idle={idle / 10:.1f}% jitter={jitter}us" if idle is not None else ""
+            print(f"{t:10d} TIMING passes={passes} avg={avg_us}us max={max_us}us{extra}")
+            if self.csv:
+                self.csv.write(f"timing,{t},{passes},{avg_us},{max_us},"
+                               f"{'' if idle is None else idle},{'' if jitter is None else jitter}\n")
+
+
+def configure(ser, mask: int, interval: int, timeout_s: float, verbose: bool):
+    send_packet(ser, struct.pack('<HHI', 0x0514, 4, TIMESTAMP), verbose=verbose)
+    read_packet(ser, expected_first_byte=0x15, timeout_s=timeout_s, verbose=verbose)
+    send_packet(ser, struct.pack('<HHBBHI', 0x0640, 8, mask, 0, interval, TIMESTAMP), verbose=verbose)
+    resp = read_packet(ser, expected_first_byte=0x41, timeout_s=timeout_s, verbose=verbose)
+    return struct.unpack_from('<HHBBHH', resp)[2:]
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description="K5 二进制遥测流接收")
+    ap.add_argument('--port', default='/dev/cu.usbserial-1130', help='串口设备')
+    ap.add_argument('--baud', type=int, default=38400, help='波特率（k5web 默认 38400）')
+    ap.add_argument('--mask', default='status,sweep,timing', help='逗号分隔: status,sweep,timing')
+    ap.add_argument('--interval', type=int, default=100, help='状态/耗时帧周期及扫描行最小间隔（毫秒，>=20）')
+    ap.add_argument('--seconds', type=float, default=0.0, help='接收时长，0 = 直到 Ctrl+C')
+    ap.add_argument('--csv', help='同时写入 CSV')
+    ap.add_argument('--raw', help='同时保存原始字节（可用 --decode 回放）')
+    ap.add_argument('--decode', help='离线解析原始抓包文件，不打开串口')
+    ap.add_argument('--timeout', type=float, default=3.0, help='等待回复超时（秒）')
+    ap.add_argument('--settle', type=float, default=1.0, help='打开串口后等待目标稳定的时间（秒）')
+    ap.add_argument('-v', '--verbose', action='store_true', help='打印收发的原始十六进制数据')
+    args = ap.parse_args(argv)
+
+    out = Printer(args.csv)
+    try:
+        if args.decode:
+            with open(args.decode, 'rb') as f:
+                buf = bytearray(f.read())
+            for frame in parse_frames(buf):
+                out.frame(*frame)
+            print(f"[OK] lost frames: {out.lost}")
+            return 0
+
+        if serial is None:
+            print(f"[FAIL] pyserial 未安装或导入失败: {getattr(k5_handshake, '_import_error', None)}", file=sys.stderr)
+            return 2
+
+        mask = 0
+        for name in filter(None, args.mask.split(',')):
+            mask |= MASKS[name.strip()]
+
+        raw = open(args.raw, 'wb') if args.raw else None
+        with serial.Serial(port=args.port, baudrate=args.baud, timeout=0.05, rtscts=False, dsrdtr=False) as ser:
+            try:
+                ser.dtr = False
+                ser.rts = False
+            except Exception:
+                pass
+            time.sleep(max(0.0, args.settle))
+            ser.reset_input_buffer()
+
+            version, mask, interval, _ = configure(ser, mask, args.interval, args.timeout, args.verbose)
+            print(f"[START] v{version} mask=0x{mask:02X} interval={interval}ms")
+
+            buf = bytearray()
+            total = 0
+            start = time.monotonic()
+            try:
+                while args.seconds <= 0 or time.monotonic() - start < args.seconds:
+                    chunk = ser.read(ser.in_waiting or 1)
+                    if not chunk:
+                        continue
+                    total += len(chunk)
+                    if raw:
+                        raw.write(chunk)
+                    buf.extend(chunk)
+                    for frame in parse_frames(buf):
+                        out.frame(*frame)
+            except KeyboardInterrupt:
+                pass
+            finally:
+                send_packet(ser, struct.pack('<HHBBHI', 0x0640, 8, 0, 0, 0, TIMESTAMP), verbose=args.verbose)
+                if raw:
+                    raw.close()
+
+            elapsed = time.monotonic() - start
+            print(f"[STOP] {total} bytes in {elapsed:.1f}s ({total / max(elapsed, 1e-6):.0f} B/s), lost frames: {out.lost}")
+            return 0
+    except Exception as e:
+        print(f"[FAIL] {e}", file=sys.stderr)
+        return 2
+    finally:
+        out.close()
+
+
+if __name__ == '__main__':
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""K5 事件时间线（0x0660 / 0x0662，需 ENABLE_TRACE）：寄存器写、扫描跳频、静噪、按键、刷屏、擦 flash。
+
+0x0660 设置事件掩码（可顺带清空、测一次未开启埋点的开销），0x0662 从最旧的开始取走条目。
+每条 12 字节 <IBBHI>：微秒时间戳、事件、核号、Arg0、Arg1；--raw 保存的就是这些条目首尾相接，
+可用 --decode 离线回放。
+
+示例:
+  python3 scripts/k5_trace.py --port /dev/ttyUSB0 --bench
+  python3 scripts/k5_trace.py --port /dev/ttyUSB0 --events hop,squelch --seconds 30 --raw scan.bin
+  python3 scripts/k5_trace.py --decode scan.bin --timeline
+"""
+
+import argparse
+import struct
+import sys
+import time
+from typing import List, Optional, Tuple
+
+import k5_handshake
+from k5_handshake import read_packet, send_packet, serial
+
+TIMESTAMP = 0xFFFFFFFF
+ENTRY = struct.Struct('<IBBHI')
+# 与 helper/trace.h 的 TRACE_Event_t 顺序一致
+EVENTS = ('reg', 'hop', 'squelch', 'key', 'present', 'erase')
+HOPS = ('freq', 'chan', 'spectrum')
+PRESENTS = ('full', 'line', 'status')
+FLAG_CLEAR = 1
+FLAG_BENCH = 2
+
+Entry = Tuple[int, int, int, int, int]   # (time_us, event, core, arg0, arg1)
+
+
+def unwrap(entries: List[Entry]) -> List[Entry]:
+    """32 位微秒时间戳约 71 分钟回绕一次，展开成单调递增。"""
+    out, base, last = [], 0, None
+    for t, ev, core, a0, a1 in entries:
+        if last is not None and t < last and last - t > 0x80000000:
+            base += 1 << 32
+        last = t
+        out.append((t + base, ev, core, a0, a1))
+    return out
+
+
+def describe(ev: int, a0: int, a1: int) -> str:
+    name = EVENTS[ev] if ev < len(EVENTS) else f"#{ev}"
+    if name == 'reg':
+        return f"reg    0x{a0:02X} = 0x{a1:04X}"
+    if name == 'hop':
+        kind = HOPS[a0] if a0 < len(HOPS) else a0
+        return f"hop    {kind} {a1 + 1 if kind == 'chan' else f'{a1 * 10 / 1e6:.5f}MHz'}"
+    if name == 'squelch':
+        return f"sql    {'open' if a0 else 'close'} {a1 * 10 / 1e6:.5f}MHz"
+    if name == 'key':
+        return f"key    {a0} {'down' if a1 & 1 else 'up'}{' held' if a1 & 2 else ''}"
+    if name == 'present':
+        kind = PRESENTS[a0] if a0 < len(PRESENTS) else a0
+        return f"lcd    {kind}{f' {a1}' if kind == 'line' else ''}"
+    if name == 'erase':
+        return f"erase  0x{a1:06X}"
+    return f"{name} {a0} {a1}"
+
+
+def stats(label: str, values: List[float]) -> None:
+    if not values:
+        return
+    values = sorted(values)
+    p95 = values[min(len(values) - 1, int(len(values) * 0.95))]
+    print(f"  {label:<26} n={len(values):<6} min={values[0]:8.2f} avg={sum(values) / len(values):8.2f} "
+          f"p95={p95:8.2f} max={values[-1]:8.2f} ms")
+
+
+def analyse(entries: List[Entry], stall_ms: float, timeline: bool) -> None:
+    entries = unwrap(entries)
+    if not entries:
+        print("[TRACE] no entries")
+        return
+
+    t0 = entries[0][0]
+    if timeline:
+        prev = t0
+        for t, ev, core, a0, a1 in entries:
+            print(f"{(t - t0) / 1000:10.3f} +{(t - prev) / 1000:8.3f} c{core} {describe(ev, a0, a1)}")
+            prev = t
+
+    counts = [0] * len(EVENTS)
+    hops: List[float] = []
+    hop_to_open: List[float] = []
+    key_to_lcd: List[float] = []
+    lcd_gaps: List[float] = []
+    last_hop: Optional[int] = None
+    last_key: Optional[int] = None
+    last_lcd: Optional[int] = None
+    stalls = []
+
+    for t, ev, core, a0, a1 in entries:
+        if ev < len(counts):
+            counts[ev] += 1
+        name = EVENTS[ev] if ev < len(EVENTS) else None
+        if name == 'hop':
+            if last_hop is not None:
+                hops.append((t - last_hop) / 1000)
+            last_hop = t
+        elif name == 'squelch' and a0 and last_hop is not None:
+            hop_to_open.append((t - last_hop) / 1000)
+        elif name == 'key' and a1 & 1:
+            last_key = t
+        elif name == 'present' and a0 == 0:
+            if last_key is not None:
+                key_to_lcd.append((t - last_key) / 1000)
+                last_key = None
+            if last_lcd is not None:
+                gap = (t - last_lcd) / 1000
+                lcd_gaps.append(gap)
+                if gap >= stall_ms:
+                    stalls.append(((last_lcd - t0) / 1000, gap))
+            last_lcd = t
+
+    span = (entries[-1][0] - t0) / 1000
+    print(f"[TRACE] {len(entries)} entries over {span:.1f} ms: " +
+          ', '.join(f"{EVENTS[i]}={counts[i]}" for i in range(len(EVENTS)) if counts[i]))
+    stats('scan hop interval', hops)
+    stats('hop -> squelch open', hop_to_open)
+    stats('key down -> full present', key_to_lcd)
+    stats('full present interval', lcd_gaps)
+    for start, gap in stalls[:20]:
+        print(f"  stall at {start:10.3f} ms: no full present for {gap:.1f} ms")
+    if len(stalls) > 20:
+        print(f"  ... {len(stalls) - 20} more stalls >= {stall_ms} ms")
+
+
+def configure(ser, mask: int, flags: int, timeout_s: float, verbose: bool):
+    send_packet(ser, struct.pack('<HHIBBBBI', 0x0660, 12, mask, flags, 0, 0, 0, TIMESTAMP), verbose=verbose)
+    resp = read_packet(ser, expected_first_byte=0x61, timeout_s=timeout_s, verbose=verbose)
+    version, entry_size, length, mask, pending, _, dropped = struct.unpack_from('<BBHIHHI', resp, 4)
+    bench = struct.unpack_from('<IIII', resp, 20)
+    return version, entry_size, length, mask, pending, dropped, bench
+
+
+def drain(ser, timeout_s: float, verbose: bool):
+    send_packet(ser, struct.pack('<HHBBBBI', 0x0662, 8, 64, 0, 0, 0, TIMESTAMP), verbose=verbose)
+    resp = read_packet(ser, expected_first_byte=0x63, timeout_s=timeout_s, verbose=verbose)
+    _, dropped, pending, count = struct.unpack_from('<IIHB', resp, 4)
+    raw = resp[16:16 + count * ENTRY.size]
+    return raw, pending, dropped
+
+
+def parse(raw: bytes) -> List[Entry]:
+    return [ENTRY.unpack_from(raw, i) for i in range(0, len(raw) - ENTRY.size + 1, ENTRY.size)]
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description="K5 事件时间线")
+    ap.add_argument('--port', default='/dev/cu.usbserial-1130', help='串口设备')
+    ap.add_argument('--baud', type=int, default=38400, help='波特率（k5web 默认 38400）')
+    ap.add_argument('--events', default=','.join(EVENTS), help='逗号分隔: ' + ','.join(EVENTS))
+    ap.add_argument('--seconds', type=float, default=10.0, help='记录时长，0 = 直到 Ctrl+C')
+    ap.add_argument('--poll', type=float, default=0.05, help='取条目的间隔（秒）')
+    ap.add_argument('--bench', action='store_true', help='只测一次未开启埋点的开销')
+    ap.add_argument('--raw', help='同时保存原始条目（可用 --decode 回放）')
+    ap.add_argument('--decode', help='离线解析原始条目文件，不打开串口')
+    ap.add_argument('--timeline', action='store_true', help='逐条打印时间线')
+    ap.add_argument('--stall', type=float, default=200.0, help='整屏刷新间隔超过多少毫秒算卡顿')
+    ap.add_argument('--timeout', type=float, default=3.0, help='等待回复超时（秒）')
+    ap.add_argument('--settle', type=float, default=1.0, help='打开串口后等待目标稳定的时间（秒）')
+    ap.add_argument('-v', '--verbose', action='store_true', help='打印收发的原始十六进制数据')
+    args = ap.parse_args(argv)
+
+    try:
+        if args.decode:
+            with open(args.decode, 'rb') as f:
+                analyse(parse(f.read()), args.stall, args.timeline)
+            return 0
+
+        if serial is None:
+            print(f"[FAIL] pyserial 未安装或导入失败: {getattr(k5_handshake, '_import_error', None)}", file=sys.stderr)
+            return 2
+
+        mask = 0
+        for name in filter(None, args.events.split(',')):
+            mask |= 1 << EVENTS.index(name.strip())
+
+        with serial.Serial(port=args.port, baudrate=args.baud, timeout=0.05, rtscts=False, dsrdtr=False) as ser:
+            try:
+                ser.dtr = False
+                ser.rts = False
+            except Exception:
+                pass
+            time.sleep(max(0.0, args.settle))
+            ser.reset_input_buffer()
+
+            send_packet(ser, struct.pack('<HHI', 0x0514, 4, TIMESTAMP), verbose=args.verbose)
+            read_packet(ser, expected_first_byte=0x15, timeout_s=args.timeout, verbose=args.verbose)
+
+            if args.bench:
+                *_, (rounds, loop, disabled, mhz) = configure(ser, 0, FLAG_BENCH, args.timeout, args.verbose)
+                per_call = (disabled - loop) / max(rounds, 1)
+                print(f"[BENCH] disabled TRACE(): {per_call:.2f} cycles/call "
+                      f"({per_call / max(mhz, 1) * 1000:.1f} ns at {mhz} MHz, {rounds} rounds)")
+                return 0
+
+            version, entry_size, length, mask, _, _, _ = configure(ser, mask, FLAG_CLEAR, args.timeout, args.verbose)
+            if entry_size != ENTRY.size:
+                raise RuntimeError(f"unexpected entry size {entry_size}")
+            print(f"[START] v{version} mask=0x{mask:02X} ring={length}")
+
+            data = bytearray()
+            dropped = 0
+            start = time.monotonic()
+            try:
+                while args.seconds <= 0 or time.monotonic() - start < args.seconds:
+                    raw, pending, dropped = drain(ser, args.timeout, args.verbose)
+                    data.extend(raw)
+                    if pending == 0:
+                        time.sleep(args.poll)
+            except KeyboardInterrupt:
+                pass
+            finally:
+                configure(ser, 0, 0, args.timeout, args.verbose)
+            while True:
+                raw, pending, dropped = drain(ser, args.timeout, args.verbose)
+                data.extend(raw)
+                if pending == 0:
+                    break
+
+            if args.raw:
+                with open(args.raw, 'wb') as f:
+                    f.write(data)
+            print(f"[STOP] {len(data) // ENTRY.size} entries, dropped {dropped}")
+            analyse(parse(bytes(data)), args.stall, args.timeline)
+            return 0
+    except Exception as e:
+        print(f"[FAIL] {e}", file=sys.stderr)
+        return 2
+
+
+if __name__ == '__main__':
+    raise SystemExit(main(sys.argv[1:]))
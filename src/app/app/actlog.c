@@ -0,0 +1,440 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifdef ENABLE_ACTIVITY_LOG
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#else
+#include "../opencv/Arduino.hpp"
+#endif
+#include <stdio.h>
+#include <string.h>
+
+#include "app/actlog.h"
+#include "app/chFrScanner.h"
+#include "app/radiotask.h"
+#include "app/scanner.h"
+#include "../bsp/dp32g030/rtc.h"
+#include "../dcs.h"
+#include "../driver/keyboard.h"
+#include "../driver/st7565.h"
+#include "../functions.h"
+#include "../helper/keys.h"
+#include "../misc.h"
+#include "../radio.h"
+#include "../shared_flash_c.h"
+#include "../ui/helper.h"
+
+#define ACTLOG_MAGIC               0x474F4C41U   // "ALOG"
+#define ACTLOG_VERSION             2U            // v2: append-only sectors, no entry count in the header
+#define ACTLOG_IDLE_FLUSH_500ms    120U          // flush a partial batch after 60s
+#define ACTLOG_ROWS_PER_PAGE       3U
+// One sector is always the erased one ahead of the current sector.
+#define ACTLOG_MAX_OLDER_SECTORS   (ACTLOG_FLASH_SECTORS - 2U)
+
+static ACTLOG_Entry_t gActLogRing[ACTLOG_RAM_ENTRIES];
+static uint16_t       gActLogRingHead;      // next write slot
+static uint16_t       gActLogRingCount;     // entries not yet copied into the sector image
+static uint32_t       gActLogDropped;
+
+// RAM image of the sector currently being filled; slot 0 is the header.
+static ACTLOG_Entry_t gActLogSector[ACTLOG_SLOTS_PER_SECTOR];
+static uint8_t        gActLogSectorIndex;
+static uint32_t       gActLogSequence;
+static uint16_t       gActLogSectorCount;
+static uint16_t       gActLogSectorWritten; // entries of the image already programmed
+static bool           gActLogHeaderWritten;
+static bool           gActLogNextErased;    // the sector after the current one is ready
+static uint8_t        gActLogOlderSectors;  // full sectors behind the current one
+static uint16_t       gActLogIdle_500ms;
+
+static bool           gActLogOpen;
+static ACTLOG_Entry_t gActLogOpenEntry;
+static uint32_t       gActLogOpenStartMs;
+
+static inline uint32_t SectorAddress(uint8_t Sector)
+{
+    return ACTLOG_FLASH_BASE + (uint32_t)Sector * ACTLOG_SECTOR_SIZE;
+}
+
+static void ResetSectorImage(void)
+{
+    ACTLOG_SectorHeader_t *pHeader = (ACTLOG_SectorHeader_t *)&gActLogSector[0];
+
+    memset(gActLogSector, 0xFF, sizeof(gActLogSector));
+    memset(pHeader, 0, sizeof(*pHeader));
+    pHeader->Magic    = ACTLOG_MAGIC;
+    pHeader->Sequence = gActLogSequence;
+    pHeader->Version  = ACTLOG_VERSION;
+    gActLogSectorCount   = 0;
+    gActLogSectorWritten = 0;
+    gActLogHeaderWritten = false;
+}
+
+static inline uint8_t NextSector(void)
+{
+    return (uint8_t)((gActLogSectorIndex + 1U) % ACTLOG_FLASH_SECTORS);
+}
+
+static void AdvanceSector(void)
+{
+    gActLogSectorIndex = NextSector();
+    gActLogSequence++;
+    if (gActLogOlderSectors < ACTLOG_MAX_OLDER_SECTORS)
+        gActLogOlderSectors++;
+    ResetSectorImage();
+
+    // Normally erased ahead of time from the 500ms slice; a burst that fills
+    // a whole sector before that happens pays for the erase here.
+    if (!gActLogNextErased)
+        (void)shared_erase_c(SectorAddress(gActLogSectorIndex), ACTLOG_SECTOR_SIZE);
+    gActLogNextErased = false;
+}
+
+// Program the image's new slots (and the header with the first batch).
+static void ProgramPending(void)
+{
+    const uint32_t first = gActLogHeaderWritten ? 1U + gActLogSectorWritten : 0U;
+    const uint32_t end   = 1U + gActLogSectorCount;
+
+    if (end > first)
+        (void)shared_program_c(SectorAddress(gActLogSectorIndex) + first * sizeof(ACTLOG_Entry_t),
+                               &gActLogSector[first], (end - first) * sizeof(ACTLOG_Entry_t));
+    gActLogHeaderWritten = true;
+    gActLogSectorWritten = gActLogSectorCount;
+}
+
+static bool ReadHeader(uint8_t Sector, ACTLOG_SectorHeader_t *pHeader)
+{
+    if (!shared_read_c(SectorAddress(Sector), pHeader, sizeof(*pHeader)))
+        return false;
+    return pHeader->Magic == ACTLOG_MAGIC && pHeader->Version == ACTLOG_VERSION && pHeader->Sequence != 0xFFFFFFFFU;
+}
+
+void ACTLOG_Init(void)
+{
+    ACTLOG_SectorHeader_t header;
+    uint32_t              newestSeq = 0;
+    int                   newest = -1;
+
+    gActLogRingHead   = 0;
+    gActLogRingCount  = 0;
+    gActLogOpen       = false;
+    gActLogNextErased = false;
+    RTC_Anchor();
+
+    for (uint8_t i = 0; i < ACTLOG_FLASH_SECTORS; i++) {
+        if (ReadHeader(i, &header) && (newest < 0 || header.Sequence > newestSeq)) {
+            newest    = i;
+            newestSeq = header.Sequence;
+        }
+    }
+
+    gActLogOlderSectors = 0;
+
+    if (newest < 0) {
+        // No log yet (or an older format): start over in a freshly erased sector 0.
+        gActLogSectorIndex = 0;
+        gActLogSequence    = 1;
+        ResetSectorImage();
+        (void)shared_erase_c(SectorAddress(0), ACTLOG_SECTOR_SIZE);
+        return;
+    }
+
+    gActLogSectorIndex = (uint8_t)newest;
+    gActLogSequence    = newestSeq;
+
+    if (!shared_read_c(SectorAddress(gActLogSectorIndex), gActLogSector, sizeof(gActLogSector))) {
+        // Unreadable: its entries are lost anyway, start it over.
+        ResetSectorImage();
+        (void)shared_erase_c(SectorAddress(gActLogSectorIndex), ACTLOG_SECTOR_SIZE);
+        return;
+    }
+
+    gActLogHeaderWritten = true;
+    gActLogSectorCount   = 0;
+    while (gActLogSectorCount < ACTLOG_ENTRIES_PER_SECTOR && gActLogSector[1U + gActLogSectorCount].Time != 0xFFFFFFFFU)
+        gActLogSectorCount++;
+    gActLogSectorWritten = gActLogSectorCount;
+
+    // Walk back through the older sectors while their sequence numbers are contiguous.
+    for (uint8_t k = 1; k <= ACTLOG_MAX_OLDER_SECTORS; k++) {
+        const uint8_t sector = (uint8_t)((gActLogSectorIndex + ACTLOG_FLASH_SECTORS - k) % ACTLOG_FLASH_SECTORS);
+        if (!ReadHeader(sector, &header) || header.Sequence != newestSeq - k)
+            break;
+        gActLogOlderSectors++;
+    }
+
+    if (gActLogSectorCount >= ACTLOG_ENTRIES_PER_SECTOR)
+        AdvanceSector();
+}
+
+static void PushEntry(const ACTLOG_Entry_t *pEntry)
+{
+    if (gActLogRingCount >= ACTLOG_RAM_ENTRIES) {
+        // Queue full (a burst faster than the 500ms flush): overwrite the oldest, count it.
+        gActLogRingCount--;
+        gActLogDropped++;
+    }
+
+    gActLogRing[gActLogRingHead] = *pEntry;
+    gActLogRingHead = (uint16_t)((gActLogRingHead + 1U) % ACTLOG_RAM_ENTRIES);
+    gActLogRingCount++;
+}
+
+void ACTLOG_Begin(uint8_t Source, uint32_t Frequency, uint16_t Rssi)
+{
+    if (gActLogOpen && gActLogOpenEntry.Frequency == Frequency) {
+        // Same signal reported again (spectrum re-measure, or the scanner
+        // stopping on a frequency whose squelch already opened): merge.
+        if (Rssi > gActLogOpenEntry.Rssi)
+            gActLogOpenEntry.Rssi = Rssi;
+        if (Source != ACTLOG_SOURCE_SQUELCH)
+            gActLogOpenEntry.Source = Source;
+        return;
+    }
+
+    ACTLOG_End();
+
+    gActLogOpenStartMs         = millis();
+    gActLogOpenEntry.Time      = RTC_Seconds();
+    gActLogOpenEntry.Frequency = Frequency;
+    gActLogOpenEntry.Duration  = 0;
+    gActLogOpenEntry.Rssi      = Rssi;
+    gActLogOpenEntry.Source    = Source;
+    gActLogOpenEntry.CodeType  = CODE_TYPE_OFF;
+    gActLogOpenEntry.Code      = 0;
+    gActLogOpenEntry.Flags     = RTC_AnchorValid() ? ACTLOG_FLAG_TIME_VALID : 0U;
+    gActLogOpen = true;
+}
+
+void ACTLOG_End(void)
+{
+    if (!gActLogOpen)
+        return;
+
+    const uint32_t duration = (uint32_t)(millis() - gActLogOpenStartMs) / 100U;
+    gActLogOpenEntry.Duration = (duration > 0xFFFFU) ? 0xFFFFU : (uint16_t)duration;
+    gActLogOpen = false;
+
+    PushEntry(&gActLogOpenEntry);
+}
+
+void ACTLOG_MarkTone(bool CtcssFound, bool CdcssFound)
+{
+    if (!gActLogOpen)
+        return;
+
+    // Squelch opens before the tone decoder settles, so the code is only
+    // known from the found interrupt on.
+    uint8_t code;
+    const DCS_CodeType_t type = RADIO_GetDecodedCode(CtcssFound, CdcssFound, &code);
+    if (type == CODE_TYPE_OFF)
+        return;
+
+    gActLogOpenEntry.CodeType = type;
+    gActLogOpenEntry.Code     = code;
+    gActLogOpenEntry.Flags   |= ACTLOG_FLAG_TONE_MATCH;
+}
+
+void ACTLOG_Flush(void)
+{
+    while (gActLogRingCount > 0) {
+        uint16_t tail = (uint16_t)((gActLogRingHead + ACTLOG_RAM_ENTRIES - gActLogRingCount) % ACTLOG_RAM_ENTRIES);
+
+        while (gActLogRingCount > 0 && gActLogSectorCount < ACTLOG_ENTRIES_PER_SECTOR) {
+            gActLogSector[1U + gActLogSectorCount++] = gActLogRing[tail];
+            tail = (uint16_t)((tail + 1U) % ACTLOG_RAM_ENTRIES);
+            gActLogRingCount--;
+        }
+
+        ProgramPending();
+
+        if (gActLogSectorCount >= ACTLOG_ENTRIES_PER_SECTOR)
+            AdvanceSector();
+    }
+
+    gActLogIdle_500ms = 0;
+
+    // We are already off the hot path: refresh the RTC anchor as well.
+    RTC_Anchor();
+}
+
+void ACTLOG_TimeSlice500ms(void)
+{
+    const bool busy = gScanStateDir != SCAN_OFF || SCANNER_IsScanning() || gCurrentFunction == FUNCTION_TRANSMIT;
+
+    // Erase the next sector while nothing is going on, one flash operation per slice.
+    if (!gActLogNextErased && !busy) {
+        gActLogNextErased = shared_erase_c(SectorAddress(NextSector()), ACTLOG_SECTOR_SIZE);
+        return;
+    }
+
+    if (gActLogRingCount == 0)
+        return;
+
+    if (gActLogIdle_500ms < 0xFFFFU)
+        gActLogIdle_500ms++;
+
+    // A batch is "sector sized" when it completes the open sector; also flush
+    // early if the RAM queue is getting close to overwriting itself.
+    const bool batchReady = gActLogRingCount >= (ACTLOG_ENTRIES_PER_SECTOR - gActLogSectorCount) ||
+                            gActLogRingCount >= (ACTLOG_RAM_ENTRIES * 3U) / 4U;
+
+    if (batchReady || (!busy && gActLogIdle_500ms >= ACTLOG_IDLE_FLUSH_500ms))
+        ACTLOG_Flush();
+}
+
+uint32_t ACTLOG_GetCount(void)
+{
+    return (uint32_t)gActLogRingCount + gActLogSectorCount + (uint32_t)gActLogOlderSectors * ACTLOG_ENTRIES_PER_SECTOR;
+}
+
+bool ACTLOG_Read(uint32_t Index, ACTLOG_Entry_t *pEntry)
+{
+    if (Index < gActLogRingCount) {
+        const uint16_t pos = (uint16_t)((gActLogRingHead + ACTLOG_RAM_ENTRIES - 1U - Index) % ACTLOG_RAM_ENTRIES);
+        *pEntry = gActLogRing[pos];
+        return true;
+    }
+    Index -= gActLogRingCount;
+
+    if (Index < gActLogSectorCount) {
+        *pEntry = gActLogSector[gActLogSectorCount - Index];
+        return true;
+    }
+    Index -= gActLogSectorCount;
+
+    const uint32_t back = Index / ACTLOG_ENTRIES_PER_SECTOR;
+    if (back >= gActLogOlderSectors)
+        return false;
+
+    const uint8_t  sector = (uint8_t)((gActLogSectorIndex + ACTLOG_FLASH_SECTORS - 1U - back) % ACTLOG_FLASH_SECTORS);
+    const uint32_t slot   = ACTLOG_ENTRIES_PER_SECTOR - (Index % ACTLOG_ENTRIES_PER_SECTOR);
+
+    return shared_read_c(SectorAddress(sector) + slot * sizeof(ACTLOG_Entry_t), pEntry, sizeof(*pEntry));
+}
+
+static void FormatCode(char *pString, size_t Size, const ACTLOG_Entry_t *pEntry)
+{
+    switch (pEntry->CodeType) {
+        case CODE_TYPE_CONTINUOUS_TONE:
+            if (pEntry->Code < ARRAY_SIZE(CTCSS_Options)) {
+                snprintf(pString, Size, "C%u.%u", CTCSS_Options[pEntry->Code] / 10U, CTCSS_Options[pEntry->Code] % 10U);
+                return;
+            }
+            break;
+        case CODE_TYPE_DIGITAL:
+        case CODE_TYPE_REVERSE_DIGITAL:
+            if (pEntry->Code < ARRAY_SIZE(DCS_Options)) {
+                snprintf(pString, Size, "D%03o%c", DCS_Options[pEntry->Code],
+                        pEntry->CodeType == CODE_TYPE_DIGITAL ? 'N' : 'I');
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+    snprintf(pString, Size, "--");
+}
+
+static void Render(uint32_t Top, uint32_t Count)
+{
+    static const char Sources[3] = {'Q', 'S', 'P'};
+    char           String[40];   // 最坏情况的日期行，显示前截到一行 31 个字符
+    char           Code[10];
+    uint8_t        date[6];
+    ACTLOG_Entry_t entry;
+
+    memset(gStatusLine, 0, sizeof(gStatusLine));
+    UI_DisplayClear();
+
+    snprintf(String, sizeof(String), "LOG %lu/%lu", Count ? (unsigned long)(Top + 1U) : 0UL, (unsigned long)Count);
+    GUI_DisplaySmallest(String, 0, 1, true, true);
+    if (gActLogDropped) {
+        snprintf(String, sizeof(String), "DROP %lu", (unsigned long)gActLogDropped);
+        GUI_DisplaySmallest(String, 80, 1, true, true);
+    }
+
+    for (uint8_t row = 0; row < ACTLOG_ROWS_PER_PAGE; row++) {
+        if (!ACTLOG_Read(Top + row, &entry))
+            break;
+
+        const uint8_t line = (uint8_t)(row * 2U);
+
+        snprintf(String, sizeof(String), "%c%3u.%04u %3u %3us",
+                entry.Source < sizeof(Sources) ? Sources[entry.Source] : '?',
+                (unsigned)(entry.Frequency / 100000U), (unsigned)((entry.Frequency % 100000U) / 10U),
+                (unsigned)entry.Rssi, (unsigned)(entry.Duration / 10U));
+        UI_PrintStringSmall(String, 0, 0, line);
+
+        RTC_SecondsToDate(entry.Time, date);
+        FormatCode(Code, sizeof(Code), &entry);
+        snprintf(String, sizeof(String), "20%02u-%02u-%02u %02u:%02u:%02u %s%s",
+                date[0], date[1], date[2], date[3], date[4], date[5], Code,
+                (entry.Flags & ACTLOG_FLAG_TONE_MATCH) ? "*" : "");
+        String[31] = '\0';
+        GUI_DisplaySmallest(String, 4, (uint8_t)(line * 8U + 9U), false, true);
+    }
+
+    ST7565_BlitStatusLine();
+    ST7565_BlitFullScreen();
+}
+
+// F+EXIT: browse the log (UP/DOWN scroll, EXIT leaves).
+void ACTLOG_Browse(void)
+{
+    KEYS_Event_t event;
+    uint32_t     top    = 0;
+    bool         redraw = true;
+
+    // Events are ours until we return, so the main UI never sees the EXIT.
+    while (1) {
+        const uint32_t count = ACTLOG_GetCount();
+
+        if (redraw) {
+            Render(top, count);
+            redraw = false;
+        }
+
+        // Key handling holds the radio lock; let squelch and scanning run while we wait.
+        RADIOTASK_Unlock();
+        const bool pressed = KEYS_Wait(&event, 1000U);
+        RADIOTASK_Lock();
+
+        if (!pressed)
+            continue;
+        if (event.Action != KEYS_PRESS && event.Action != KEYS_REPEAT)
+            continue;
+        if (event.Key == KEY_EXIT)
+            break;
+
+        if (event.Key == KEY_UP && top > 0) {
+            top--;
+            redraw = true;
+        }
+        if (event.Key == KEY_DOWN && top + 1U < count) {
+            top++;
+            redraw = true;
+        }
+    }
+
+    gUpdateStatus  = true;
+    gUpdateDisplay = true;
+}
+
+#endif
@@ -0,0 +1,101 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_ACTLOG_H
+#define APP_ACTLOG_H
+
+#ifdef ENABLE_ACTIVITY_LOG
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../driver/eeprom.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Activity log: every scanner / spectrum / squelch hit becomes one 16-byte
+// record.  Hits are queued in RAM from the radio paths (the oldest is dropped
+// and counted if the queue overflows) and appended to the "shared" partition
+// from the 500ms slice.  Sectors are append-only: the next one is erased ahead
+// of time while the radio is idle, so a flush only programs the new records.
+//
+// Shared partition layout: the log owns the 64KB the EEPROM driver leaves
+// unmapped above the logical EEPROM (EEPROM_SHARED_RESERVED_BASE):
+//   [ACTLOG_FLASH_BASE .. +ACTLOG_FLASH_SECTORS*4KB)
+//   each sector: slot 0 = ACTLOG_SectorHeader_t, slots 1..255 = entries,
+//   filled in order; the first erased slot (Time == 0xFFFFFFFF) ends it.
+//   One sector is kept erased ahead of the current one.
+#define ACTLOG_FLASH_BASE        EEPROM_SHARED_RESERVED_BASE
+#define ACTLOG_FLASH_SECTORS     16U
+#define ACTLOG_SECTOR_SIZE       0x1000U
+#define ACTLOG_SLOTS_PER_SECTOR  (ACTLOG_SECTOR_SIZE / sizeof(ACTLOG_Entry_t))
+#define ACTLOG_ENTRIES_PER_SECTOR (ACTLOG_SLOTS_PER_SECTOR - 1U)
+#define ACTLOG_RAM_ENTRIES       128U
+
+enum ACTLOG_Source_t {
+    ACTLOG_SOURCE_SQUELCH = 0,
+    ACTLOG_SOURCE_SCANNER,
+    ACTLOG_SOURCE_SPECTRUM
+};
+
+enum {
+    ACTLOG_FLAG_TONE_MATCH = 1U << 0,   // CodeType/Code were decoded while open
+    ACTLOG_FLAG_TIME_VALID = 1U << 1    // Time came from a valid PCF8563 reading
+};
+
+typedef struct {
+    uint32_t Time;       // seconds since 2000-01-01 00:00:00 (RTC local time)
+    uint32_t Frequency;  // 10Hz units
+    uint16_t Duration;   // 100ms units, saturates at 0xFFFF
+    uint16_t Rssi;       // peak raw BK4819 RSSI
+    uint8_t  Source;     // ACTLOG_Source_t
+    uint8_t  CodeType;   // DCS_CodeType_t decoded by the BK4819, CODE_TYPE_OFF if none
+    uint8_t  Code;       // index into CTCSS_Options / DCS_Options
+    uint8_t  Flags;
+} ACTLOG_Entry_t;
+
+typedef struct {
+    uint32_t Magic;
+    uint32_t Sequence;
+    uint8_t  Version;
+    uint8_t  Padding[7];
+} ACTLOG_SectorHeader_t;
+
+void     ACTLOG_Init(void);
+
+// Hot-path hooks: RAM only, never touch I2C or flash.
+void     ACTLOG_Begin(uint8_t Source, uint32_t Frequency, uint16_t Rssi);
+void     ACTLOG_End(void);
+void     ACTLOG_MarkTone(bool CtcssFound, bool CdcssFound);
+
+void     ACTLOG_TimeSlice500ms(void);
+void     ACTLOG_Flush(void);
+
+// Index 0 is the newest entry.
+uint32_t ACTLOG_GetCount(void);
+bool     ACTLOG_Read(uint32_t Index, ACTLOG_Entry_t *pEntry);
+
+void     ACTLOG_Browse(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
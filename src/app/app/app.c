@@ -48,12 +48,20 @@
 #include "generic.h"
 #include "main.h"
 #include "./menu.h"
+#include "radiotask.h"
 #include "scanner.h"
 
 #ifdef ENABLE_UART
 #include "uart.h"
 #endif
 
+#ifdef ENABLE_ACTIVITY_LOG
+#include "actlog.h"
+#endif
+#ifdef ENABLE_TELEMETRY
+#include "telemetry.h"
+#endif
+
 #include "../audio.h"
 #include "../board.h"
 #include "../driver/backlight.h"
@@ -64,6 +72,7 @@
 #endif
 
 #include "../driver/bk4819.h"
+#include "../driver/eeprom.h"
 #include "../driver/keyboard.h"
 #include "../driver/st7565.h"
 #include "../driver/system.h"
@@ -73,8 +82,10 @@
 #include "../frequencies.h"
 #include "../functions.h"
 #include "../helper/battery.h"
+#include "../helper/timerwheel.h"
 #include "../misc.h"
 #include "../radio.h"
+#include "../scheduler.h"
 #include "../settings.h"
 
 #if defined(ENABLE_OVERLAY)
@@ -95,12 +106,18 @@
 #include "../ui/status.h"
 #include "../ui/ui.h"
 #include "messenger.h"
+#include "../helper/keys.h"
+#include "../helper/profiler.h"
+#include "../helper/trace.h"
 #ifdef ENABLE_ARDUBOY
 #include "arduboy.h"
 #endif
 #if defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
 #include "arduboy_avr.h"
 #endif
+#ifdef ENABLE_PROFILER
+#include "profview.h"
+#endif
 
 #ifdef ENABLE_MESSENGER_NOTIFICATION
 bool gPlayMSGRing = false;
@@ -112,7 +129,11 @@ static bool flagSaveChannel;
 #if defined(ENABLE_ARDUBOY) || (defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR))
 static bool gIgnoreArduboySide1Release;
 static bool gIgnoreArduboySide2Release;
-static uint8_t gFKeyChordCountdown_10ms;
+#endif
+// 当前事件发生时按住的所有键，F+SIDE 这类组合键看它
+static uint32_t gKeyChord;
+#ifdef ENABLE_PROFILER
+static bool gIgnoreProfilerSide2Release;
 #endif
 
 static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
@@ -591,38 +612,12 @@ static void DualwatchAlternate(void) {
 }
 
 static void CheckRadioInterrupts(void) {
+    BK4819_IrqStatus_t interrupts;
+
     if (SCANNER_IsScanning())
         return;
 
-    while (BK4819_ReadRegister(BK4819_REG_0C) & 1u) { // BK chip interrupt request
-        // clear interrupts
-        BK4819_WriteRegister(BK4819_REG_02, 0);
-        // fetch interrupt status bits
-
-        union {
-            struct {
-                uint16_t __UNUSED: 1;
-                uint16_t fskRxSync: 1;
-                uint16_t sqlLost: 1;
-                uint16_t sqlFound: 1;
-                uint16_t voxLost: 1;
-                uint16_t voxFound: 1;
-                uint16_t ctcssLost: 1;
-                uint16_t ctcssFound: 1;
-                uint16_t cdcssLost: 1;
-                uint16_t cdcssFound: 1;
-                uint16_t cssTailFound: 1;
-                uint16_t dtmf5ToneFound: 1;
-                uint16_t fskFifoAlmostFull: 1;
-                uint16_t fskRxFinied: 1;
-                uint16_t fskFifoAlmostEmpty: 1;
-                uint16_t fskTxFinied: 1;
-            };
-            uint16_t __raw;
-        } interrupts;
-
-        interrupts.__raw = BK4819_ReadRegister(BK4819_REG_02);
-
+    while (BK4819_ReadIrq(&interrupts)) { // BK chip interrupt request
         // 0 = no phase shift
         // 1 = 120deg phase shift
         // 2 = 180deg phase shift
@@ -713,12 +708,26 @@ static void CheckRadioInterrupts(void) {
 
         if (interrupts.sqlLost) {
             g_SquelchLost = true;
+            TRACE(SQUELCH, 1, gRxVfo->pRX->Frequency);
             BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2_GREEN, true);
+#ifdef ENABLE_ACTIVITY_LOG
+            ACTLOG_Begin(ACTLOG_SOURCE_SQUELCH, gRxVfo->pRX->Frequency, BK4819_GetRSSI());
+#endif
         }
 
+#ifdef ENABLE_ACTIVITY_LOG
+        // After Begin: the tone can be found in the same batch the squelch opened
+        if (interrupts.ctcssFound || interrupts.cdcssFound)
+            ACTLOG_MarkTone(interrupts.ctcssFound, interrupts.cdcssFound);
+#endif
+
         if (interrupts.sqlFound) {
             g_SquelchLost = false;
+            TRACE(SQUELCH, 0, gRxVfo->pRX->Frequency);
             BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2_GREEN, false);
+#ifdef ENABLE_ACTIVITY_LOG
+            ACTLOG_End();
+#endif
         }
 
 #ifdef ENABLE_AIRCOPY
@@ -761,6 +770,15 @@ void APP_EndTransmission(bool inmediately) {
 }
 
 #ifdef ENABLE_VOX
+// VOX 断开后的发射保持：时间轮单次定时器，运行中即保持，不再占用每个节拍的倒计时。
+// 到期不做事，HandleVox 在下一个时间片看到它停了再结束发射
+static void VOX_StopExpired(void *pArg)
+{
+    (void)pArg;
+}
+
+static TIMERWHEEL_Timer_t gVoxStopTimer = TIMERWHEEL_TIMER(VOX_StopExpired, NULL);
+
 static void HandleVox(void)
 {
 #ifdef ENABLE_DTMF_CALLING
@@ -793,8 +811,8 @@ static void HandleVox(void)
     if (gVOX_NoiseDetected)
     {
         if (g_VOX_Lost)
-            gVoxStopCountdown_10ms = vox_stop_count_down_10ms;
-        else if (gVoxStopCountdown_10ms == 0)
+            TIMERWHEEL_Start(&gVoxStopTimer, vox_stop_count_down_10ms * SCHEDULER_SYSTICK_MS, 0);
+        else if (!TIMERWHEEL_IsActive(&gVoxStopTimer))
             gVOX_NoiseDetected = false;
 
         if (gCurrentFunction == FUNCTION_TRANSMIT && !gPttIsPressed && !gVOX_NoiseDetected)
@@ -826,6 +844,7 @@ if (gCurrentFunction != FUNCTION_TRANSMIT && !SerialConfigInProgress())
 #endif
 
 void APP_Update(void) {
+    PROFILER_ZONE(APP_UPDATE);
 #ifdef ENABLE_VOICE
     if (gFlagPlayQueuedVoice) {
             AUDIO_PlayQueuedVoice();
@@ -1046,174 +1065,75 @@ static void CheckKeys(void) {
 
 // --------------------- OTHER KEYS ----------------------------
 
-    // scan the hardware keys
-    KEY_Code_t Key = KEYBOARD_Poll();
-
-#if defined(ENABLE_ARDUBOY) || (defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR))
-    // On real hardware we often only get one "current" key at a time.
-    // Latch a short "F was down" window to make chords like F+SIDE1 reliable.
-    if (Key == KEY_F) {
-        gFKeyChordCountdown_10ms = 50; // 500ms
-    } else if (gFKeyChordCountdown_10ms > 0) {
-        gFKeyChordCountdown_10ms--;
-    }
-#endif
-
-    if (Key != KEY_INVALID) // any key pressed
-        boot_counter_10ms = 0;   // cancel boot screen/beeps if any key pressed
-
-    if (gKeyReading0 != Key) // new key pressed
-    {
-
-        if (gKeyReading0 != KEY_INVALID && Key != KEY_INVALID)
-            ProcessKey(gKeyReading1, false, gKeyBeingHeld);  // key pressed without releasing previous key
-
-        gKeyReading0 = Key;
-        gDebounceCounter = 0;
-        return;
-    }
+    KEYS_Event_t event;
 
-    gDebounceCounter++;
-
-    if (gDebounceCounter == key_debounce_10ms) // debounced new key pressed
-    {
-        if (Key == KEY_INVALID) //all non PTT keys released
-        {
-            if (gKeyReading1 != KEY_INVALID) // some button was pressed before
-            {
-                ProcessKey(gKeyReading1, false, gKeyBeingHeld); // process last button released event
-                gKeyReading1 = KEY_INVALID;
-            }
-        } else // process new key pressed
-        {
-            gKeyReading1 = Key;
-            ProcessKey(Key, true, false);
-
-        }
+    // 没有扫描任务（模拟器、未开 ENABLE_KEYPAD_IRQ）时在这里扫描
+    KEYBOARD_Update();
 
-        gKeyBeingHeld = false;
-        return;
-    }
+    // 去抖、长按计时和连发都在事件里了，这里只按顺序分发
+    while (KEYS_Get(&event)) {
+        const KEY_Code_t Key = (KEY_Code_t)event.Key;
 
-    if (gDebounceCounter < key_repeat_delay_10ms ||
-        Key == KEY_INVALID) // the button is not held long enough for repeat yet, or not really pressed
-        return;
+        gKeyChord = event.Chord;
 
-    if (gDebounceCounter == key_repeat_delay_10ms) //initial key repeat with longer delay
-    {
-        if (Key != KEY_PTT) {
-            gKeyBeingHeld = true;
-            ProcessKey(Key, true, true); // key held event
+        switch (event.Action) {
+            case KEYS_PRESS:
+                boot_counter_10ms = 0;   // cancel boot screen/beeps if any key pressed
 
-        }
+                if (gKeyReading1 != KEY_INVALID)
+                    ProcessKey(gKeyReading1, false, gKeyBeingHeld);  // key pressed without releasing previous key
 
-    } else //subsequent fast key repeats
-    {
-        if (Key == KEY_UP || Key == KEY_DOWN) // fast key repeats for up/down buttons
-        {
-            gKeyBeingHeld = true;
-            if ((gDebounceCounter % key_repeat_10ms) == 0)
-                ProcessKey(Key, true, true); // key held event
+                gKeyReading1 = Key;
+                gKeyBeingHeld = false;
+                ProcessKey(Key, true, false);
+                break;
 
+            case KEYS_HOLD:    // initial key repeat with longer delay
+                if (Key == gKeyReading1 && Key != KEY_PTT) {
+                    gKeyBeingHeld = true;
+                    ProcessKey(Key, true, true); // key held event
+                }
+                break;
 
+            case KEYS_REPEAT:    // fast key repeats for up/down buttons
+                if (Key == gKeyReading1 && (Key == KEY_UP || Key == KEY_DOWN)) {
+                    gKeyBeingHeld = true;
+                    ProcessKey(Key, true, true); // key held event
+                }
+                break;
 
+            case KEYS_RELEASE:
+                if (Key == gKeyReading1) {
+                    ProcessKey(Key, false, gKeyBeingHeld); // process last button released event
+                    gKeyReading1 = KEY_INVALID;
+                    gKeyBeingHeld = false;
+                }
+                break;
         }
-
-        if (gDebounceCounter < 0xFFFF)
-            return;
-
-        gDebounceCounter = key_repeat_delay_10ms + 1;
     }
 
-}
-
-void APP_TimeSlice10ms(void) {
-    gNextTimeslice = false;
-    gFlashLightBlinkCounter++;
-
-    // RTC menu auto-refresh: keep updating the displayed time even when no keys are pressed.
-    // Refresh at 10Hz (every 100ms) when currently on the RTC menu item.
-    static uint32_t s_last_rtc_menu_refresh_ms = 0;
-    if (gScreenToDisplay == DISPLAY_MENU && UI_MENU_GetCurrentMenuId() == MENU_RTC) {
-        const uint32_t now_ms = millis();
-        if ((uint32_t)(now_ms - s_last_rtc_menu_refresh_ms) >= 100U) {
-            s_last_rtc_menu_refresh_ms = now_ms;
-            gUpdateDisplay = true;
-        }
-    }
-#ifdef ENABLE_MESSENGER
-    keyTickCounter++;
-#endif
-#ifdef ENABLE_BOOT_BEEPS
-    if (boot_counter_10ms > 0 && (boot_counter_10ms % 25) == 0) {
-        AUDIO_PlayBeep(BEEP_880HZ_40MS_OPTIONAL);
+    // 模态界面自己取事件；回来时它吃掉了当前键的松开，这里补上
+    if (gKeyReading1 != KEY_INVALID && !(KEYS_DownMask() & KEYS_MASK(gKeyReading1))) {
+        ProcessKey(gKeyReading1, false, gKeyBeingHeld);
+        gKeyReading1 = KEY_INVALID;
+        gKeyBeingHeld = false;
     }
-#endif
+}
 
+// CheckRadioInterrupts 和 AM 修正：电台任务运行时由它调用，否则在主循环时间片里原位执行
+static void RadioTimeSlice10msFirst(void) {
 #ifdef ENABLE_AM_FIX
     if (gRxVfo->Modulation == MODULATION_AM) {
         AM_fix_10ms(gEeprom.RX_VFO);
     }
 #endif
-#ifdef ENABLE_UART
-
-    if (UART_IsCommandAvailable()) {
-
-    // On ESP32, globally disabling interrupts while handling UART commands is unsafe.
-    // Replies use the Arduino/IDF UART driver which may block/yield and relies on interrupts,
-    // so disabling interrupts here can trigger an "Interrupt wdt timeout" reset.
-#if !defined(ENABLE_OPENCV) && !defined(ARDUINO_ARCH_ESP32)
-    portDISABLE_INTERRUPTS();
-#endif
-    UART_HandleCommand();
-#if !defined(ENABLE_OPENCV) && !defined(ARDUINO_ARCH_ESP32)
-    portENABLE_INTERRUPTS();
-#endif
-    }
-#endif
-    if (gReducedService)
-        return;
-
-#if defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
-    if (gScreenToDisplay == DISPLAY_ARDUBOY_AVR) {
-        CheckKeys();
-        ARDUBOY_AVR_TimeSlice10ms();
-        if (gUpdateDisplay) {
-            gUpdateDisplay = false;
-            GUI_DisplayScreen();
-        }
-        // The Arduboy AVR screen drives its own status line and full-screen blits.
-        // Avoid extra status refresh work here to keep emulator performance high.
-        gUpdateStatus = false;
-        return;
-    }
-#endif
 
     if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode)
         CheckRadioInterrupts();
+}
 
-    if (gCurrentFunction == FUNCTION_TRANSMIT) {    // transmitting
-//#ifdef ENABLE_AUDIO_BAR
-        if ((gFlashLightBlinkCounter % (150 / 10)) == 0) // once every 150ms
-            UI_DisplayAudioBar();
-//#endif
-    }
-
-    if (gUpdateDisplay) {
-        gUpdateDisplay = false;
-        GUI_DisplayScreen();
-    }
-
-
-    if (gUpdateStatus)
-        UI_DisplayStatus();
-
-    // Skipping authentic device checks
-
-#ifdef ENABLE_FMRADIO
-    if (gFmRadioMode && gFmRadioCountdown_500ms > 0)   // 1of11
-            return;
-#endif
+// VOX、发射告警、尾音消除、FM 恢复和扫描器计数
+static void RadioTimeSlice10msSecond(void) {
 #ifdef ENABLE_FLASHLIGHT
     //    FlashlightTimeSlice();
 #endif
@@ -1303,6 +1223,140 @@ gAlarmState = ALARM_STATE_SITE_ALARM;
 
 
     SCANNER_TimeSlice10ms();
+}
+
+void APP_RadioInterrupts(void) {
+    if (gReducedService)
+        return;
+
+#if defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
+    if (gScreenToDisplay == DISPLAY_ARDUBOY_AVR)
+        return;
+#endif
+
+    if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode)
+        CheckRadioInterrupts();
+}
+
+void APP_RadioTimeSlice10ms(void) {
+    PROFILER_ZONE(RADIO_SLICE);
+    if (gReducedService)
+        return;
+
+#if defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
+    if (gScreenToDisplay == DISPLAY_ARDUBOY_AVR)
+        return;
+#endif
+
+    RadioTimeSlice10msFirst();
+
+#ifdef ENABLE_FMRADIO
+    if (gFmRadioMode && gFmRadioCountdown_500ms > 0)   // 1of11
+            return;
+#endif
+
+    RadioTimeSlice10msSecond();
+}
+
+// 串口命令和电台中断；返回 false 表示本次时间片到此为止
+static bool TimeSlice10msInput(const bool radio) {
+    EEPROM_MirrorTimeSlice();
+
+    // RTC menu auto-refresh: keep updating the displayed time even when no keys are pressed.
+    // Refresh at 10Hz (every 100ms) when currently on the RTC menu item.
+    static uint32_t s_last_rtc_menu_refresh_ms = 0;
+    if (gScreenToDisplay == DISPLAY_MENU && UI_MENU_GetCurrentMenuId() == MENU_RTC) {
+        const uint32_t now_ms = millis();
+        if ((uint32_t)(now_ms - s_last_rtc_menu_refresh_ms) >= 100U) {
+            s_last_rtc_menu_refresh_ms = now_ms;
+            gUpdateDisplay = true;
+        }
+    }
+#ifdef ENABLE_MESSENGER
+    keyTickCounter++;
+#endif
+#ifdef ENABLE_BOOT_BEEPS
+    if (boot_counter_10ms > 0 && (boot_counter_10ms % 25) == 0) {
+        AUDIO_PlayBeep(BEEP_880HZ_40MS_OPTIONAL);
+    }
+#endif
+
+#ifdef ENABLE_UART
+
+    for (unsigned int frames = 0; frames < UART_MAX_FRAMES_PER_POLL && UART_IsCommandAvailable(); frames++) {
+
+    // On ESP32, globally disabling interrupts while handling UART commands is unsafe.
+    // Replies use the Arduino/IDF UART driver which may block/yield and relies on interrupts,
+    // so disabling interrupts here can trigger an "Interrupt wdt timeout" reset.
+#if !defined(ENABLE_OPENCV) && !defined(ARDUINO_ARCH_ESP32)
+    portDISABLE_INTERRUPTS();
+#endif
+    UART_HandleCommand();
+#if !defined(ENABLE_OPENCV) && !defined(ARDUINO_ARCH_ESP32)
+    portENABLE_INTERRUPTS();
+#endif
+    }
+#endif
+#ifdef ENABLE_TELEMETRY
+    TELEM_Poll(false);
+#endif
+    if (gReducedService)
+        return false;
+
+#if defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
+    if (gScreenToDisplay == DISPLAY_ARDUBOY_AVR) {
+        CheckKeys();
+        ARDUBOY_AVR_TimeSlice10ms();
+        if (gUpdateDisplay) {
+            gUpdateDisplay = false;
+            GUI_DisplayScreen();
+        }
+        // The Arduboy AVR screen drives its own status line and full-screen blits.
+        // Avoid extra status refresh work here to keep emulator performance high.
+        gUpdateStatus = false;
+        return false;
+    }
+#endif
+
+    if (radio)
+        RadioTimeSlice10msFirst();
+
+    return true;
+}
+
+static void TimeSlice10msRender(void) {
+    if (gFixInterfGlitch) {
+        gFixInterfGlitch = false;
+        ST7565_FixInterfGlitch();
+    }
+
+    if (gCurrentFunction == FUNCTION_TRANSMIT) {    // transmitting
+//#ifdef ENABLE_AUDIO_BAR
+        if ((gFlashLightBlinkCounter % (150 / 10)) == 0) // once every 150ms
+            UI_DisplayAudioBar();
+//#endif
+    }
+
+    if (gUpdateDisplay) {
+        gUpdateDisplay = false;
+        GUI_DisplayScreen();
+    }
+
+
+    if (gUpdateStatus)
+        UI_DisplayStatus();
+
+    // Skipping authentic device checks
+}
+
+static void TimeSlice10msKeys(const bool radio) {
+#ifdef ENABLE_FMRADIO
+    if (gFmRadioMode && gFmRadioCountdown_500ms > 0)   // 1of11
+            return;
+#endif
+
+    if (radio)
+        RadioTimeSlice10msSecond();
 
 #ifdef ENABLE_AIRCOPY
     if (gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER && gAirCopyIsSendMode == 1)
@@ -1324,6 +1378,28 @@ gAlarmState = ALARM_STATE_SITE_ALARM;
 #endif
 }
 
+void APP_TimeSlice10ms(void) {
+    PROFILER_ZONE(UI_SLICE);
+    // 电台任务在跑时电台那一半由它负责，这里只剩串口、按键和画屏
+    const bool radio = !RADIOTASK_IsRunning();
+
+    gNextTimeslice = false;
+    gFlashLightBlinkCounter++;
+
+    RADIOTASK_Lock();
+    const bool more = TimeSlice10msInput(radio);
+    RADIOTASK_Unlock();
+    if (!more)
+        return;
+
+    // 画屏不持锁，电台任务在另一个核上照常处理静噪和扫描
+    TimeSlice10msRender();
+
+    RADIOTASK_Lock();
+    TimeSlice10msKeys(radio);
+    RADIOTASK_Unlock();
+}
+
 void cancelUserInputModes(void) {
     if (gDTMF_InputMode || gDTMF_InputBox_Index > 0) {
         DTMF_clear_input_box();
@@ -1343,7 +1419,7 @@ void cancelUserInputModes(void) {
 }
 
 // this is called once every 500ms
-void APP_TimeSlice500ms(void) {
+static void TimeSlice500ms(void) {
     gNextTimeslice_500ms = false;
     bool exit_menu = false;
 #ifdef ENABLE_MESSENGER_NOTIFICATION
@@ -1368,6 +1444,10 @@ void APP_TimeSlice500ms(void) {
     }
 #endif
 
+#ifdef ENABLE_ACTIVITY_LOG
+    ACTLOG_TimeSlice500ms();
+#endif
+
     // Skipped authentic device check
 
     if (gKeypadLocked > 0)
@@ -1448,6 +1528,7 @@ void APP_TimeSlice500ms(void) {
 
         if (gBatteryCurrent > 500 || gBatteryCalibration[3] < gBatteryCurrentVoltage) {
 
+            EEPROM_MirrorFlush();
             esp_restart();
 
         }
@@ -1593,6 +1674,12 @@ if (gDTMF_IsTx && gDTMF_TxStopCountdown_500ms > 0 && --gDTMF_TxStopCountdown_500
 #endif
 }
 
+void APP_TimeSlice500ms(void) {
+    RADIOTASK_Lock();
+    TimeSlice500ms();
+    RADIOTASK_Unlock();
+}
+
 #if defined(ENABLE_ALARM) || defined(ENABLE_TX1750)
 static void ALARM_Off(void)
 {
@@ -1620,6 +1707,7 @@ if (gAlarmState == ALARM_STATE_TXALARM || gAlarmState == ALARM_STATE_TX1750) {
 
 
 static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
+    TRACE(KEY, Key, (bKeyPressed ? 1U : 0U) | (bKeyHeld ? 2U : 0U));
     if (Key == KEY_EXIT && !BACKLIGHT_IsOn() &&
         gEeprom.BACKLIGHT_TIME > 0) {    // just turn the light on for now so the user can see what's what
         BACKLIGHT_TurnOn();
@@ -1642,6 +1730,15 @@ static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
         return;
     }
 #endif
+#ifdef ENABLE_PROFILER
+    if (gIgnoreProfilerSide2Release &&
+        Key == KEY_SIDE2 &&
+        !bKeyPressed &&
+        !bKeyHeld) {
+        gIgnoreProfilerSide2Release = false;
+        return;
+    }
+#endif
 
     if (gCurrentFunction == FUNCTION_POWER_SAVE)
         FUNCTION_Select(FUNCTION_FOREGROUND); //OK
@@ -1835,7 +1932,7 @@ static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
     }
 
 #ifdef ENABLE_ARDUBOY
-    if ((gWasFKeyPressed || KEYBOARD_IsKeyDown(KEY_F) || gFKeyChordCountdown_10ms > 0) &&
+    if ((gWasFKeyPressed || (gKeyChord & KEYS_MASK(KEY_F))) &&
         gScreenToDisplay == DISPLAY_MAIN &&
         Key == KEY_SIDE1 &&
         bKeyPressed &&
@@ -1849,7 +1946,7 @@ static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
 #endif
 
 #if defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
-    if ((gWasFKeyPressed || KEYBOARD_IsKeyDown(KEY_F) || gFKeyChordCountdown_10ms > 0) &&
+    if ((gWasFKeyPressed || (gKeyChord & KEYS_MASK(KEY_F))) &&
         gScreenToDisplay == DISPLAY_MAIN &&
         Key == KEY_SIDE2 &&
         bKeyPressed &&
@@ -1860,6 +1957,19 @@ static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
         ARDUBOY_AVR_Enter();
         goto Skip;
     }
+#elif defined(ENABLE_PROFILER)
+    if ((gWasFKeyPressed || (gKeyChord & KEYS_MASK(KEY_F))) &&
+        gScreenToDisplay == DISPLAY_MAIN &&
+        Key == KEY_SIDE2 &&
+        bKeyPressed &&
+        !bKeyHeld) {
+        // F + SIDE2: profiler zones (the AVR emulator owns this chord when built in)
+        gWasFKeyPressed = false;
+        gIgnoreProfilerSide2Release = true;
+        PROFVIEW_Browse();
+        gRequestDisplayScreen = DISPLAY_MAIN;
+        goto Skip;
+    }
 #endif
 
     if (gWasFKeyPressed &&
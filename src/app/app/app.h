@@ -43,6 +43,12 @@ void APP_Update(void);
 
 void APP_TimeSlice10ms(void);
 
+// 电台那一半的 10ms 时间片，由电台任务调用（app/radiotask.h）
+void APP_RadioTimeSlice10ms(void);
+
+// 只处理 BK4819 中断，中断线触发时电台任务不等下一个节拍
+void APP_RadioInterrupts(void);
+
 void APP_TimeSlice500ms(void);
 
 #ifdef __cplusplus
@@ -28,6 +28,8 @@
 extern "C" {
 #include "../bitmaps.h"
 #include "../helper/battery.h"
+#include "../helper/keys.h"
+#include "../helper/profiler.h"
 #include "../driver/st7565.h"
 #include "../misc.h"
 #include "../ui/battery.h"
@@ -85,6 +87,8 @@ static bool gArduboyAvrHasFrame = false;
 static bool gArduboyAvrFirstFrameLogged = false;
 static int gArduboyAvrLastCpuState = -1;
 static uint8_t gArduboyAvrButtons = 0;
+// Keys still down when a game starts (e.g. the UP that launched it) stay ignored until released.
+static uint32_t gArduboyAvrStaleKeys = 0;
 static const char kArduboyAvrFxWarning[] = "FX data missing";
 static const char kArduboyAvrCpuHaltWarning[] = "ROM halted";
 static const char *gArduboyAvrMenuWarning = NULL;
@@ -962,6 +966,7 @@ static inline void ArduboyAvrUnlock(void) {
 }
 
 static void ArduboyAvrUpdateButtons(void);
+static uint8_t ArduboyAvrSyncButtons(void);
 static bool ArduboyAvrRenderDisplay(void);
 static void ArduboyAvrPreparePresent(void);
 static void ArduboyAvrPrintStatsIfDue(void);
@@ -990,7 +995,7 @@ static void ArduboyAvrTaskMain(void *arg) {
         const bool should_run = gArduboyAvrInitialized && gArduboyAvr &&
                                 (gArduboyAvrMode == ARDUBOY_AVR_MODE_GAME) &&
                                 !gArduboyAvrTaskStopRequested;
-        const uint8_t buttons = gArduboyAvrButtons;
+        const uint8_t buttons = should_run ? ArduboyAvrSyncButtons() : gArduboyAvrButtons;
 
         if (!should_run) {
             vTaskDelay(pdMS_TO_TICKS(10));
@@ -1013,7 +1018,10 @@ static void ArduboyAvrTaskMain(void *arg) {
         while ((gArduboyAvr->state == cpu_Running || gArduboyAvr->state == cpu_Sleeping) &&
                gArduboyAvrMode == ARDUBOY_AVR_MODE_GAME &&
                !gArduboyAvrTaskStopRequested) {
-            avr_run(gArduboyAvr);
+            {
+                PROFILER_ZONE(AVR_RUN);
+                avr_run(gArduboyAvr);
+            }
             if (((++iter) & 0xFFu) == 0) {
                 if (esp_timer_get_time() >= deadline_us) {
                     break;
@@ -1381,12 +1389,18 @@ void ARDUBOY_AVR_TimeSlice10ms(void) {
     }
 #endif
 
+    const uint8_t buttons = gArduboyAvrButtons;
+    if (ArduboyAvrSyncButtons() != buttons) {
+        ArduboyAvrUpdateButtons();
+    }
+
     const avr_cycle_count_t target =
         gArduboyAvr->cycle + avr_usec_to_cycles(gArduboyAvr, 10000);
 
     while ((gArduboyAvr->state == cpu_Running || gArduboyAvr->state == cpu_Sleeping) &&
            gArduboyAvr->cycle < target &&
            gArduboyAvrMode == ARDUBOY_AVR_MODE_GAME) {
+        PROFILER_ZONE(AVR_RUN);
         avr_run(gArduboyAvr);
     }
 
@@ -1439,6 +1453,22 @@ static uint8_t ArduboyAvrMapKey(KEY_Code_t key) {
     }
 }
 
+// Game buttons follow the debounced key state directly, so a press reaches the emulator
+// as soon as the keypad scanner sees it (independent of the main loop) and chords work.
+static uint8_t ArduboyAvrSyncButtons(void) {
+    const uint32_t down = KEYS_DownMask();
+    gArduboyAvrStaleKeys &= down;
+
+    uint8_t buttons = 0;
+    for (uint8_t key = 0; key < KEY_INVALID; ++key) {
+        if ((down & ~gArduboyAvrStaleKeys) & KEYS_MASK(key)) {
+            buttons = static_cast<uint8_t>(buttons | ArduboyAvrMapKey(static_cast<KEY_Code_t>(key)));
+        }
+    }
+    gArduboyAvrButtons = buttons;
+    return buttons;
+}
+
 void ARDUBOY_AVR_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
     if (Key == KEY_EXIT && !bKeyPressed) {
         // In-game EXIT returns to the ROM list; EXIT on the list returns to the main UI.
@@ -1479,17 +1509,7 @@ void ARDUBOY_AVR_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
         return;
     }
 
-    const uint8_t mask = ArduboyAvrMapKey(Key);
-    if (mask == 0) {
-        return;
-    }
-
-    if (bKeyPressed) {
-        gArduboyAvrButtons = static_cast<uint8_t>(gArduboyAvrButtons | mask);
-    } else {
-        gArduboyAvrButtons = static_cast<uint8_t>(gArduboyAvrButtons & ~mask);
-    }
-
+    // In-game buttons are taken from KEYS_DownMask() by ArduboyAvrSyncButtons().
     (void)bKeyHeld;
 }
 
@@ -1636,6 +1656,7 @@ static void ArduboyAvrStartGame(int index) {
 #endif
 
     gArduboyAvrButtons = 0;
+    gArduboyAvrStaleKeys = KEYS_DownMask();
     ArduboyAvrUpdateButtons();
     if (!ArduboyAvrLoadHex(gArduboyAvr, gArduboyAvrRoms[index].hex)) {
         return;
@@ -2,9 +2,20 @@
 #include "app.h"
 #include "chFrScanner.h"
 #include "../functions.h"
+#include "../helper/trace.h"
 #include "../misc.h"
 #include "../settings.h"
 
+#ifdef ENABLE_ACTIVITY_LOG
+#include "actlog.h"
+#include "../driver/bk4819.h"
+#endif
+
+#ifdef ENABLE_BAND_OCCUPANCY
+#include "occupancy.h"
+#include "../driver/bk4819.h"
+#endif
+
 int8_t gScanStateDir;
 bool gScanKeepResult;
 bool gScanPauseMode;
@@ -27,6 +38,17 @@ uint32_t initialFrqOrChan;
 uint8_t initialCROSS_BAND_RX_TX;
 uint32_t lastFoundFrqOrChan;
 
+#ifdef ENABLE_BAND_OCCUPANCY
+static bool occChannelBusy;
+
+// Called when the scanner leaves a channel: one occupancy sample, busy if
+// CHFRSCANNER_Found() fired for it.
+static void OccupancySample(void) {
+    OCC_AccumulateChannel(gRxVfo->pRX->Frequency, BK4819_GetRSSI(), occChannelBusy);
+    occChannelBusy = false;
+}
+#endif
+
 static void NextFreqChannel(void);
 
 static void NextMemChannel(void);
@@ -68,13 +90,21 @@ void CHFRSCANNER_ContinueScanning(void) {
     if (IS_FREQ_CHANNEL(gNextMrChannel)) {
         if (gCurrentFunction == FUNCTION_INCOMING)
             APP_StartListening(gMonitor ? FUNCTION_MONITOR : FUNCTION_RECEIVE);
-        else
+        else {
+#ifdef ENABLE_BAND_OCCUPANCY
+            OccupancySample();
+#endif
             NextFreqChannel();  // switch to next frequency
+        }
     } else {
         if (gCurrentCodeType == CODE_TYPE_OFF && gCurrentFunction == FUNCTION_INCOMING)
             APP_StartListening(gMonitor ? FUNCTION_MONITOR : FUNCTION_RECEIVE);
-        else
+        else {
+#ifdef ENABLE_BAND_OCCUPANCY
+            OccupancySample();
+#endif
             NextMemChannel();    // switch to next channel
+        }
     }
 
     gScanPauseMode = false;
@@ -105,6 +135,14 @@ void CHFRSCANNER_Found(void) {
         lastFoundFrqOrChan = gRxVfo->freq_config_RX.Frequency;
     }
 
+#ifdef ENABLE_ACTIVITY_LOG
+    ACTLOG_Begin(ACTLOG_SOURCE_SCANNER, gRxVfo->pRX->Frequency, BK4819_GetRSSI());
+#endif
+
+#ifdef ENABLE_BAND_OCCUPANCY
+    occChannelBusy = true;
+#endif
+
 
     gScanKeepResult = true;
 }
@@ -150,6 +188,7 @@ static void NextFreqChannel(void) {
 #endif
     gRxVfo->freq_config_RX.Frequency = APP_SetFrequencyByStep(gRxVfo, gScanStateDir);
 
+    TRACE(SCAN_HOP, TRACE_HOP_FREQUENCY, gRxVfo->freq_config_RX.Frequency);
     RADIO_ApplyOffset(gRxVfo);
     RADIO_ConfigureSquelchAndOutputPower(gRxVfo);
     RADIO_SetupRegisters(true);
@@ -232,6 +271,7 @@ static void NextMemChannel(void) {
         gEeprom.MrChannel[gEeprom.RX_VFO] = gNextMrChannel;
         gEeprom.ScreenChannel[gEeprom.RX_VFO] = gNextMrChannel;
 
+        TRACE(SCAN_HOP, TRACE_HOP_CHANNEL, gNextMrChannel);
         RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
         RADIO_SetupRegisters(true);
 
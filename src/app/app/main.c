@@ -41,6 +41,7 @@
 #include "../driver/bk4819.h"
 #include "dtmf.h"
 #include "../frequencies.h"
+#include "../helper/keys.h"
 #include "../misc.h"
 #include "../radio.h"
 #include "../settings.h"
@@ -54,6 +55,9 @@
 #ifdef ENABLE_DOPPLER
 #include "../app/doppler.h"
 #endif
+#ifdef ENABLE_ACTIVITY_LOG
+#include "../app/actlog.h"
+#endif
 
 #include "tle/tle.h"
 
@@ -100,6 +104,7 @@ static void processFKeyFunction(const KEY_Code_t Key, const bool beep) {
 #endif
 #ifdef ENABLE_4732
             SI4732_Main();
+            KEYS_Flush();   // SI4732_Main 自己轮询键盘，期间排队的事件作废
 #endif
             break;
 
@@ -225,6 +230,7 @@ gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
                 DOPPLER_MODE=0;
 #endif
                 APP_RunSpectrum();
+                KEYS_Flush();
                 gRequestDisplayScreen = DISPLAY_MAIN;
 #endif
             } else {
@@ -444,6 +450,15 @@ static void MAIN_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
 static void MAIN_Key_EXIT(bool bKeyPressed, bool bKeyHeld) {
 
 #include "../app/menu.h"
+#ifdef ENABLE_ACTIVITY_LOG
+    if (gWasFKeyPressed && bKeyPressed && !bKeyHeld) {
+        // F + EXIT: browse the scanner/spectrum activity log.
+        gWasFKeyPressed = false;
+        ACTLOG_Browse();
+        gRequestDisplayScreen = DISPLAY_MAIN;
+        return;
+    }
+#endif
 #ifdef ENABLE_TURN
     if (turn_flag) {
         turn_flag = false;
@@ -663,6 +678,7 @@ static void MAIN_Key_UP_DOWN(bool bKeyPressed, bool bKeyHeld, int8_t Direction)
             // F + DOWN: enter ephemeris-based TLE Doppler mode.
             // (Avoid the shift-array / spectrum doppler mode.)
             TLE_Main();
+            KEYS_Flush();
         }
 #endif
         return;
@@ -2348,7 +2348,7 @@ UI_MENU_GetCurrentMenuId() == MENU_MDC_ID
 
                         MENU_AcceptSetting();
 
-
+                        EEPROM_MirrorFlush();
                         esp_restart();
 
                     }
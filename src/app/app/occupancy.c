@@ -0,0 +1,127 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifdef ENABLE_BAND_OCCUPANCY
+
+#include <string.h>
+
+#include "app/occupancy.h"
+#include "../bsp/dp32g030/rtc.h"
+
+#define OCC_RSSI_UNMEASURED  0U
+#define OCC_RSSI_BLACKLISTED 0xFFFFU
+
+OCC_Survey_t gOccSurvey;
+
+static inline void OCC_Sample(uint8_t Bin, uint8_t Hour, uint16_t Rssi, bool Busy)
+{
+    uint8_t *pHourSamples = &gOccSurvey.HourSamples[Hour][Bin];
+    uint8_t *pHourAbove = &gOccSurvey.HourAbove[Hour][Bin];
+
+    if (Rssi > gOccSurvey.Peak[Bin])
+        gOccSurvey.Peak[Bin] = Rssi;
+
+    gOccSurvey.Samples[Bin]++;
+    if (Busy)
+        gOccSurvey.Above[Bin]++;
+
+    if (gOccSurvey.Samples[Bin] >= OCC_SAMPLES_MAX) {
+        gOccSurvey.Samples[Bin] >>= 1;
+        gOccSurvey.Above[Bin] >>= 1;
+        gOccSurvey.Peak[Bin] = gOccSurvey.Peak[Bin] > OCC_PEAK_DECAY ? gOccSurvey.Peak[Bin] - OCC_PEAK_DECAY : 0;
+    }
+
+    (*pHourSamples)++;
+    if (Busy)
+        (*pHourAbove)++;
+
+    if (*pHourSamples >= OCC_HOUR_SAMPLES_MAX) {
+        *pHourSamples >>= 1;
+        *pHourAbove >>= 1;
+    }
+}
+
+void OCC_Reset(void)
+{
+    memset(&gOccSurvey, 0, sizeof(gOccSurvey));
+}
+
+void OCC_SetGrid(uint32_t FStart, uint32_t Span, uint16_t Bins)
+{
+    if (Bins > OCC_BINS)
+        Bins = OCC_BINS;
+
+    if (gOccSurvey.FStart == FStart && gOccSurvey.Span == Span && gOccSurvey.Bins == Bins)
+        return;
+
+    OCC_Reset();
+    gOccSurvey.FStart = FStart;
+    gOccSurvey.Span = Span;
+    gOccSurvey.Bins = Bins;
+}
+
+uint8_t OCC_GetHour(void)
+{
+    return (uint8_t)((RTC_Seconds() / 3600U) % OCC_HOURS);
+}
+
+void OCC_AccumulateSweep(const uint16_t *pRssi, uint16_t Bins, uint16_t Floor)
+{
+    const uint8_t hour = OCC_GetHour();
+    const uint32_t threshold = (uint32_t)Floor + OCC_FLOOR_MARGIN;
+
+    if (Bins > gOccSurvey.Bins)
+        Bins = gOccSurvey.Bins;
+
+    for (uint8_t i = 0; i < Bins; i++) {
+        const uint16_t rssi = pRssi[i];
+
+        if (rssi == OCC_RSSI_UNMEASURED || rssi == OCC_RSSI_BLACKLISTED)
+            continue;
+
+        OCC_Sample(i, hour, rssi, rssi >= threshold);
+    }
+}
+
+void OCC_AccumulateChannel(uint32_t Frequency, uint16_t Rssi, bool Busy)
+{
+    if (gOccSurvey.Bins == 0 || gOccSurvey.Span == 0)
+        return;
+    if (Frequency < gOccSurvey.FStart || Frequency - gOccSurvey.FStart >= gOccSurvey.Span)
+        return;
+
+    const uint8_t bin = (uint8_t)((uint64_t)(Frequency - gOccSurvey.FStart) * gOccSurvey.Bins / gOccSurvey.Span);
+
+    OCC_Sample(bin, OCC_GetHour(), Rssi, Busy);
+}
+
+uint16_t OCC_GetPermille(uint8_t Bin)
+{
+    if (Bin >= OCC_BINS || gOccSurvey.Samples[Bin] == 0)
+        return 0;
+
+    return (uint16_t)((uint32_t)gOccSurvey.Above[Bin] * 1000U / gOccSurvey.Samples[Bin]);
+}
+
+uint8_t OCC_GetHourLevel(uint8_t Hour, uint8_t Bin)
+{
+    if (Hour >= OCC_HOURS || Bin >= OCC_BINS || gOccSurvey.HourSamples[Hour][Bin] == 0)
+        return 0;
+
+    return (uint8_t)((uint16_t)gOccSurvey.HourAbove[Hour][Bin] * 255U / gOccSurvey.HourSamples[Hour][Bin]);
+}
+
+#endif
@@ -0,0 +1,74 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_OCCUPANCY_H
+#define APP_OCCUPANCY_H
+
+#ifdef ENABLE_BAND_OCCUPANCY
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Band occupancy survey: every completed spectrum sweep (and every channel the
+// scanner leaves) adds one sample per bin.  A bin is "busy" when its RSSI is at
+// least OCC_FLOOR_MARGIN above the sweep's noise floor.  Counters are small
+// fixed-point integers that are halved when they saturate, so old history
+// decays instead of overflowing.
+#define OCC_BINS             128U
+#define OCC_HOURS            24U
+#define OCC_FLOOR_MARGIN     20U      // raw RSSI units, 0.5dB each -> 10dB
+#define OCC_SAMPLES_MAX      0x8000U  // per-bin total, halved on reaching it
+#define OCC_HOUR_SAMPLES_MAX 0xFFU    // per-bin per-hour, halved on reaching it
+#define OCC_PEAK_DECAY       12U      // peak drops 6dB on every total halving
+
+typedef struct {
+    uint32_t FStart;     // 10Hz units
+    uint32_t Span;       // 10Hz units
+    uint16_t Bins;       // 0 = no grid yet
+    uint16_t Samples[OCC_BINS];
+    uint16_t Above[OCC_BINS];
+    uint16_t Peak[OCC_BINS];                  // raw BK4819 RSSI
+    uint8_t  HourSamples[OCC_HOURS][OCC_BINS];
+    uint8_t  HourAbove[OCC_HOURS][OCC_BINS];
+} OCC_Survey_t;
+
+extern OCC_Survey_t gOccSurvey;
+
+void     OCC_Reset(void);
+
+// Keeps the collected data while the grid is unchanged, resets it otherwise.
+void     OCC_SetGrid(uint32_t FStart, uint32_t Span, uint16_t Bins);
+
+// Hot-path hooks: O(bins) / O(1), RAM only.  Rssi 0 (not measured) and
+// 0xFFFF (blacklisted) are skipped.
+void     OCC_AccumulateSweep(const uint16_t *pRssi, uint16_t Bins, uint16_t Floor);
+void     OCC_AccumulateChannel(uint32_t Frequency, uint16_t Rssi, bool Busy);
+
+uint8_t  OCC_GetHour(void);
+uint16_t OCC_GetPermille(uint8_t Bin);                 // time above floor, 0..1000
+uint8_t  OCC_GetHourLevel(uint8_t Hour, uint8_t Bin);  // 0..255
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
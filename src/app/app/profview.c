@@ -0,0 +1,114 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifdef ENABLE_PROFILER
+
+#include <stdio.h>
+#include <string.h>
+
+#include "app/profview.h"
+#include "app/radiotask.h"
+#include "../driver/keyboard.h"
+#include "../driver/st7565.h"
+#include "../helper/keys.h"
+#include "../helper/profiler.h"
+#include "../misc.h"
+#include "../ui/helper.h"
+
+#define PROFVIEW_ROWS_PER_PAGE  3U
+#define PROFVIEW_REFRESH_MS     500U
+// 占比封顶 999.9%，小字体一行 18 个字符放得下
+#define PROFVIEW_MAX_PERMILLE   9999U
+
+static void Render(uint8_t Top, const PROFILER_Report_t *pReport, uint8_t Count)
+{
+    const uint32_t elapsedMs = PROFILER_ElapsedMs();
+    char           String[32];   // 3x5 字体一整行 31 个字符
+    char           Detail[40];   // 三个 32 位数的最坏长度，显示前截到 31 个
+
+    memset(gStatusLine, 0, sizeof(gStatusLine));
+    UI_DisplayClear();
+
+    snprintf(String, sizeof(String), "PROF %u/%u", Count ? Top + 1U : 0U, Count);
+    GUI_DisplaySmallest(String, 0, 1, true, true);
+    snprintf(String, sizeof(String), "%lus", (unsigned long)(elapsedMs / 1000U));
+    GUI_DisplaySmallest(String, 96, 1, true, true);
+
+    for (uint8_t row = 0; row < PROFVIEW_ROWS_PER_PAGE && Top + row < Count; row++) {
+        const PROFILER_Report_t *p = &pReport[Top + row];
+        const uint8_t line = (uint8_t)(row * 2U);
+        // µs / ms 即千分比；区段含嵌套调用，两个核的区段加起来可以超过 100%
+        uint32_t permille = elapsedMs ? p->TotalUs / elapsedMs : 0U;
+
+        if (permille > PROFVIEW_MAX_PERMILLE)
+            permille = PROFVIEW_MAX_PERMILLE;
+
+        // 名字 11 + 占比 6，共 17 个字符
+        snprintf(String, sizeof(String), "%-11.11s%3lu.%lu%%", PROFILER_ZoneName(p->Zone),
+                 (unsigned long)(permille / 10U), (unsigned long)(permille % 10U));
+        UI_PrintStringSmall(String, 0, 0, line);
+
+        // 从 x=4 起 3x5 字体能放 31 个字符，极端大的数会被截掉
+        snprintf(Detail, sizeof(Detail), "N%lu A%luus M%luus",
+                 (unsigned long)p->Calls,
+                 (unsigned long)(p->Calls ? p->TotalUs / p->Calls : 0U),
+                 (unsigned long)p->MaxUs);
+        Detail[sizeof(String) - 1U] = '\0';
+        GUI_DisplaySmallest(Detail, 4, (uint8_t)(line * 8U + 9U), false, true);
+    }
+
+    ST7565_BlitStatusLine();
+    ST7565_BlitFullScreen();
+}
+
+void PROFVIEW_Browse(void)
+{
+    PROFILER_Report_t report[PROFILER_ZONE_COUNT];
+    KEYS_Event_t      event;
+    uint8_t           top   = 0;
+    uint8_t           count = 0;
+
+    // Events are ours until we return, so the main UI never sees the EXIT.
+    while (1) {
+        count = PROFILER_Top(report, PROFILER_ZONE_COUNT);
+        if (top >= count)
+            top = count ? count - 1U : 0U;
+        Render(top, report, count);
+
+        // 按键处理持有电台锁；等待期间放开，让电台任务照常跑，读数才有意义
+        RADIOTASK_Unlock();
+        const bool pressed = KEYS_Wait(&event, PROFVIEW_REFRESH_MS);
+        RADIOTASK_Lock();
+
+        if (!pressed || (event.Action != KEYS_PRESS && event.Action != KEYS_REPEAT))
+            continue;
+        if (event.Key == KEY_EXIT)
+            break;
+        if (event.Key == KEY_UP && top > 0)
+            top--;
+        if (event.Key == KEY_DOWN && top + 1U < count)
+            top++;
+        if (event.Key == KEY_MENU && event.Action == KEYS_PRESS) {
+            PROFILER_Reset();
+            top = 0;
+        }
+    }
+
+    gUpdateStatus  = true;
+    gUpdateDisplay = true;
+}
+
+#endif
@@ -0,0 +1,36 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_PROFVIEW_H
+#define APP_PROFVIEW_H
+
+#ifdef ENABLE_PROFILER
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// F+SIDE2: hidden screen listing the busiest profiler zones
+// (UP/DOWN scroll, MENU clears the counters, EXIT leaves).
+void PROFVIEW_Browse(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
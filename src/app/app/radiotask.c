@@ -0,0 +1,213 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#else
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include "app.h"
+#include "radiotask.h"
+#include "../driver/bk4819.h"
+#include "../functions.h"
+#include "../helper/timerwheel.h"
+#include "../misc.h"
+#include "../radio.h"
+#include "../scheduler.h"
+
+// 调用者持有电台锁（或电台任务没运行），芯片读数和电台状态来自同一时刻
+static void RADIOTASK_Sample(RADIOTASK_Snapshot_t *pSnapshot)
+{
+    pSnapshot->Frequency = gRxVfo->pRX->Frequency;
+    pSnapshot->Rssi = BK4819_GetRSSI();
+    pSnapshot->AfLevel = BK4819_GetVoiceAmplitudeOut();
+    pSnapshot->Noise = BK4819_GetExNoiceIndicator();
+    pSnapshot->Glitch = BK4819_GetGlitchIndicator();
+    pSnapshot->Band = (uint8_t)gRxVfo->Band;
+    pSnapshot->Function = (uint8_t)gCurrentFunction;
+    pSnapshot->SquelchOpen = g_SquelchLost;
+}
+
+#ifndef ENABLE_OPENCV
+// 高于 i2c_bus(5) 和 Arduboy(3)，低于时间轮任务(10)
+#define RADIOTASK_PRIORITY 6
+#define RADIOTASK_CORE     0
+// 每 5 个节拍采样一次读数，界面最快 150ms 刷一次表头
+#define RADIOTASK_SNAPSHOT_TICKS 5U
+
+static TaskHandle_t      gRadioTask;
+static SemaphoreHandle_t gRadioLock;
+static StaticSemaphore_t gRadioLockBuffer;
+
+// 时间轮送来、还没推进倒计时的节拍数；任务等锁时也不丢
+static uint32_t             gPendingTicks;
+
+static RADIOTASK_Snapshot_t gSnapshot;
+// 顺序锁：只有电台任务写，奇数表示正在写
+static uint32_t             gSnapshotSeq;
+
+static void RADIOTASK_Publish(void)
+{
+    RADIOTASK_Snapshot_t snapshot;
+
+    // 先读芯片（约 300us），写窗口里只剩拷贝
+    RADIOTASK_Sample(&snapshot);
+
+    const uint32_t seq = gSnapshotSeq;
+    __atomic_store_n(&gSnapshotSeq, seq + 1U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    gSnapshot = snapshot;
+    __atomic_store_n(&gSnapshotSeq, seq + 2U, __ATOMIC_RELEASE);
+}
+
+static void RADIOTASK_Tick(void *pArg)
+{
+    (void)pArg;
+    __atomic_fetch_add(&gPendingTicks, 1U, __ATOMIC_RELAXED);
+    xTaskNotify(gRadioTask, SCHEDULER_EVENT_TICK, eSetBits);
+}
+
+// BK4819 中断线（BK4819_PIN_IRQ）的边沿中断
+static void IRAM_ATTR RADIOTASK_Irq(void *pArg)
+{
+    BaseType_t woken = pdFALSE;
+
+    (void)pArg;
+    xTaskNotifyFromISR(gRadioTask, SCHEDULER_EVENT_RADIO, eSetBits, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+static TIMERWHEEL_Timer_t gRadioTimer = TIMERWHEEL_TIMER(RADIOTASK_Tick, NULL);
+
+static void RADIOTASK_Task(void *pArg)
+{
+    uint8_t ticks = 0;
+
+    (void)pArg;
+    for (;;) {
+        uint32_t events = 0;
+
+        // 迟到的节拍合并成一次时间片（和原来的 gNextTimeslice 标志一样），倒计时仍按节拍数推进
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+        RADIOTASK_Lock();
+        for (uint32_t n = __atomic_exchange_n(&gPendingTicks, 0U, __ATOMIC_RELAXED); n > 0; n--)
+            SCHEDULER_RadioSystick();
+        if (events & SCHEDULER_EVENT_TICK)
+            APP_RadioTimeSlice10ms();
+        else
+            APP_RadioInterrupts();
+        APP_Update();
+
+        // 持锁采样：主循环改频率或切功能时不会夹在读芯片和读状态之间
+        if ((events & SCHEDULER_EVENT_TICK) && ++ticks >= RADIOTASK_SNAPSHOT_TICKS) {
+            ticks = 0;
+            if (gCurrentFunction != FUNCTION_POWER_SAVE)
+                RADIOTASK_Publish();
+        }
+        RADIOTASK_Unlock();
+    }
+}
+
+void RADIOTASK_Start(void)
+{
+    if (gRadioTask)
+        return;
+
+    gRadioLock = xSemaphoreCreateMutexStatic(&gRadioLockBuffer);
+    RADIOTASK_Sample(&gSnapshot);
+
+    if (xTaskCreatePinnedToCore(RADIOTASK_Task, "radio", 8192, NULL, RADIOTASK_PRIORITY, &gRadioTask,
+                                RADIOTASK_CORE) != pdPASS) {
+        // 建不了任务就留在主循环里跑，主循环每个时间片照旧轮询 BK4819 中断，不接中断线
+        gRadioTask = NULL;
+        return;
+    }
+    TIMERWHEEL_Start(&gRadioTimer, SCHEDULER_SYSTICK_MS, SCHEDULER_SYSTICK_MS);
+    BK4819_AttachIrq(RADIOTASK_Irq, NULL);
+}
+
+bool RADIOTASK_IsRunning(void)
+{
+    return gRadioTask != NULL;
+}
+
+bool RADIOTASK_IsCurrent(void)
+{
+    return gRadioTask != NULL && xTaskGetCurrentTaskHandle() == gRadioTask;
+}
+
+void RADIOTASK_Lock(void)
+{
+    if (gRadioTask)
+        xSemaphoreTake(gRadioLock, portMAX_DELAY);
+}
+
+void RADIOTASK_Unlock(void)
+{
+    if (gRadioTask)
+        xSemaphoreGive(gRadioLock);
+}
+
+void RADIOTASK_ReadSnapshot(RADIOTASK_Snapshot_t *pSnapshot)
+{
+    uint32_t seq;
+
+    if (gRadioTask == NULL) {
+        RADIOTASK_Sample(pSnapshot);
+        return;
+    }
+
+    do {
+        seq = __atomic_load_n(&gSnapshotSeq, __ATOMIC_ACQUIRE);
+        *pSnapshot = gSnapshot;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((seq & 1U) || seq != __atomic_load_n(&gSnapshotSeq, __ATOMIC_RELAXED));
+}
+#else
+// 模拟器是单线程的，主循环照旧依次执行
+void RADIOTASK_Start(void)
+{
+}
+
+bool RADIOTASK_IsRunning(void)
+{
+    return false;
+}
+
+bool RADIOTASK_IsCurrent(void)
+{
+    return false;
+}
+
+void RADIOTASK_Lock(void)
+{
+}
+
+void RADIOTASK_Unlock(void)
+{
+}
+
+void RADIOTASK_ReadSnapshot(RADIOTASK_Snapshot_t *pSnapshot)
+{
+    RADIOTASK_Sample(pSnapshot);
+}
+#endif
@@ -0,0 +1,68 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_RADIOTASK_H
+#define APP_RADIOTASK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// BK4819 控制、静噪和扫描在核 0 上的独立任务里每个节拍（SCHEDULER_SYSTICK_MS）跑一次
+// （APP_RadioTimeSlice10ms + APP_Update），主循环（核 1）只管按键、CPS 和画屏。
+// 电台状态仍是全局变量，两边用 RADIOTASK_Lock 互斥（电台倒计时也在任务里持锁推进）；画屏不持锁，
+// 电台任务里的 GUI_DisplayScreen/UI_DisplayStatus 只置标志留给主循环画。
+// 任务没起来（模拟器或创建失败）时以上都是空操作，主循环照旧串行执行。
+// 接了 BK4819 中断线时，中断到来会立刻唤醒任务处理，不等下一个节拍。
+
+// 界面显示的读数，由电台任务持锁定期采样发布，读者不碰 BK4819。
+// 字段彼此一致：读数和采样时的接收频率、波段、功能、静噪状态是同一时刻的。
+// 不在快照里的状态（亚音解码结果、VFO 设置等）读者仍直接读全局变量，
+// 可能与快照差一个发布周期；gCurrentFunction 这类单字节读不会撕裂，需要
+// 当前值的画屏判断（如状态栏的收发图标）继续读全局变量，快照最多滞后 150ms，
+// 省电时也不发布。
+typedef struct {
+    uint32_t Frequency;  // gRxVfo->pRX->Frequency，10Hz
+    uint16_t Rssi;       // REG_67 <8:0>
+    uint16_t AfLevel;    // REG_64
+    uint8_t  Noise;      // REG_65 <6:0>
+    uint8_t  Glitch;     // REG_63 <7:0>
+    uint8_t  Band;       // gRxVfo->Band，RSSI 的 dBm 修正按它查表
+    uint8_t  Function;   // gCurrentFunction
+    bool     SquelchOpen; // g_SquelchLost
+} RADIOTASK_Snapshot_t;
+
+// 在 loop() 进入主循环前调用一次
+void RADIOTASK_Start(void);
+bool RADIOTASK_IsRunning(void);
+// 当前代码是否在电台任务里执行
+bool RADIOTASK_IsCurrent(void);
+
+// 不可重入；持锁期间不要等电台任务
+void RADIOTASK_Lock(void);
+void RADIOTASK_Unlock(void);
+
+// 取最近一次发布的读数；任务没运行时直接读芯片
+void RADIOTASK_ReadSnapshot(RADIOTASK_Snapshot_t *pSnapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,14 @@
  *     limitations under the License.
  */
 
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#else
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include <string.h>
+
 #include "app/app.h"
 #include "app/dtmf.h"
 #include "app/generic.h"
@@ -41,9 +49,102 @@ SCAN_CssState_t gScanCssState;
 uint8_t gScanProgressIndicator;
 bool gScanUseCssResult;
 
+uint16_t gScanCssDetectMs;
+
+// Per-code time-to-detect, read out over CPS 0x0670
+static uint16_t gScanCtcssDetectMs[ARRAY_SIZE(CTCSS_Options)];
+static uint16_t gScanDcsDetectMs[ARRAY_SIZE(DCS_Options)];
+
 STEP_Setting_t stepSetting;
 uint8_t scanHitCount;
 
+// Tone scan confidence: a code is accepted once the detector returned it this
+// many times in a row.  DCS words are Golay-checked, so one hit is exact.
+// CTCSS readings are matched to the nearest table tone; a misread has to hit
+// the same wrong neighbour twice, 100 ms apart, to be accepted with K = 2.
+#define SCAN_CSS_CONFIRM_CTCSS 2
+#define SCAN_CSS_CONFIRM_DCS   1
+
+static uint16_t scanCssCandidate;
+static uint32_t scanCssStartMs;
+
+static void SCANNER_CssStart(void) {
+    gScanCssResultCode = 0xFF;
+#ifdef TEST_UNDE_CTCSS
+    gScanCssResultCode_all = 0xffff;
+#endif
+    gScanCssResultType = 0xFF;
+    scanCssCandidate = 0xFFFF;
+    scanHitCount = 0;
+    gScanUseCssResult = false;
+    gScanCssDetectMs = 0;
+    scanCssStartMs = millis();
+}
+
+static void SCANNER_CssLogDetect(DCS_CodeType_t Type, uint16_t Code) {
+    const uint32_t elapsed = millis() - scanCssStartMs;
+
+    gScanCssDetectMs = elapsed > 0xFFFF ? 0xFFFF : (uint16_t) elapsed;
+    // 0 means "never" in the tables
+    const uint16_t ms = gScanCssDetectMs ? gScanCssDetectMs : 1;
+
+    if (Type == CODE_TYPE_DIGITAL) {
+        if (Code < ARRAY_SIZE(gScanDcsDetectMs))
+            gScanDcsDetectMs[Code] = ms;
+    }
+#ifndef TEST_UNDE_CTCSS
+    // TEST_UNDE_CTCSS codes index a finer table than CTCSS_Options
+    else if (Code < ARRAY_SIZE(gScanCtcssDetectMs)) {
+        gScanCtcssDetectMs[Code] = ms;
+    }
+#endif
+}
+
+uint8_t SCANNER_GetDetectTimes(DCS_CodeType_t Type, uint16_t *pMs, uint8_t Max) {
+    const uint16_t *pTable = gScanCtcssDetectMs;
+    uint8_t Count = ARRAY_SIZE(gScanCtcssDetectMs);
+
+    if (Type == CODE_TYPE_DIGITAL) {
+        pTable = gScanDcsDetectMs;
+        Count = ARRAY_SIZE(gScanDcsDetectMs);
+    }
+    if (Count > Max)
+        Count = Max;
+    memcpy(pMs, pTable, Count * sizeof(uint16_t));
+    return Count;
+}
+
+void SCANNER_ClearDetectTimes(void) {
+    memset(gScanCtcssDetectMs, 0, sizeof(gScanCtcssDetectMs));
+    memset(gScanDcsDetectMs, 0, sizeof(gScanDcsDetectMs));
+}
+
+static void SCANNER_CssSample(DCS_CodeType_t Type, uint16_t Code, uint8_t Needed) {
+    if (Type == gScanCssResultType && Code == scanCssCandidate) {
+        if (scanHitCount < 0xFF)
+            scanHitCount++;
+    } else {
+        scanHitCount = 1;
+    }
+
+    scanCssCandidate = Code;
+    gScanCssResultType = Type;
+#ifdef TEST_UNDE_CTCSS
+    if (Type == CODE_TYPE_CONTINUOUS_TONE)
+        gScanCssResultCode_all = Code;
+    else
+#endif
+        gScanCssResultCode = (uint8_t) Code;
+
+    if (scanHitCount < Needed)
+        return;
+
+    gScanCssState = SCAN_CSS_STATE_FOUND;
+    gScanUseCssResult = true;
+    gUpdateStatus = true;
+    SCANNER_CssLogDetect(Type, Code);
+}
+
 
 static void SCANNER_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
     if (!bKeyHeld && bKeyPressed) {
@@ -337,15 +438,7 @@ void SCANNER_Start(bool singleFreq) {
     DTMF_clear_RX();
 #endif
     gScanDelay_10ms = scan_delay_10ms;
-    gScanCssResultCode = 0xFF;
-#ifdef TEST_UNDE_CTCSS
-
-    gScanCssResultCode_all=0xffff;
-#endif
-
-    gScanCssResultType = 0xFF;
-    scanHitCount = 0;
-    gScanUseCssResult = false;
+    SCANNER_CssStart();
     g_CxCSS_TAIL_Found = false;
     g_CDCSS_Lost = false;
     gCDCSSCodeType = 0;
@@ -409,14 +502,7 @@ void SCANNER_TimeSlice10ms(void) {
                 BK4819_EnableFrequencyScan();
             } else {
                 BK4819_SetScanFrequency(gScanFrequency);
-                gScanCssResultCode = 0xFF;
-#ifdef TEST_UNDE_CTCSS
-
-                gScanCssResultCode_all=0xffff;
-#endif
-                gScanCssResultType = 0xFF;
-                scanHitCount = 0;
-                gScanUseCssResult = false;
+                SCANNER_CssStart();
                 gScanProgressIndicator = 0;
                 gScanCssState = SCAN_CSS_STATE_SCANNING;
 
@@ -441,43 +527,17 @@ void SCANNER_TimeSlice10ms(void) {
 
             if (scanResult == BK4819_CSS_RESULT_CDCSS) {
                 const uint8_t Code = DCS_GetCdcssCode(cdcssFreq);
-                if (Code != 0xFF) {
-                    gScanCssResultCode = Code;
-                    gScanCssResultType = CODE_TYPE_DIGITAL;
-                    gScanCssState = SCAN_CSS_STATE_FOUND;
-                    gScanUseCssResult = true;
-                    gUpdateStatus = true;
-                }
+                if (Code != 0xFF)
+                    SCANNER_CssSample(CODE_TYPE_DIGITAL, Code, SCAN_CSS_CONFIRM_DCS);
             } else if (scanResult == BK4819_CSS_RESULT_CTCSS) {
 #ifdef TEST_UNDE_CTCSS
                 const uint16_t Code = DCS_GetCtcssCode_ALL(ctcssFreq);
+                if (Code != 0xFFFF)
 #else
                 const uint8_t Code = DCS_GetCtcssCode(ctcssFreq);
+                if (Code != 0xFF)
 #endif
-#ifdef TEST_UNDE_CTCSS
-                if (Code != 0xFFFF) {
-                                        if (Code == gScanCssResultCode_all && gScanCssResultType == CODE_TYPE_CONTINUOUS_TONE) {
-
-#else
-                if (Code != 0xFF) {
-                    if (Code == gScanCssResultCode && gScanCssResultType == CODE_TYPE_CONTINUOUS_TONE) {
-
-#endif
-                        if (++scanHitCount >= 2) {
-                            gScanCssState = SCAN_CSS_STATE_FOUND;
-                            gScanUseCssResult = true;
-                            gUpdateStatus = true;
-                        }
-                    } else
-                        scanHitCount = 0;
-
-                    gScanCssResultType = CODE_TYPE_CONTINUOUS_TONE;
-#ifdef TEST_UNDE_CTCSS
-                    gScanCssResultCode_all = Code;
-#else
-                    gScanCssResultCode = Code;
-#endif
-                }
+                    SCANNER_CssSample(CODE_TYPE_CONTINUOUS_TONE, Code, SCAN_CSS_CONFIRM_CTCSS);
             }
 //            else if (scanResult == BK4819_CSS_RESULT_CTCSS) {
 //                const uint8_t Code = DCS_GetCtcssCode(ctcssFreq);
@@ -498,7 +558,9 @@ void SCANNER_TimeSlice10ms(void) {
 //            }
             if (gScanCssState < SCAN_CSS_STATE_FOUND) { // scanning or off
                 BK4819_SetScanFrequency(gScanFrequency);
-                gScanDelay_10ms = scan_delay_10ms;
+                // Same frequency: while a candidate is being confirmed only the
+                // detector needs re-arming, not the full settle delay.
+                gScanDelay_10ms = scanHitCount ? scan_css_confirm_delay_10ms : scan_delay_10ms;
                 break;
             }
 
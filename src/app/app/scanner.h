@@ -38,6 +38,9 @@ extern DCS_CodeType_t gScanCssResultType;
 extern uint8_t gScanCssResultCode;
 extern uint16_t gScanCssResultCode_all;
 
+// Time from the start of the tone scan to an accepted code, in ms.
+extern uint16_t gScanCssDetectMs;
+
 extern bool gScanSingleFrequency;
 extern SCAN_SaveState_t gScannerSaveState;
 extern uint8_t gScanChannel;
@@ -58,5 +61,11 @@ void SCANNER_TimeSlice500ms(void);
 
 bool SCANNER_IsScanning(void);
 
+// Last time-to-detect of every code of one type (CODE_TYPE_CONTINUOUS_TONE
+// or CODE_TYPE_DIGITAL), indexed like CTCSS_Options / DCS_Options, in ms;
+// 0 = not detected since boot or the last clear.  Returns the table length.
+uint8_t SCANNER_GetDetectTimes(DCS_CodeType_t Type, uint16_t *pMs, uint8_t Max);
+void SCANNER_ClearDetectTimes(void);
+
 #endif
 
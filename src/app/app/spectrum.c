@@ -33,12 +33,38 @@
 
 #include "driver/eeprom.h"
 
+#ifdef ENABLE_ACTIVITY_LOG
+#include "app/actlog.h"
+#endif
+
+#ifdef ENABLE_BAND_OCCUPANCY
+#include "app/occupancy.h"
+#include "bsp/dp32g030/rtc.h"
+#endif
+
+#ifdef ENABLE_TELEMETRY
+#include "app/telemetry.h"
+#endif
+
 #include "driver/backlight.h"
 #include "frequencies.h"
+#include "helper/profiler.h"
+#include "helper/trace.h"
 #include "ui/helper.h"
 #include "ui/main.h"
 
 void ToggleRX(bool on);
+
+#ifdef ENABLE_BAND_OCCUPANCY
+enum {
+    OCC_VIEW_OFF = 0,
+    OCC_VIEW_HEATMAP,
+    OCC_VIEW_BARS,
+    OCC_VIEW_NUM
+};
+
+static uint8_t occView;
+#endif
 
 struct FrequencyBandInfo {
     uint32_t lower;
@@ -358,6 +384,7 @@ static void ToggleAFDAC(bool on) {
 
 void SetF(uint32_t f) {
     fMeasure = f;
+    TRACE(SCAN_HOP, TRACE_HOP_SPECTRUM, f);
 
     BK4819_SetFrequency(fMeasure);
     BK4819_PickRXFilterPathBasedOnFrequency(fMeasure);
@@ -417,6 +444,7 @@ static uint8_t GetBWRegValueForScan() {
 }
 
 static uint16_t GetRssi() {
+    PROFILER_ZONE(SPECTRUM_RSSI);
     // SYSTICK_DelayUs(800);
     // testing autodelay based on Glitch value
     while ((BK4819_ReadRegister(0x63) & 0b11111111) >= 255) {
@@ -1012,6 +1040,10 @@ static void OnKeyDown(uint8_t key) {
             TuneToPeak();
             break;
         case KEY_MENU:
+#ifdef ENABLE_BAND_OCCUPANCY
+            occView = (occView + 1) % OCC_VIEW_NUM;
+            redrawScreen = true;
+#endif
             break;
         case KEY_EXIT:
             if (menuState) {
@@ -1197,9 +1229,83 @@ static void RenderStatus() {
     ST7565_BlitStatusLine();
 }
 
+#ifdef ENABLE_BAND_OCCUPANCY
+// 4x4 ordered dither thresholds for 0..255 occupancy levels
+static const uint8_t occDither[4][4] = {
+        {8,   136, 40,  168},
+        {200, 72,  232, 104},
+        {56,  184, 24,  152},
+        {248, 120, 216, 88},
+};
+
+static uint8_t OccBinAtX(uint8_t x) {
+    return (uint16_t)x * gOccSurvey.Bins / 128u;
+}
+
+static void DrawOccupancyInfo(uint8_t x, uint8_t y) {
+    const uint8_t bin = OccBinAtX(128u * peak.i / GetStepsCount());
+    const uint16_t permille = OCC_GetPermille(bin);
+
+    sprintf(String, "%u.%05u %u.%u%% %d", peak.f / 100000, peak.f % 100000,
+            permille / 10, permille % 10,
+            gOccSurvey.Samples[bin] ? Rssi2DBm(gOccSurvey.Peak[bin]) : 0);
+    GUI_DisplaySmallest(String, x, y, false, true);
+}
+
+// One 2px row per hour of day (00h on top), one column per bin.
+static void DrawOccupancyHeatmap() {
+    for (uint8_t hour = 0; hour < OCC_HOURS; ++hour) {
+        uint8_t level = 0;
+        uint8_t lastBin = 0xFF;
+        for (uint8_t x = 0; x < 128; ++x) {
+            const uint8_t bin = OccBinAtX(x);
+            if (bin != lastBin) {
+                level = OCC_GetHourLevel(hour, bin);
+                lastBin = bin;
+            }
+            for (uint8_t y = hour * 2; y < hour * 2 + 2; ++y) {
+                if (level > occDither[y & 3][x & 3])
+                    PutPixel(x, y, true);
+            }
+        }
+    }
+
+    sprintf(String, "%02uh", OCC_GetHour());
+    GUI_DisplaySmallest(String, 0, 49, false, true);
+    DrawOccupancyInfo(20, 49);
+}
+
+// Percent-time-above-floor bars with the decayed peak RSSI as a dot.
+static void DrawOccupancyBars() {
+    for (uint8_t x = 0; x < 128; ++x) {
+        const uint8_t bin = OccBinAtX(x);
+        if (!gOccSurvey.Samples[bin])
+            continue;
+        const uint8_t h = OCC_GetPermille(bin) * DrawingEndY / 1000u;
+        if (h)
+            DrawVLine(DrawingEndY - h, DrawingEndY, x, true);
+        PutPixel(x, Rssi2Y(gOccSurvey.Peak[bin]), true);
+    }
+}
+#endif
+
 static void RenderSpectrum() {
+#ifdef ENABLE_BAND_OCCUPANCY
+    if (occView == OCC_VIEW_HEATMAP) {
+        DrawOccupancyHeatmap();
+        return;
+    }
+#endif
     DrawTicks();
     DrawArrow(128u * peak.i / GetStepsCount());
+#ifdef ENABLE_BAND_OCCUPANCY
+    if (occView == OCC_VIEW_BARS) {
+        DrawOccupancyBars();
+        DrawOccupancyInfo(28, 1);
+        DrawNums();
+        return;
+    }
+#endif
     DrawSpectrum();
     DrawRssiTriggerLevel();
     DrawF(peak.f);
@@ -1374,6 +1480,20 @@ static void UpdateScan() {
         memset(&rssiHistory[scanInfo.measurementsCount], 0,
                sizeof(rssiHistory) - scanInfo.measurementsCount * sizeof(rssiHistory[0]));
 
+#ifdef ENABLE_BAND_OCCUPANCY
+    {
+        const uint16_t bins = scanInfo.measurementsCount < 128 ? scanInfo.measurementsCount : 128;
+        OCC_SetGrid(GetFStart(), GetBW(), bins);
+        OCC_AccumulateSweep(rssiHistory, bins, scanInfo.rssiMin);
+    }
+#endif
+#ifdef ENABLE_TELEMETRY
+    {
+        const uint16_t bins = scanInfo.measurementsCount < 128 ? scanInfo.measurementsCount : 128;
+        TELEM_Sweep(GetFStart(), bins ? GetBW() / bins : 0, rssiHistory, bins);
+    }
+#endif
+
     redrawScreen = true;
     preventKeypress = false;
 
@@ -1411,15 +1531,25 @@ void UpdateListening(void) {
     redrawScreen = true;
 
     if (IsPeakOverLevel() || monitorMode) {
+#ifdef ENABLE_ACTIVITY_LOG
+        if (IsPeakOverLevel())
+            ACTLOG_Begin(ACTLOG_SOURCE_SPECTRUM, fMeasure, scanInfo.rssi);
+#endif
         listenT = 1000;
         return;
     }
 
+#ifdef ENABLE_ACTIVITY_LOG
+    ACTLOG_End();
+#endif
     ToggleRX(false);
     ResetScanStats();
 }
 
 static void Tick() {
+#ifdef ENABLE_TELEMETRY
+    TELEM_Poll(true);
+#endif
 #ifdef ENABLE_AM_FIX
     if (gNextTimeslice) {
         gNextTimeslice = false;
@@ -1429,10 +1559,15 @@ static void Tick() {
     }
 #endif
 
-#ifdef ENABLE_SCAN_RANGES
+#if defined(ENABLE_SCAN_RANGES) || defined(ENABLE_ACTIVITY_LOG)
     if (gNextTimeslice_500ms) {
         gNextTimeslice_500ms = false;
 
+#ifdef ENABLE_ACTIVITY_LOG
+        // APP_TimeSlice500ms doesn't run while the spectrum owns the loop
+        ACTLOG_TimeSlice500ms();
+#endif
+#ifdef ENABLE_SCAN_RANGES
         // if a lot of steps then it takes long time
         // we don't want to wait for whole scan
         // listening has it's own timer
@@ -1446,6 +1581,7 @@ static void Tick() {
             redrawScreen = true;
             preventKeypress = false;
         }
+#endif
     }
 #endif
 
@@ -1523,6 +1659,10 @@ static void Tick() {
 
     memset(rssiHistory, 0, sizeof(rssiHistory));
     isInitialized = true;
+#ifdef ENABLE_BAND_OCCUPANCY
+    occView = OCC_VIEW_OFF;
+    RTC_Anchor(); // hour-of-day bins use RTC_Seconds() from here on
+#endif
 #ifdef ENABLE_DOPPLER
     statuslineUpdateTimer = 4097;
 
@@ -1541,6 +1681,9 @@ static void Tick() {
         Tick();
 
     }
+#ifdef ENABLE_ACTIVITY_LOG
+    ACTLOG_End();
+#endif
 
 }
 
@@ -0,0 +1,260 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifdef ENABLE_TELEMETRY
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#else
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include <string.h>
+
+#include "app/radiotask.h"
+#include "app/telemetry.h"
+#include "../driver/bk4819.h"
+#include "../driver/crc.h"
+#include "../driver/uart1.h"
+#include "../functions.h"
+#include "../misc.h"
+#include "../radio.h"
+#include "../scheduler.h"
+
+#define TELEM_HEADER_SIZE   6U
+#define TELEM_MAX_PAYLOAD   (sizeof(TELEM_SweepHeader_t) + 2U + (TELEM_SWEEP_MAX - 1U) * 3U)
+#define TELEM_DEFAULT_INTERVAL 100U
+
+static uint8_t  gTelemMask;
+static uint16_t gTelemIntervalMs = TELEM_DEFAULT_INTERVAL;
+static uint16_t gTelemDropped;
+static uint8_t  gTelemSeq;
+static uint32_t gTelemLastMs;
+static uint32_t gTelemLastSweepMs;
+static uint32_t gTelemLastSweepUs;
+
+static bool     gTelemPassValid;
+static uint32_t gTelemPassStartUs;
+static uint32_t gTelemPasses;
+static uint32_t gTelemPassSumUs;
+static uint32_t gTelemPassMaxUs;
+
+static uint8_t  gTelemFrame[TELEM_HEADER_SIZE + TELEM_MAX_PAYLOAD + 2U];
+
+static void TELEM_Send(uint8_t Type, uint16_t Length)
+{
+    const uint32_t size = TELEM_HEADER_SIZE + Length + 2U;
+
+    gTelemSeq++;
+
+    // Never wait for the UART: a stalled host must not slow the radio down.
+    if (UART_TxFree() < size) {
+        if (gTelemDropped != 0xFFFFU)
+            gTelemDropped++;
+        return;
+    }
+
+    gTelemFrame[0] = TELEM_SYNC0;
+    gTelemFrame[1] = TELEM_SYNC1;
+    gTelemFrame[2] = Type;
+    gTelemFrame[3] = gTelemSeq;
+    gTelemFrame[4] = (uint8_t)Length;
+    gTelemFrame[5] = (uint8_t)(Length >> 8);
+
+    const uint16_t crc = CRC_Calculate(&gTelemFrame[2], 4U + Length);
+    gTelemFrame[TELEM_HEADER_SIZE + Length] = (uint8_t)crc;
+    gTelemFrame[TELEM_HEADER_SIZE + Length + 1U] = (uint8_t)(crc >> 8);
+
+    UART_Send(gTelemFrame, size);
+}
+
+static void TELEM_SendStatus(uint32_t NowMs, bool InSpectrum)
+{
+    TELEM_Status_t status;
+    RADIOTASK_Snapshot_t snapshot;
+
+    // The spectrum owns the chip and stalls the radio task, so read it live.
+    if (InSpectrum) {
+        snapshot.Rssi = BK4819_GetRSSI();
+        snapshot.Noise = BK4819_GetExNoiceIndicator();
+        snapshot.Glitch = BK4819_GetGlitchIndicator();
+        snapshot.AfLevel = BK4819_GetVoiceAmplitudeOut();
+        snapshot.Frequency = gRxVfo->pRX->Frequency;
+        snapshot.Band = (uint8_t)gRxVfo->Band;
+        snapshot.Function = (uint8_t)gCurrentFunction;
+        snapshot.SquelchOpen = g_SquelchLost;
+    } else {
+        RADIOTASK_ReadSnapshot(&snapshot);
+    }
+
+    // Frequency, function and squelch come from the same sample as the
+    // readings; the CTCSS/CDCSS result is read live and may be one
+    // snapshot period newer.
+    status.TimeMs = NowMs;
+    status.Frequency = snapshot.Frequency;
+    status.Rssi = snapshot.Rssi;
+    status.Noise = snapshot.Noise;
+    status.Glitch = snapshot.Glitch;
+    status.AfLevel = snapshot.AfLevel;
+    status.Flags = (snapshot.SquelchOpen ? TELEM_FLAG_SQUELCH_OPEN : 0U)
+                 | (gFoundCTCSS ? TELEM_FLAG_CTCSS_FOUND : 0U)
+                 | (gFoundCDCSS ? TELEM_FLAG_CDCSS_FOUND : 0U)
+                 | (InSpectrum ? TELEM_FLAG_SPECTRUM : 0U);
+    status.Function = snapshot.Function;
+    status.CodeType = RADIO_GetDecodedCode(gFoundCTCSS, gFoundCDCSS, &status.Code);
+    status.Dropped = gTelemDropped;
+
+    memcpy(&gTelemFrame[TELEM_HEADER_SIZE], &status, sizeof(status));
+    TELEM_Send(TELEM_TYPE_STATUS, sizeof(status));
+}
+
+static void TELEM_SendTiming(uint32_t NowMs)
+{
+    TELEM_Timing_t timing;
+
+    timing.TimeMs = NowMs;
+    timing.Passes = gTelemPasses;
+    timing.AvgUs = (uint16_t)(gTelemPasses ? gTelemPassSumUs / gTelemPasses : 0U);
+    timing.MaxUs = (uint16_t)(gTelemPassMaxUs > 0xFFFFU ? 0xFFFFU : gTelemPassMaxUs);
+    timing.IdlePermille = SCHEDULER_IdlePermille();
+    timing.TickJitterUs = SCHEDULER_TickJitterUs();
+
+    gTelemPasses = 0;
+    gTelemPassSumUs = 0;
+    gTelemPassMaxUs = 0;
+
+    memcpy(&gTelemFrame[TELEM_HEADER_SIZE], &timing, sizeof(timing));
+    TELEM_Send(TELEM_TYPE_TIMING, sizeof(timing));
+}
+
+void TELEM_Configure(uint8_t Mask, uint16_t IntervalMs)
+{
+    gTelemMask = Mask & TELEM_MASK_ALL;
+    if (IntervalMs == 0U)
+        IntervalMs = TELEM_DEFAULT_INTERVAL;
+    gTelemIntervalMs = IntervalMs < TELEM_MIN_INTERVAL ? TELEM_MIN_INTERVAL : IntervalMs;
+
+    gTelemDropped = 0;
+    gTelemSeq = 0;
+    gTelemPassValid = false;
+    gTelemPasses = 0;
+    gTelemPassSumUs = 0;
+    gTelemPassMaxUs = 0;
+    SCHEDULER_IdlePermille();
+    SCHEDULER_TickJitterUs();
+    gTelemLastMs = millis();
+    gTelemLastSweepMs = gTelemLastMs - gTelemIntervalMs;
+    gTelemLastSweepUs = micros();
+}
+
+uint8_t TELEM_GetMask(void)
+{
+    return gTelemMask;
+}
+
+uint16_t TELEM_GetInterval(void)
+{
+    return gTelemIntervalMs;
+}
+
+uint16_t TELEM_GetDropped(void)
+{
+    return gTelemDropped;
+}
+
+void TELEM_Poll(bool InSpectrum)
+{
+    if (gTelemMask == 0U)
+        return;
+
+    const uint32_t nowUs = micros();
+    if (gTelemPassValid) {
+        const uint32_t passUs = nowUs - gTelemPassStartUs;
+        gTelemPasses++;
+        gTelemPassSumUs += passUs;
+        if (passUs > gTelemPassMaxUs)
+            gTelemPassMaxUs = passUs;
+    }
+    gTelemPassValid = true;
+    gTelemPassStartUs = nowUs;
+
+    const uint32_t nowMs = millis();
+    if ((uint32_t)(nowMs - gTelemLastMs) < gTelemIntervalMs)
+        return;
+    gTelemLastMs = nowMs;
+
+    if (gTelemMask & TELEM_MASK_STATUS)
+        TELEM_SendStatus(nowMs, InSpectrum);
+    if (gTelemMask & TELEM_MASK_TIMING)
+        TELEM_SendTiming(nowMs);
+
+    // The frames above count as part of this pass, not the next one.
+    gTelemPassStartUs = micros();
+}
+
+void TELEM_Sweep(uint32_t FStart, uint32_t Step, const uint16_t *pRssi, uint16_t Count)
+{
+    const uint32_t nowUs = micros();
+    const uint32_t sweepUs = nowUs - gTelemLastSweepUs;
+
+    gTelemLastSweepUs = nowUs;
+
+    if (!(gTelemMask & TELEM_MASK_SWEEP) || Count == 0U)
+        return;
+
+    const uint32_t nowMs = millis();
+    if ((uint32_t)(nowMs - gTelemLastSweepMs) < gTelemIntervalMs)
+        return;
+    gTelemLastSweepMs = nowMs;
+
+    if (Count > TELEM_SWEEP_MAX)
+        Count = TELEM_SWEEP_MAX;
+
+    TELEM_SweepHeader_t header;
+    header.TimeMs = nowMs;
+    header.FStart = FStart;
+    header.Step = Step;
+    header.SweepUs = sweepUs;
+    header.Count = Count;
+    header.Reserved = 0;
+
+    uint8_t *p = &gTelemFrame[TELEM_HEADER_SIZE];
+    memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+
+    // Neighbouring bins rarely differ by more than a few dB, so most values
+    // take one byte instead of two.
+    uint16_t prev = pRssi[0];
+    *p++ = (uint8_t)prev;
+    *p++ = (uint8_t)(prev >> 8);
+    for (uint16_t i = 1; i < Count; i++) {
+        const uint16_t rssi = pRssi[i];
+        const int32_t delta = (int32_t)rssi - (int32_t)prev;
+
+        if (delta >= -127 && delta <= 127) {
+            *p++ = (uint8_t)(int8_t)delta;
+        } else {
+            *p++ = TELEM_DELTA_ESCAPE;
+            *p++ = (uint8_t)rssi;
+            *p++ = (uint8_t)(rssi >> 8);
+        }
+        prev = rssi;
+    }
+
+    TELEM_Send(TELEM_TYPE_SWEEP, (uint16_t)(p - &gTelemFrame[TELEM_HEADER_SIZE]));
+}
+
+#endif
@@ -0,0 +1,121 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_TELEMETRY_H
+#define APP_TELEMETRY_H
+
+#ifdef ENABLE_TELEMETRY
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Binary telemetry stream on the CPS serial port, enabled by CPS 0x0640.
+// Frames are not obfuscated and use their own sync word so a host can pick
+// them out between CPS replies (AB CD ...) and text logs:
+//
+//   5A A5 | Type | Seq | Len (LE16) | Payload[Len] | CRC16-XMODEM (LE16)
+//
+// The CRC covers Type..Payload.  Seq increments per frame, so the host sees
+// gaps; a frame that does not fit the free UART TX space is dropped (and
+// counted) instead of blocking the caller.
+#define TELEM_SYNC0          0x5AU
+#define TELEM_SYNC1          0xA5U
+#define TELEM_VERSION        1U
+#define TELEM_MIN_INTERVAL   20U     // ms
+#define TELEM_SWEEP_MAX      128U
+
+enum TELEM_Type_t {
+    TELEM_TYPE_STATUS = 1,
+    TELEM_TYPE_SWEEP,
+    TELEM_TYPE_TIMING
+};
+
+enum {
+    TELEM_MASK_STATUS = 1U << 0,
+    TELEM_MASK_SWEEP  = 1U << 1,
+    TELEM_MASK_TIMING = 1U << 2,
+    TELEM_MASK_ALL    = 0x07U
+};
+
+enum {
+    TELEM_FLAG_SQUELCH_OPEN = 1U << 0,
+    TELEM_FLAG_CTCSS_FOUND  = 1U << 1,
+    TELEM_FLAG_CDCSS_FOUND  = 1U << 2,
+    TELEM_FLAG_SPECTRUM     = 1U << 3   // sampled inside the spectrum app
+};
+
+typedef struct {
+    uint32_t TimeMs;
+    uint32_t Frequency;  // 10Hz units, RX VFO
+    uint16_t Rssi;       // raw BK4819 RSSI, 0.5dB units
+    uint8_t  Noise;      // REG_65 ExNoise indicator
+    uint8_t  Glitch;     // REG_63 glitch indicator
+    uint16_t AfLevel;    // REG_64 voice amplitude out
+    uint8_t  Flags;
+    uint8_t  Function;   // FUNCTION_Type_t
+    uint8_t  CodeType;   // DCS_CodeType_t decoded by the BK4819, CODE_TYPE_OFF if none
+    uint8_t  Code;       // CTCSS/DCS table index, 0 if none
+    uint16_t Dropped;    // frames dropped for lack of TX space, saturating
+} TELEM_Status_t;
+
+// Sweep line header; followed by Count RSSI values.  The first is sent as
+// LE16, every next one as an int8 delta from its left neighbour, or as
+// TELEM_DELTA_ESCAPE followed by the LE16 value when the step is too large.
+#define TELEM_DELTA_ESCAPE 0x80U
+
+typedef struct {
+    uint32_t TimeMs;
+    uint32_t FStart;     // 10Hz units
+    uint32_t Step;       // 10Hz units per value
+    uint32_t SweepUs;    // time since the previous completed sweep
+    uint16_t Count;
+    uint16_t Reserved;
+} TELEM_SweepHeader_t;
+
+// Main loop pass times since the previous TIMING frame.
+typedef struct {
+    uint32_t TimeMs;
+    uint32_t Passes;
+    uint16_t AvgUs;
+    uint16_t MaxUs;      // saturates at 0xFFFF
+    uint16_t IdlePermille; // share of time the loop spent waiting for events
+    uint16_t TickJitterUs; // worst 1ms hardware tick deviation
+} TELEM_Timing_t;
+
+void     TELEM_Configure(uint8_t Mask, uint16_t IntervalMs);
+uint8_t  TELEM_GetMask(void);
+uint16_t TELEM_GetInterval(void);
+uint16_t TELEM_GetDropped(void);
+
+// Once per main loop pass (the 10ms time slice and the spectrum Tick).  Does
+// nothing but a compare while the stream is off.
+void     TELEM_Poll(bool InSpectrum);
+
+// Called by the spectrum app when a sweep completes; rate-limited to the
+// configured interval.
+void     TELEM_Sweep(uint32_t FStart, uint32_t Step, const uint16_t *pRssi, uint16_t Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
@@ -38,11 +38,14 @@
 #include "../driver/backlight.h"
 #include "../driver/bk4819.h"
 #include "../driver/crc.h"
+#include "../helper/lz4.h"
 #include "../driver/eeprom.h"
 #include "../driver/uart1.h"
 #include "../driver/adc1.h"
 #include "../driver/pcf8563.h"
 #include "../functions.h"
+#include "../helper/profiler.h"
+#include "../helper/trace.h"
 #include "../misc.h"
 #include "../settings.h"
 
@@ -55,6 +58,17 @@
 #include "../sram-overlay.h"
 #endif
 
+#ifdef ENABLE_ACTIVITY_LOG
+#include "../app/actlog.h"
+#endif
+#ifdef ENABLE_I2C_BUS
+#include "../driver/i2c_bus.h"
+#endif
+#ifdef ENABLE_TELEMETRY
+#include "../app/telemetry.h"
+#endif
+#include "../app/scanner.h"
+
 #include "../version.h"
 
 #if defined(__GNUC__)
@@ -63,9 +77,14 @@
 #define PACKED
 #endif
 
+// Largest data block of the bulk transfer commands (0x0630..0x0639); the
+// command buffer and the receive ring are sized so one such frame fits.
+#define UART_BULK_MAX_DATA   4096U
+#define UART_COMMAND_SIZE    (UART_BULK_MAX_DATA + 64U)
+
 // ESP32 Arduino doesn't use DMA for UART by default
 // Define buffer for serial communication
-static uint8_t UART_DMA_Buffer[256];
+static uint8_t UART_DMA_Buffer[8192] __attribute__((aligned(4)));
 // For ESP32 we emulate the original DMA circular buffer:
 // - `uart_buffer_head` is the current write index (like DMA write pointer)
 // - `gUART_WriteIndex` is the current read/parse index
@@ -204,23 +223,381 @@ typedef struct PACKED {
     } Data;
 } REPLY_0611_t;
 
+#ifdef ENABLE_ACTIVITY_LOG
+#define ACTLOG_CPS_MAX_ENTRIES 14U
+
+typedef struct PACKED {
+    Header_t Header;
+    uint32_t Index;      // 0 = newest entry
+    uint8_t Count;
+    uint8_t Padding[3];
+    uint32_t Timestamp;
+} CMD_0570_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint32_t Total;
+        uint32_t Index;
+        uint8_t Count;
+        uint8_t Padding[3];
+        ACTLOG_Entry_t Entries[ACTLOG_CPS_MAX_ENTRIES];
+    } Data;
+} REPLY_0570_t;
+#endif
+
+#ifdef ENABLE_I2C_BUS
+#define I2CBUS_CPS_MAX_TRACE 16U
+
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Device;      // I2CBUS_Device_t
+    uint8_t Clear;       // 1 = reset stats and trace after the reply
+    uint16_t Rounds;     // benchmark rounds (max I2CBUS_BENCH_MAX_ROUNDS), 0 = stats only
+    uint32_t Timestamp;
+} CMD_0620_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Device;
+        uint8_t Status;  // 0=OK, 1=bad device
+        uint16_t Padding;
+        uint32_t KeypadDeferred;
+        I2CBUS_Stats_t Stats;
+        I2CBUS_Bench_t Bench;
+    } Data;
+} REPLY_0620_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    uint16_t Index;      // 0 = newest transaction
+    uint8_t Count;
+    uint8_t Padding;
+    uint32_t Timestamp;
+} CMD_0622_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint16_t Total;
+        uint16_t Index;
+        uint8_t Count;
+        uint8_t Padding[3];
+        I2CBUS_Trace_t Entries[I2CBUS_CPS_MAX_TRACE];
+    } Data;
+} REPLY_0622_t;
+#endif
+
+#ifdef ENABLE_TELEMETRY
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Mask;        // TELEM_MASK_*, 0 = stop the stream
+    uint8_t Padding;
+    uint16_t IntervalMs; // status/timing period and minimum sweep spacing
+    uint32_t Timestamp;
+} CMD_0640_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Version;
+        uint8_t Mask;
+        uint16_t IntervalMs;
+        uint16_t Dropped;    // frames dropped since the previous 0x0640
+        uint16_t Padding;
+    } Data;
+} REPLY_0640_t;
+#endif
+
+#ifdef ENABLE_PROFILER
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Count;       // zones wanted, busiest first
+    uint8_t Clear;       // 1 = reset the counters after replying
+    uint16_t Padding;
+    uint32_t Timestamp;
+} CMD_0650_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint32_t ElapsedMs;  // since the counters were last cleared
+        uint8_t ZoneCount;   // PROFILER_ZONE_COUNT, Entries[].Zone indexes that enum
+        uint8_t Count;
+        uint16_t Padding;
+        PROFILER_Report_t Entries[PROFILER_ZONE_COUNT];
+    } Data;
+} REPLY_0650_t;
+#endif
+
+#ifdef ENABLE_TRACE
+#define UART_TRACE_MAX_DRAIN 64U
+
+enum {
+    UART_TRACE_FLAG_CLEAR = 1U << 0,   // empty the ring and the drop counter first
+    UART_TRACE_FLAG_BENCH = 1U << 1    // measure the cost of a disabled TRACE()
+};
+
+typedef struct PACKED {
+    Header_t Header;
+    uint32_t Mask;       // 1 << TRACE_Event_t, 0 = stop recording
+    uint8_t Flags;       // UART_TRACE_FLAG_*
+    uint8_t Padding[3];
+    uint32_t Timestamp;
+} CMD_0660_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Version;
+        uint8_t EntrySize;
+        uint16_t Length;
+        uint32_t Mask;
+        uint16_t Pending;
+        uint16_t Padding;
+        uint32_t Dropped;
+        TRACE_Bench_t Bench; // all zero unless UART_TRACE_FLAG_BENCH
+    } Data;
+} REPLY_0660_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Count;       // entries wanted, oldest first
+    uint8_t Padding[3];
+    uint32_t Timestamp;
+} CMD_0662_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint32_t NowUs;      // radio clock when the reply was built
+        uint32_t Dropped;
+        uint16_t Pending;    // still buffered after this reply
+        uint8_t Count;
+        uint8_t Padding;
+        TRACE_Entry_t Entries[UART_TRACE_MAX_DRAIN];
+    } Data;
+} REPLY_0662_t;
+#endif
+
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Type;        // CODE_TYPE_CONTINUOUS_TONE or CODE_TYPE_DIGITAL
+    uint8_t Clear;       // 1 = clear both tables after replying
+    uint16_t Padding;
+    uint32_t Timestamp;
+} CMD_0670_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Type;
+        uint8_t Count;
+        uint16_t Padding;
+        uint16_t DetectMs[ARRAY_SIZE(DCS_Options)];  // indexed like CTCSS_Options / DCS_Options, 0 = not seen
+    } Data;
+} REPLY_0670_t;
+
+// Bulk transfer session.  0x0630 negotiates the block size, 0x0632/0x0634
+// read/write one block of the logical EEPROM or the raw shared partition,
+// each block protected by a CRC-32 over its (uncompressed) data.  EEPROM
+// writes only mark the settings stale: they are reloaded once, by 0x0636 or
+// when the write stream goes idle.
+//
+// Version 2 adds, when the host asks for them in 0x0630 Flags:
+// - LZ4: a block whose Space has UART_BULK_SPACE_LZ4 set carries an LZ4 block
+//   instead of raw bytes; the payload length is implied by Header.Size.  The
+//   radio compresses a read only when that makes it smaller.
+// - HASH: 0x0638 returns the CRC-32 of consecutive blocks, so the host only
+//   transfers the blocks that differ from its local copy.
+#define UART_BULK_VERSION 2U
+#define UART_BULK_MAX_HASHES ((UART_BULK_MAX_DATA / 4U) - 4U)
+
+enum {
+    UART_BULK_SPACE_EEPROM = 0,   // logical EEPROM address space (EEPROM_ReadBulk/WriteBulk)
+    UART_BULK_SPACE_SHARED = 1,   // raw offset into the shared flash partition
+    UART_BULK_SPACE_MASK   = 0x7F,
+    UART_BULK_SPACE_LZ4    = 0x80 // block payload is LZ4-compressed
+};
+
+enum {
+    UART_BULK_FLAG_LZ4  = 1U << 0,
+    UART_BULK_FLAG_HASH = 1U << 1
+};
+
+enum {
+    UART_BULK_OK = 0,
+    UART_BULK_ERR_SESSION,        // no 0x0630 since the last 0x0514
+    UART_BULK_ERR_RANGE,
+    UART_BULK_ERR_CRC,
+    UART_BULK_ERR_IO,
+    UART_BULK_ERR_SPACE,
+    UART_BULK_ERR_FORMAT          // LZ4 payload does not decode to Size bytes
+};
+
+typedef struct PACKED {
+    Header_t Header;
+    uint16_t MaxData;    // largest block the host wants to use
+    uint16_t Flags;      // UART_BULK_FLAG_* the host supports (0 for version 1 hosts)
+    uint32_t Timestamp;
+} CMD_0630_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Version;
+        uint8_t Status;
+        uint16_t MaxData;    // negotiated: min(host, UART_BULK_MAX_DATA)
+        uint32_t EepromSize;
+        uint32_t SharedSize;
+        uint16_t Flags;      // accepted UART_BULK_FLAG_*
+        uint16_t Padding;
+    } Data;
+} REPLY_0630_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Space;
+    uint8_t Padding;
+    uint16_t Size;
+    uint32_t Address;
+    uint32_t Timestamp;
+} CMD_0632_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Space;
+        uint8_t Status;
+        uint16_t Size;
+        uint32_t Address;
+        uint32_t Crc32;
+        uint8_t Data[UART_BULK_MAX_DATA];
+    } Data;
+} REPLY_0632_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Space;
+    uint8_t Padding;
+    uint16_t Size;
+    uint32_t Address;
+    uint32_t Crc32;
+    uint32_t Timestamp;
+    uint8_t Data[];
+} CMD_0634_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Space;
+        uint8_t Status;
+        uint16_t Size;
+        uint32_t Address;
+    } Data;
+} REPLY_0634_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    uint32_t Timestamp;
+} CMD_0636_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Status;
+        uint8_t Reloaded;    // 1 = settings were reloaded
+        uint16_t Padding;
+    } Data;
+} REPLY_0636_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    uint8_t Space;
+    uint8_t Padding;
+    uint16_t Count;      // blocks, <= UART_BULK_MAX_HASHES
+    uint32_t Address;
+    uint32_t BlockSize;
+    uint32_t Timestamp;
+} CMD_0638_t;
+
+typedef struct PACKED {
+    Header_t Header;
+    struct PACKED {
+        uint8_t Space;
+        uint8_t Status;
+        uint16_t Count;
+        uint32_t Address;
+        uint32_t BlockSize;
+        uint32_t Crc32[UART_BULK_MAX_HASHES];
+    } Data;
+} REPLY_0638_t;
+
 static const uint8_t Obfuscation[16] =
         {
                 0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80
         };
 
 static union {
-    uint8_t Buffer[256];
+    uint8_t Buffer[UART_COMMAND_SIZE];
     struct {
         Header_t Header;
-        uint8_t Data[252];
+        uint8_t Data[UART_COMMAND_SIZE - sizeof(Header_t)];
     };
 } UART_Command;
 
+// Frame handed to UART_HandleCommand: decoded in place inside the receive ring,
+// or in UART_Command when it wrapped around the end of the ring.
+static uint8_t *gUartFrame = UART_Command.Buffer;
+
 static uint32_t Timestamp;
 static uint16_t gUART_WriteIndex;
 static bool bIsEncrypted = true;
 
+// CPS 写入后等待写入流空闲这么久，再一次性重载受影响的配置区域。
+#define UART_RELOAD_IDLE_MS 300U
+
+static uint16_t gUartBulkMaxData;          // 0 = no bulk session
+static uint16_t gUartBulkFlags;
+static union {
+    REPLY_0632_t Read;
+    REPLY_0638_t Hash;
+} gUartBulkReply;
+static uint8_t gUartBulkRaw[UART_BULK_MAX_DATA]; // uncompressed side of an LZ4 block
+static uint8_t gUartReloadRegions;         // SETTINGS_REGION_* touched since the last reload
+static uint32_t gUartReloadTouchedMs;
+
+static void UART_MarkWritten(uint32_t Address, uint32_t Size)
+{
+    gUartReloadRegions |= SETTINGS_RegionsForRange(Address, Size);
+    gUartReloadTouchedMs = millis();
+}
+
+static bool UART_ReloadSettings(void)
+{
+    const uint8_t regions = gUartReloadRegions;
+
+    if (regions == 0)
+        return false;
+
+    gUartReloadRegions = 0;
+    SETTINGS_Reload(regions);
+
+    if (regions & (SETTINGS_REGION_CHANNELS | SETTINGS_REGION_ATTRIBUTES | SETTINGS_REGION_GENERAL)) {
+        gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
+        gFlagResetVfos = true;
+    }
+    return true;
+}
+
+// Ends the bulk session and applies whatever its blocks touched.
+static bool UART_BulkFinish(void)
+{
+    gUartBulkMaxData = 0;
+    return UART_ReloadSettings();
+}
+
 #ifndef UART_PROTOCOL_DEBUG
 #define UART_PROTOCOL_DEBUG 0
 #endif
@@ -312,6 +689,7 @@ static bool IsBadChallenge(const uint32_t *pKey, const uint32_t *pIn, const uint
 static void CMD_0514(const uint8_t *pBuffer) {
     const CMD_0514_t *pCmd = (const CMD_0514_t *) pBuffer;
 
+    UART_BulkFinish();
     Timestamp = pCmd->Timestamp;
 
 #ifdef ENABLE_FMRADIO
@@ -390,25 +768,21 @@ static void CMD_051D(const uint8_t *pBuffer) {
 #endif
 
 
+#ifdef ENABLE_BLOCK
     for (unsigned int i = 0; i < (pCmd->Size / 8); i++) {
         const uint16_t Offset = pCmd->Offset + (i * 8U);
-#ifdef ENABLE_BLOCK
 
         if (Offset >= 0x0F30 && Offset < 0x0F40)
             if (!gIsLocked)
-#endif
-
-#ifdef ENABLE_BLOCK
-
-        if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword)
-#endif
-
-        EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U], 8);
-
+                if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword)
+                    EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U], 8);
     }
+#else
+    EEPROM_WriteBulk(pCmd->Offset, pCmd->Data, pCmd->Size & ~7U);
+#endif
 
 
-    SETTINGS_InitEEPROM();
+    UART_MarkWritten(pCmd->Offset, pCmd->Size);
 #ifdef ENABLE_BLOCK
 
     }
@@ -574,6 +948,7 @@ static void CMD_0610(const uint8_t *pBuffer)
             my_time[4] = minute;
             my_time[5] = second;
         }
+        RTC_Anchor();
 #endif
         Reply.Data.Status = 0U;
     } else {
@@ -583,6 +958,269 @@ static void CMD_0610(const uint8_t *pBuffer)
     SendReply(&Reply, sizeof(Reply));
 }
 
+#ifdef ENABLE_ACTIVITY_LOG
+// 0x0570: read activity log entries, newest first
+static void CMD_0570(const uint8_t *pBuffer)
+{
+    const CMD_0570_t *pCmd = (const CMD_0570_t *)pBuffer;
+    REPLY_0570_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    uint8_t count = pCmd->Count;
+    if (count > ACTLOG_CPS_MAX_ENTRIES)
+        count = ACTLOG_CPS_MAX_ENTRIES;
+
+    Reply.Data.Total = ACTLOG_GetCount();
+    Reply.Data.Index = pCmd->Index;
+    memset(Reply.Data.Padding, 0, sizeof(Reply.Data.Padding));
+
+    // Reply is packed: read into an aligned entry, Xtensa faults on unaligned words
+    ACTLOG_Entry_t entry;
+    uint8_t n = 0;
+    while (n < count && ACTLOG_Read(pCmd->Index + n, &entry))
+        memcpy(&Reply.Data.Entries[n++], &entry, sizeof(entry));
+    Reply.Data.Count = n;
+
+    const uint16_t size = (uint16_t)(12U + n * sizeof(ACTLOG_Entry_t));
+    Reply.Header.ID = 0x0571;
+    Reply.Header.Size = size;
+
+    SendReply(&Reply, (uint16_t)(size + 4U));
+}
+#endif
+
+#ifdef ENABLE_I2C_BUS
+// 0x0620: per-device I2C statistics, optionally with a hardware vs bit-bang benchmark
+static void CMD_0620(const uint8_t *pBuffer)
+{
+    const CMD_0620_t *pCmd = (const CMD_0620_t *)pBuffer;
+    REPLY_0620_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    memset(&Reply.Data, 0, sizeof(Reply.Data));
+    Reply.Header.ID = 0x0621;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Device = pCmd->Device;
+
+    if (pCmd->Device >= I2CBUS_DEV_COUNT) {
+        Reply.Data.Status = 1U;
+    } else {
+        // Reply is packed: fill aligned copies, Xtensa faults on unaligned words
+        I2CBUS_Bench_t bench = {0};
+        I2CBUS_Stats_t stats;
+
+        if (pCmd->Rounds > 0U)
+            I2CBUS_Benchmark(pCmd->Device, pCmd->Rounds, &bench);
+        else
+            bench.ClockHz = I2CBUS_GetClock(pCmd->Device);
+        I2CBUS_GetStats(pCmd->Device, &stats);
+        memcpy(&Reply.Data.Bench, &bench, sizeof(bench));
+        memcpy(&Reply.Data.Stats, &stats, sizeof(stats));
+        Reply.Data.KeypadDeferred = I2CBUS_KeypadDeferred();
+    }
+
+    SendReply(&Reply, sizeof(Reply));
+
+    if (pCmd->Clear)
+        I2CBUS_ResetStats();
+}
+
+// 0x0622: I2C transaction trace, newest first
+static void CMD_0622(const uint8_t *pBuffer)
+{
+    const CMD_0622_t *pCmd = (const CMD_0622_t *)pBuffer;
+    REPLY_0622_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    uint8_t count = pCmd->Count;
+    if (count > I2CBUS_CPS_MAX_TRACE)
+        count = I2CBUS_CPS_MAX_TRACE;
+
+    Reply.Data.Total = I2CBUS_TraceCount();
+    Reply.Data.Index = pCmd->Index;
+    memset(Reply.Data.Padding, 0, sizeof(Reply.Data.Padding));
+
+    // Reply is packed: read into an aligned entry, Xtensa faults on unaligned words
+    I2CBUS_Trace_t entry;
+    uint8_t n = 0;
+    while (n < count && I2CBUS_TraceRead((uint16_t)(pCmd->Index + n), &entry))
+        memcpy(&Reply.Data.Entries[n++], &entry, sizeof(entry));
+    Reply.Data.Count = n;
+
+    const uint16_t size = (uint16_t)(8U + n * sizeof(I2CBUS_Trace_t));
+    Reply.Header.ID = 0x0623;
+    Reply.Header.Size = size;
+
+    SendReply(&Reply, (uint16_t)(size + 4U));
+}
+#endif
+
+#ifdef ENABLE_TELEMETRY
+// 0x0640: start, reconfigure or stop the binary telemetry stream
+static void CMD_0640(const uint8_t *pBuffer)
+{
+    const CMD_0640_t *pCmd = (const CMD_0640_t *)pBuffer;
+    REPLY_0640_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    Reply.Data.Dropped = TELEM_GetDropped();
+    TELEM_Configure(pCmd->Mask, pCmd->IntervalMs);
+
+    Reply.Header.ID = 0x0641;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Version = TELEM_VERSION;
+    Reply.Data.Mask = TELEM_GetMask();
+    Reply.Data.IntervalMs = TELEM_GetInterval();
+    Reply.Data.Padding = 0;
+
+    SendReply(&Reply, sizeof(Reply));
+}
+#endif
+
+#ifdef ENABLE_PROFILER
+// 0x0650: per-zone call counts and timings, busiest first
+static void CMD_0650(const uint8_t *pBuffer)
+{
+    const CMD_0650_t *pCmd = (const CMD_0650_t *)pBuffer;
+    PROFILER_Report_t report[PROFILER_ZONE_COUNT];
+    REPLY_0650_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    uint8_t count = pCmd->Count;
+    if (count > PROFILER_ZONE_COUNT)
+        count = PROFILER_ZONE_COUNT;
+
+    Reply.Data.ElapsedMs = PROFILER_ElapsedMs();
+    Reply.Data.ZoneCount = PROFILER_ZONE_COUNT;
+    Reply.Data.Count = PROFILER_Top(report, count);
+    Reply.Data.Padding = 0;
+    // Reply is packed: fill an aligned copy, Xtensa faults on unaligned words
+    memcpy(Reply.Data.Entries, report, Reply.Data.Count * sizeof(PROFILER_Report_t));
+
+    const uint16_t size = (uint16_t)(8U + Reply.Data.Count * sizeof(PROFILER_Report_t));
+    Reply.Header.ID = 0x0651;
+    Reply.Header.Size = size;
+
+    SendReply(&Reply, (uint16_t)(size + 4U));
+
+    if (pCmd->Clear)
+        PROFILER_Reset();
+}
+#endif
+
+#ifdef ENABLE_TRACE
+// 0x0660: set the trace event mask, optionally clear and benchmark
+static void CMD_0660(const uint8_t *pBuffer)
+{
+    const CMD_0660_t *pCmd = (const CMD_0660_t *)pBuffer;
+    TRACE_Bench_t bench;
+    REPLY_0660_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    memset(&bench, 0, sizeof(bench));
+    if (pCmd->Flags & UART_TRACE_FLAG_CLEAR)
+        TRACE_Clear();
+    if (pCmd->Flags & UART_TRACE_FLAG_BENCH)
+        TRACE_Benchmark(10000U, &bench);
+    TRACE_SetMask(pCmd->Mask);
+
+    Reply.Header.ID = 0x0661;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Version = TRACE_VERSION;
+    Reply.Data.EntrySize = sizeof(TRACE_Entry_t);
+    Reply.Data.Length = TRACE_LENGTH;
+    Reply.Data.Mask = TRACE_GetMask();
+    Reply.Data.Pending = TRACE_Pending();
+    Reply.Data.Padding = 0;
+    Reply.Data.Dropped = TRACE_Dropped();
+    Reply.Data.Bench = bench;
+
+    SendReply(&Reply, sizeof(Reply));
+}
+
+// 0x0662: drain the oldest trace entries
+static void CMD_0662(const uint8_t *pBuffer)
+{
+    const CMD_0662_t *pCmd = (const CMD_0662_t *)pBuffer;
+    TRACE_Entry_t entries[UART_TRACE_MAX_DRAIN];
+    REPLY_0662_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    uint8_t count = pCmd->Count;
+    if (count > UART_TRACE_MAX_DRAIN)
+        count = UART_TRACE_MAX_DRAIN;
+
+    Reply.Data.Count = (uint8_t)TRACE_Drain(entries, count);
+    Reply.Data.NowUs = (uint32_t)micros();
+    Reply.Data.Dropped = TRACE_Dropped();
+    Reply.Data.Pending = TRACE_Pending();
+    Reply.Data.Padding = 0;
+    memcpy(Reply.Data.Entries, entries, Reply.Data.Count * sizeof(TRACE_Entry_t));
+
+    const uint16_t size = (uint16_t)(12U + Reply.Data.Count * sizeof(TRACE_Entry_t));
+    Reply.Header.ID = 0x0663;
+    Reply.Header.Size = size;
+
+    SendReply(&Reply, (uint16_t)(size + 4U));
+}
+#endif
+
+// 0x0670: tone scanner time-to-detect per code
+static void CMD_0670(const uint8_t *pBuffer)
+{
+    const CMD_0670_t *pCmd = (const CMD_0670_t *)pBuffer;
+    uint16_t detectMs[ARRAY_SIZE(DCS_Options)];
+    REPLY_0670_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    const DCS_CodeType_t type = pCmd->Type == CODE_TYPE_DIGITAL ? CODE_TYPE_DIGITAL : CODE_TYPE_CONTINUOUS_TONE;
+
+    Reply.Data.Type = (uint8_t)type;
+    Reply.Data.Count = SCANNER_GetDetectTimes(type, detectMs, ARRAY_SIZE(detectMs));
+    Reply.Data.Padding = 0;
+    // Reply is packed: fill an aligned copy, Xtensa faults on unaligned words
+    memcpy(Reply.Data.DetectMs, detectMs, Reply.Data.Count * sizeof(uint16_t));
+
+    const uint16_t size = (uint16_t)(4U + Reply.Data.Count * sizeof(uint16_t));
+    Reply.Header.ID = 0x0671;
+    Reply.Header.Size = size;
+
+    SendReply(&Reply, (uint16_t)(size + 4U));
+
+    if (pCmd->Clear)
+        SCANNER_ClearDetectTimes();
+}
+
 #ifdef ENABLE_UART_RW_BK_REGS
 static void CMD_0601_ReadBK4819Reg(const uint8_t *pBuffer)
 {
@@ -621,6 +1259,31 @@ static void CMD_0602_WriteBK4819Reg(const uint8_t *pBuffer)
 }
 #endif
 
+// Moves whatever fits from the UART driver into the ring.  Bytes that do not
+// fit stay in the driver FIFO until the ring has been parsed further, so a
+// burst of large frames is never overwritten before it is handled.
+static void UART_FillRing(void) {
+    while (1) {
+        const uint16_t head = uart_buffer_head;
+        const uint16_t tail = gUART_WriteIndex;
+        uint16_t space;
+
+        if (head >= tail)
+            space = (uint16_t)(sizeof(UART_DMA_Buffer) - head - (tail == 0 ? 1U : 0U));
+        else
+            space = (uint16_t)(tail - head - 1U);
+
+        if (space == 0)
+            return;
+
+        const uint32_t n = UART_ReadBuffer(UART_DMA_Buffer + head, space);
+        if (n == 0)
+            return;
+
+        uart_buffer_head = DMA_INDEX(head, n);
+    }
+}
+
 bool UART_IsCommandAvailable(void) {
     uint16_t Index;
     uint16_t TailIndex;
@@ -628,127 +1291,116 @@ bool UART_IsCommandAvailable(void) {
     uint16_t CRC;
     uint16_t CommandLength;
 
-    // Read available data from UART into circular buffer.
-    // IMPORTANT: the previous linear fill implementation would stop reading after 256 bytes.
-    while (UART_Available() > 0) {
-        const int c = UART_Read();
-        if (c < 0) {
-            break;
-        }
-
-        const uint16_t next = DMA_INDEX(uart_buffer_head, 1);
-        if (next == gUART_WriteIndex) {
-            // Buffer full: drop oldest byte to keep receiving.
-            gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
-        }
+    // Legacy CPS writes (and bulk sessions left open) reload once the stream goes quiet.
+    if (gUartReloadRegions != 0 && (uint32_t)(millis() - gUartReloadTouchedMs) >= UART_RELOAD_IDLE_MS)
+        UART_ReloadSettings();
 
-        UART_DMA_Buffer[uart_buffer_head] = (uint8_t)c;
-        uart_buffer_head = next;
-    }
+    UART_FillRing();
 
     const uint16_t DmaLength = uart_buffer_head;
 
-
+    // Each pass consumes one frame (or resyncs past garbage); frames with a bad
+    // CRC are dropped here so the caller's drain loop only sees good ones.
     while (1) {
-        if (gUART_WriteIndex == DmaLength)
-            return false;
+        while (1) {
+            if (gUART_WriteIndex == DmaLength)
+                return false;
 
-        while (gUART_WriteIndex != DmaLength && UART_DMA_Buffer[gUART_WriteIndex] != 0xABU)
-            gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+            while (gUART_WriteIndex != DmaLength && UART_DMA_Buffer[gUART_WriteIndex] != 0xABU)
+                gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
 
-        if (gUART_WriteIndex == DmaLength)
-            return false;
+            if (gUART_WriteIndex == DmaLength)
+                return false;
 
-        if (gUART_WriteIndex < DmaLength)
-            CommandLength = DmaLength - gUART_WriteIndex;
-        else
-            CommandLength = (DmaLength + sizeof(UART_DMA_Buffer)) - gUART_WriteIndex;
+            if (gUART_WriteIndex < DmaLength)
+                CommandLength = DmaLength - gUART_WriteIndex;
+            else
+                CommandLength = (DmaLength + sizeof(UART_DMA_Buffer)) - gUART_WriteIndex;
 
-        if (CommandLength < 8)
-            return false;
+            if (CommandLength < 8)
+                return false;
 
-        if (UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 1)] == 0xCD)
-            break;
+            if (UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 1)] == 0xCD)
+                break;
 
-        gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
-    }
+            gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+        }
 
-    Index = DMA_INDEX(gUART_WriteIndex, 2);
-    Size = (UART_DMA_Buffer[DMA_INDEX(Index, 1)] << 8) | UART_DMA_Buffer[Index];
+        Index = DMA_INDEX(gUART_WriteIndex, 2);
+        Size = (UART_DMA_Buffer[DMA_INDEX(Index, 1)] << 8) | UART_DMA_Buffer[Index];
 
-    // The length field is payload length (excluding CRC and footer).
-    // Drop obviously invalid sizes, but keep resyncing instead of discarding everything.
-    if (Size > (uint16_t)(sizeof(UART_Command.Buffer) - 2u)) {
+        // The length field is payload length (excluding CRC and footer).
+        // Drop obviously invalid sizes, but keep resyncing instead of discarding everything.
+        if (Size > (uint16_t)(sizeof(UART_Command.Buffer) - 2u)) {
 #if UART_PROTOCOL_DEBUG
-        UART_DebugLogFrame("bad-len", Size, CommandLength);
+            UART_DebugLogFrame("bad-len", Size, CommandLength);
 #endif
-        gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
-        return false;
-    }
-
-    if (CommandLength < (Size + 8)) {
-        // Partial frame: wait for more bytes.
-        return false;
-    }
-
-    Index = DMA_INDEX(Index, 2);
-    TailIndex = DMA_INDEX(Index, Size + 2);
-
-    if (UART_DMA_Buffer[TailIndex] != 0xDC || UART_DMA_Buffer[DMA_INDEX(TailIndex, 1)] != 0xBA) {
-        // Footer mismatch: advance one byte and resync.
-    #if UART_PROTOCOL_DEBUG
-        UART_DebugLogFrame("bad-footer", Size, CommandLength);
-    #endif
-        gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
-        return false;
-    }
+            gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+            continue;
+        }
 
-    if (TailIndex < Index) {
-        const uint16_t ChunkSize = sizeof(UART_DMA_Buffer) - Index;
-        memcpy(UART_Command.Buffer, UART_DMA_Buffer + Index, ChunkSize);
-        memcpy(UART_Command.Buffer + ChunkSize, UART_DMA_Buffer, TailIndex);
-    } else
-        memcpy(UART_Command.Buffer, UART_DMA_Buffer + Index, TailIndex - Index);
+        if (CommandLength < (Size + 8)) {
+            // Partial frame: wait for more bytes.
+            return false;
+        }
 
-    TailIndex = DMA_INDEX(TailIndex, 2);
-    // Advance parse pointer (no need to clear bytes in a ring buffer).
-    gUART_WriteIndex = TailIndex;
+        Index = DMA_INDEX(Index, 2);
+        TailIndex = DMA_INDEX(Index, Size + 2);
 
-    // The on-wire protocol used by K5Web always XOR-obfuscates (payload + CRC).
-    // Deobfuscate first, then decide encryption mode by decoded command ID.
-    {
-        unsigned int i;
-        for (i = 0; i < (Size + 2u); i++)
-            UART_Command.Buffer[i] ^= Obfuscation[i % 16];
-    }
+        if (UART_DMA_Buffer[TailIndex] != 0xDC || UART_DMA_Buffer[DMA_INDEX(TailIndex, 1)] != 0xBA) {
+            // Footer mismatch: advance one byte and resync.
+#if UART_PROTOCOL_DEBUG
+            UART_DebugLogFrame("bad-footer", Size, CommandLength);
+#endif
+            gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+            continue;
+        }
 
-    // Basic sanity check: payload must contain at least an inner Header_t.
-    if (Size < (uint16_t)sizeof(Header_t)) {
+        // Decode in place; only a frame that wraps around the end of the ring
+        // is first made contiguous in UART_Command.
+        if (TailIndex < Index) {
+            const uint16_t ChunkSize = sizeof(UART_DMA_Buffer) - Index;
+            memcpy(UART_Command.Buffer, UART_DMA_Buffer + Index, ChunkSize);
+            memcpy(UART_Command.Buffer + ChunkSize, UART_DMA_Buffer, TailIndex);
+            gUartFrame = UART_Command.Buffer;
+        } else
+            gUartFrame = UART_DMA_Buffer + Index;
+
+        // Advance parse pointer (no need to clear bytes in a ring buffer).
+        gUART_WriteIndex = DMA_INDEX(TailIndex, 2);
+
+        // The on-wire protocol used by K5Web always XOR-obfuscates (payload + CRC).
+        // Deobfuscate and checksum the payload in one pass, then the CRC itself.
+        const uint16_t crcCalc = CRC_XorCalculate(gUartFrame, Size, Obfuscation);
+        gUartFrame[Size] ^= Obfuscation[Size % 16];
+        gUartFrame[Size + 1] ^= Obfuscation[(Size + 1) % 16];
+
+        // Basic sanity check: payload must contain at least an inner Header_t.
+        if (Size < (uint16_t)sizeof(Header_t)) {
 #if UART_PROTOCOL_DEBUG
-        UART_DebugLogFrame("too-small", Size, CommandLength);
+            UART_DebugLogFrame("too-small", Size, CommandLength);
 #endif
-        return false;
-    }
+            continue;
+        }
+
+        const uint16_t id = ((const Header_t *)gUartFrame)->ID;
 
-    if (UART_Command.Header.ID == 0x0514)
-        bIsEncrypted = false;
+        if (id == 0x0514)
+            bIsEncrypted = false;
 
-    if (UART_Command.Header.ID == 0x6902)
-        bIsEncrypted = true;
+        if (id == 0x6902)
+            bIsEncrypted = true;
 
-    CRC = UART_Command.Buffer[Size] | (UART_Command.Buffer[Size + 1] << 8);
-//    char b[2]="3K";
-//     uint8_t tmp[Size];
-//    for (int i = 0; i < Size; i++) {
-//        tmp[i]=UART_Command.Buffer[i];
-//    }
-    const bool crcOk = (CRC_Calculate1(UART_Command.Buffer, Size) == CRC);
+        CRC = gUartFrame[Size] | (gUartFrame[Size + 1] << 8);
+        const bool crcOk = (crcCalc == CRC);
 
 #if UART_PROTOCOL_DEBUG
-    UART_DebugLogCmd(UART_Command.Header.ID, Size, UART_Command.Header.Size, crcOk);
+        UART_DebugLogCmd(id, Size, ((const Header_t *)gUartFrame)->Size, crcOk);
 #endif
 
-    return crcOk;
+        if (crcOk)
+            return true;
+    }
 }
 
 #if ENABLE_CHINESE_FULL == 4
@@ -794,26 +1446,13 @@ static void CMD_0538(const uint8_t *pBuffer)//write
     Reply.Header.ID = 0x051E;
     Reply.Header.Size = sizeof(Reply.Data);
     Reply.Data.Offset = pCmd->Offset;
-    int add=((pCmd->Size) - 2)%8;
-
 
+    if (pCmd->Size > 2) {
+        const uint32_t addr = ((uint32_t)pCmd->Offset << 16) + ((uint32_t)pCmd->Data[1] << 8) + pCmd->Data[0];
 
-        for ( int i = 0; i < ((pCmd->Size) - 2) / 8+(add==0?0:1); i++) {
-            const uint32_t Offset = ((pCmd->Offset) << 16) + ((pCmd->Data[1]) << 8) + (pCmd->Data[0]) + (i * 8U);
-//#ifdef ENABLE_DOPPLER
-//            if(Offset>=0x90000)
-//                {
-//                memcpy(time,pCmd->Data[i * 8U + 2],6);
-//                RTC_Set(time);
-//                continue;
-//                }
-//#endif
-                if(add&&i==((pCmd->Size) - 2) / 8+(add==0?0:1)-1)
-                    EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U + 2], add);
-                else
-                    EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U + 2], 8);
-        }
-            SETTINGS_InitEEPROM();
+        EEPROM_WriteBulk(addr, &pCmd->Data[2], (uint32_t)pCmd->Size - 2U);
+        UART_MarkWritten(addr, (uint32_t)pCmd->Size - 2U);
+    }
 
     SendReply(&Reply, sizeof(Reply));
 }
@@ -913,20 +1552,295 @@ static void CMD_1438(const uint8_t *pBuffer)
 #else
     // Fallback (non-ESP32 builds): behave like EEPROM write at the same address.
     if (data_len > 0U) {
-        // Reuse the 8-byte chunking style from the original 0x0538 implementation.
-        uint32_t written = 0;
-        while (written < data_len) {
-            const uint8_t chunk = (uint8_t)((data_len - written) >= 8U ? 8U : (data_len - written));
-            EEPROM_WriteBuffer(addr + written, &pCmd->Data[2 + written], chunk);
-            written += chunk;
+        EEPROM_WriteBulk(addr, &pCmd->Data[2], data_len);
+        UART_MarkWritten(addr, data_len);
+    }
+#endif
+
+    SendReply(&Reply, sizeof(Reply));
+}
+
+// 0x0630: open a bulk session and negotiate the block size and features
+static void CMD_0630(const uint8_t *pBuffer)
+{
+    const CMD_0630_t *pCmd = (const CMD_0630_t *)pBuffer;
+    REPLY_0630_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    uint16_t maxData = pCmd->MaxData;
+    if (maxData == 0U || maxData > UART_BULK_MAX_DATA)
+        maxData = UART_BULK_MAX_DATA;
+    gUartBulkMaxData = maxData;
+    gUartBulkFlags = pCmd->Flags & (UART_BULK_FLAG_LZ4 | UART_BULK_FLAG_HASH);
+
+    Reply.Header.ID = 0x0631;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Version = UART_BULK_VERSION;
+    Reply.Data.Status = UART_BULK_OK;
+    Reply.Data.MaxData = maxData;
+    Reply.Data.EepromSize = EEPROM_GetLogicalSize();
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+    Reply.Data.SharedSize = shared_size_c();
+#else
+    Reply.Data.SharedSize = 0;
+#endif
+    Reply.Data.Flags = gUartBulkFlags;
+    Reply.Data.Padding = 0;
+
+    SendReply(&Reply, sizeof(Reply));
+}
+
+static uint8_t UART_BulkLimit(uint8_t Space, uint32_t *pLimit)
+{
+    if (gUartBulkMaxData == 0U)
+        return UART_BULK_ERR_SESSION;
+
+    if (Space == UART_BULK_SPACE_EEPROM)
+        *pLimit = EEPROM_GetLogicalSize();
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+    else if (Space == UART_BULK_SPACE_SHARED)
+        *pLimit = shared_size_c();
+#endif
+    else
+        return UART_BULK_ERR_SPACE;
+
+    return UART_BULK_OK;
+}
+
+static uint8_t UART_BulkCheck(uint8_t Space, uint32_t Address, uint16_t Size)
+{
+    uint32_t limit;
+    const uint8_t status = UART_BulkLimit(Space, &limit);
+
+    if (status != UART_BULK_OK)
+        return status;
+    if (Size == 0U || Size > gUartBulkMaxData || Address >= limit || Size > limit - Address)
+        return UART_BULK_ERR_RANGE;
+    return UART_BULK_OK;
+}
+
+static bool UART_BulkRead(uint8_t Space, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+    if (Space == UART_BULK_SPACE_SHARED)
+        return shared_read_c(Address, pData, Size);
+#else
+    (void)Space;
+#endif
+    return EEPROM_ReadBulk(Address, pData, Size);
+}
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+static bool UART_BulkSharedMatches(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+    uint8_t buf[256];
+
+    while (Size > 0U) {
+        const uint32_t n = Size < sizeof(buf) ? Size : sizeof(buf);
+        if (!shared_read_c(Address, buf, n) || memcmp(buf, pData, n) != 0)
+            return false;
+        Address += n;
+        pData += n;
+        Size -= n;
+    }
+    return true;
+}
+#endif
+
+// 0x0632: read one block
+static void CMD_0632(const uint8_t *pBuffer)
+{
+    const CMD_0632_t *pCmd = (const CMD_0632_t *)pBuffer;
+    REPLY_0632_t *pReply = &gUartBulkReply.Read;
+    const uint8_t space = pCmd->Space & UART_BULK_SPACE_MASK;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    pReply->Data.Space = space;
+    pReply->Data.Address = pCmd->Address;
+    pReply->Data.Status = UART_BulkCheck(space, pCmd->Address, pCmd->Size);
+
+    uint16_t size = 0;
+    uint16_t payload = 0;
+    if (pReply->Data.Status == UART_BULK_OK) {
+        const bool lz4 = (gUartBulkFlags & UART_BULK_FLAG_LZ4) != 0U;
+        uint8_t *pRaw = lz4 ? gUartBulkRaw : pReply->Data.Data;
+
+        size = pCmd->Size;
+        payload = size;
+        if (!UART_BulkRead(space, pCmd->Address, pRaw, size)) {
+            pReply->Data.Status = UART_BULK_ERR_IO;
+            size = payload = 0;
+        } else if (lz4) {
+            const uint32_t packed = LZ4_EncodeBlock(pRaw, size, pReply->Data.Data, size - 1U);
+            if (packed != 0U) {
+                pReply->Data.Space |= UART_BULK_SPACE_LZ4;
+                payload = (uint16_t)packed;
+            } else {
+                memcpy(pReply->Data.Data, pRaw, size);
+            }
         }
-        SETTINGS_InitEEPROM();
+        pReply->Data.Crc32 = CRC32_Update(0, pRaw, size);
+    } else {
+        pReply->Data.Crc32 = CRC32_Update(0, NULL, 0);
     }
+
+    pReply->Data.Size = size;
+    pReply->Header.ID = 0x0633;
+    pReply->Header.Size = (uint16_t)(12U + payload);
+
+    SendReply(pReply, (uint16_t)(16U + payload));
+}
+
+// 0x0634: write one block, verified against its CRC-32 before touching storage
+static void CMD_0634(const uint8_t *pBuffer)
+{
+    const CMD_0634_t *pCmd = (const CMD_0634_t *)pBuffer;
+    REPLY_0634_t Reply;
+    const uint8_t space = pCmd->Space & UART_BULK_SPACE_MASK;
+    const uint16_t payload = pCmd->Header.Size >= sizeof(CMD_0634_t) - sizeof(Header_t)
+                                 ? (uint16_t)(pCmd->Header.Size - (sizeof(CMD_0634_t) - sizeof(Header_t)))
+                                 : 0U;
+    const uint8_t *pData = pCmd->Data;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    Reply.Header.ID = 0x0635;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Space = space;
+    Reply.Data.Size = pCmd->Size;
+    Reply.Data.Address = pCmd->Address;
+    Reply.Data.Status = UART_BulkCheck(space, pCmd->Address, pCmd->Size);
+
+    if (Reply.Data.Status == UART_BULK_OK) {
+        if (pCmd->Space & UART_BULK_SPACE_LZ4) {
+            if ((gUartBulkFlags & UART_BULK_FLAG_LZ4) == 0U ||
+                LZ4_DecodeBlock(pCmd->Data, payload, gUartBulkRaw, pCmd->Size) != pCmd->Size)
+                Reply.Data.Status = UART_BULK_ERR_FORMAT;
+            pData = gUartBulkRaw;
+        } else if (payload < pCmd->Size) {
+            Reply.Data.Status = UART_BULK_ERR_RANGE;
+        }
+    }
+
+    if (Reply.Data.Status == UART_BULK_OK && CRC32_Update(0, pData, pCmd->Size) != pCmd->Crc32)
+        Reply.Data.Status = UART_BULK_ERR_CRC;
+
+    if (Reply.Data.Status == UART_BULK_OK) {
+        bool ok = true;
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+        if (space == UART_BULK_SPACE_SHARED) {
+            // One erase per changed sector; unchanged sectors are left alone.
+            uint32_t address = pCmd->Address;
+            const uint8_t *src = pData;
+            uint32_t remaining = pCmd->Size;
+            while (ok && remaining > 0U) {
+                uint32_t chunk = EEPROM_STREAM_SECTOR - (address % EEPROM_STREAM_SECTOR);
+                if (chunk > remaining)
+                    chunk = remaining;
+                if (!UART_BulkSharedMatches(address, src, chunk))
+                    ok = shared_write_c(address, src, chunk);
+                address += chunk;
+                src += chunk;
+                remaining -= chunk;
+            }
+        } else
 #endif
+        {
+            ok = EEPROM_WriteBulk(pCmd->Address, pData, pCmd->Size);
+            UART_MarkWritten(pCmd->Address, pCmd->Size);
+        }
+        if (!ok)
+            Reply.Data.Status = UART_BULK_ERR_IO;
+    }
 
     SendReply(&Reply, sizeof(Reply));
 }
 
+// 0x0636: close the bulk session
+static void CMD_0636(const uint8_t *pBuffer)
+{
+    const CMD_0636_t *pCmd = (const CMD_0636_t *)pBuffer;
+    REPLY_0636_t Reply;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    Reply.Header.ID = 0x0637;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Status = UART_BULK_OK;
+    Reply.Data.Reloaded = UART_BulkFinish() ? 1U : 0U;
+    Reply.Data.Padding = 0;
+
+    SendReply(&Reply, sizeof(Reply));
+}
+
+// 0x0638: CRC-32 of Count consecutive blocks, for skip-unchanged transfers
+static void CMD_0638(const uint8_t *pBuffer)
+{
+    const CMD_0638_t *pCmd = (const CMD_0638_t *)pBuffer;
+    REPLY_0638_t *pReply = &gUartBulkReply.Hash;
+    const uint8_t space = pCmd->Space & UART_BULK_SPACE_MASK;
+    uint32_t limit = 0;
+    uint16_t count = 0;
+
+    if (pCmd->Timestamp != Timestamp)
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    pReply->Data.Space = space;
+    pReply->Data.Address = pCmd->Address;
+    pReply->Data.BlockSize = pCmd->BlockSize;
+    pReply->Data.Status = (gUartBulkFlags & UART_BULK_FLAG_HASH) ? UART_BulkLimit(space, &limit) : UART_BULK_ERR_SESSION;
+
+    if (pReply->Data.Status == UART_BULK_OK &&
+        (pCmd->BlockSize == 0U || pCmd->Count == 0U || pCmd->Count > UART_BULK_MAX_HASHES ||
+         pCmd->Address >= limit || (uint64_t)pCmd->BlockSize * pCmd->Count > limit - pCmd->Address))
+        pReply->Data.Status = UART_BULK_ERR_RANGE;
+
+    if (pReply->Data.Status == UART_BULK_OK) {
+        uint32_t address = pCmd->Address;
+
+        for (count = 0; count < pCmd->Count; count++) {
+            uint32_t crc = 0;
+            uint32_t remaining = pCmd->BlockSize;
+
+            while (remaining > 0U) {
+                const uint32_t n = remaining < sizeof(gUartBulkRaw) ? remaining : sizeof(gUartBulkRaw);
+                if (!UART_BulkRead(space, address, gUartBulkRaw, n)) {
+                    pReply->Data.Status = UART_BULK_ERR_IO;
+                    break;
+                }
+                crc = CRC32_Update(crc, gUartBulkRaw, n);
+                address += n;
+                remaining -= n;
+            }
+            if (pReply->Data.Status != UART_BULK_OK)
+                break;
+            pReply->Data.Crc32[count] = crc;
+        }
+    }
+
+    pReply->Data.Count = count;
+    pReply->Header.ID = 0x0639;
+    pReply->Header.Size = (uint16_t)(12U + count * 4U);
+
+    SendReply(pReply, (uint16_t)(16U + count * 4U));
+}
+
 #ifdef ENABLE_DOCK
 static void CMD_0801(const uint8_t *pBuffer)
     {
@@ -943,39 +1857,59 @@ static void CMD_0801(const uint8_t *pBuffer)
 #endif
 
 void UART_HandleCommand(void) {
-    switch (UART_Command.Header.ID) {
+    PROFILER_ZONE(UART_COMMAND);
+
+    switch (((const Header_t *)gUartFrame)->ID) {
 #if ENABLE_CHINESE_FULL == 4
         case 0x052B://read
-            CMD_051B(UART_Command.Buffer);
+            CMD_051B(gUartFrame);
             break;
         case 0x0538://write
-            CMD_0538(UART_Command.Buffer);
+            CMD_0538(gUartFrame);
             break;
 #endif
 
         case 0x142B: // flash read (shared partition)
-            CMD_142B(UART_Command.Buffer);
+            CMD_142B(gUartFrame);
             break;
 
         case 0x1438: // flash write (shared partition)
-            CMD_1438(UART_Command.Buffer);
+            CMD_1438(gUartFrame);
+            break;
+        case 0x0630: // bulk session open
+            CMD_0630(gUartFrame);
+            break;
+
+        case 0x0632: // bulk block read
+            CMD_0632(gUartFrame);
+            break;
+
+        case 0x0634: // bulk block write
+            CMD_0634(gUartFrame);
+            break;
+
+        case 0x0636: // bulk session close
+            CMD_0636(gUartFrame);
+            break;
+        case 0x0638: // bulk block hashes
+            CMD_0638(gUartFrame);
             break;
 #ifdef ENABLE_DOCK
         case 0x0801:
-            CMD_0801(UART_Command.Buffer);
+            CMD_0801(gUartFrame);
             break;
 
 #endif
         case 0x0514:
-            CMD_0514(UART_Command.Buffer);
+            CMD_0514(gUartFrame);
             break;
 
         case 0x051B:
-            CMD_051B(UART_Command.Buffer);
+            CMD_051B(gUartFrame);
             break;
 
         case 0x051D:
-            CMD_051D(UART_Command.Buffer);
+            CMD_051D(gUartFrame);
             break;
 
 
@@ -989,29 +1923,64 @@ void UART_HandleCommand(void) {
 #ifdef ENABLE_BLOCK
 
             case 0x052D:
-                CMD_052D(UART_Command.Buffer);
+                CMD_052D(gUartFrame);
                 break;
 #endif
         case 0x052F:
-            CMD_052F(UART_Command.Buffer);
+            CMD_052F(gUartFrame);
             break;
 
         case 0x05DD:
             // Avoid accidental reboot during bring-up unless explicitly enabled.
+            EEPROM_MirrorFlush();
             esp_restart();
 
             break;
 #ifdef ENABLE_UART_RW_BK_REGS
             case 0x0601:
-            CMD_0601_ReadBK4819Reg(UART_Command.Buffer);
+            CMD_0601_ReadBK4819Reg(gUartFrame);
             break;
 
         case 0x0602:
-            CMD_0602_WriteBK4819Reg(UART_Command.Buffer);
+            CMD_0602_WriteBK4819Reg(gUartFrame);
             break;
 #endif
         case 0x0610:
-            CMD_0610(UART_Command.Buffer);
+            CMD_0610(gUartFrame);
+            break;
+#ifdef ENABLE_ACTIVITY_LOG
+        case 0x0570:
+            CMD_0570(gUartFrame);
+            break;
+#endif
+#ifdef ENABLE_I2C_BUS
+        case 0x0620:
+            CMD_0620(gUartFrame);
+            break;
+        case 0x0622:
+            CMD_0622(gUartFrame);
+            break;
+#endif
+#ifdef ENABLE_TELEMETRY
+        case 0x0640:
+            CMD_0640(gUartFrame);
+            break;
+#endif
+#ifdef ENABLE_PROFILER
+        case 0x0650:
+            CMD_0650(gUartFrame);
+            break;
+#endif
+#ifdef ENABLE_TRACE
+        case 0x0660:
+            CMD_0660(gUartFrame);
+            break;
+        case 0x0662:
+            CMD_0662(gUartFrame);
+            break;
+#endif
+        case 0x0670:
+            CMD_0670(gUartFrame);
             break;
     }
 }
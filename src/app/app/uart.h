@@ -23,5 +23,9 @@ bool UART_IsCommandAvailable(void);
 
 void UART_HandleCommand(void);
 
+// Frames handled per main-loop pass at most; UART_IsCommandAvailable drains
+// the receive ring one frame per call.
+#define UART_MAX_FRAMES_PER_POLL 16U
+
 #endif
 
@@ -41,6 +41,7 @@
 #include "misc.h"
 #include "settings.h"
 #include "driver/i2c1.h"
+#include "driver/i2c_bus.h"
 #include "driver/bk1080.h"
 #include "driver/bk4819.h"
 #include "driver/uart1.h"
@@ -95,6 +96,7 @@ void BOARD_Init(void) {
 ADC_Configure();
     BACKLIGHT_InitHardware();
     I2C_Init();
+    I2CBUS_Init();
     BK1080_Init(0, false);
     // 初始化设备
     ST7565_Init();
@@ -2,10 +2,30 @@
 
 #include "rtc.h"
 
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#else
+#include "../../opencv/Arduino.hpp"
+#endif
+
 #include "driver/pcf8563.h"
 
 uint8_t my_time[6] = {0};
 
+// One PCF8563 reading anchored to millis(); RTC_Seconds() extrapolates from it
+// so that scan/spectrum code can timestamp events without touching I2C.
+static uint32_t rtc_anchor_seconds;
+static uint32_t rtc_anchor_ms;
+static bool rtc_anchor_valid;
+
+static const uint16_t rtc_days_before_month[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+static inline bool rtc_is_leap(uint8_t year)
+{
+    // Only 2000..2099 is representable, so the century rule never applies.
+    return (year & 3U) == 0U;
+}
+
 static void rtc_update_from_pcf(const pcf8563_time_t *t)
 {
     if (!t) {
@@ -53,3 +73,86 @@ void RTC_Get(void)
     }
     rtc_update_from_pcf(&t);
 }
+uint32_t RTC_DateToSeconds(const uint8_t date[6])
+{
+    const uint8_t year = date[0];
+    uint32_t days = (uint32_t)year * 365U + ((uint32_t)year + 3U) / 4U;
+
+    days += rtc_days_before_month[(date[1] - 1U) % 12U];
+    if (date[1] > 2U && rtc_is_leap(year)) {
+        days++;
+    }
+    days += (uint32_t)date[2] - 1U;
+
+    return ((days * 24U + date[3]) * 60U + date[4]) * 60U + date[5];
+}
+
+void RTC_SecondsToDate(uint32_t seconds, uint8_t date[6])
+{
+    uint32_t days = seconds / 86400U;
+    uint32_t rem = seconds % 86400U;
+    uint8_t year = 0;
+    uint8_t month = 0;
+
+    date[5] = (uint8_t)(rem % 60U);
+    rem /= 60U;
+    date[4] = (uint8_t)(rem % 60U);
+    date[3] = (uint8_t)(rem / 60U);
+
+    while (year < 99U) {
+        const uint32_t len = rtc_is_leap(year) ? 366U : 365U;
+        if (days < len) {
+            break;
+        }
+        days -= len;
+        year++;
+    }
+
+    while (month < 11U) {
+        uint32_t next = rtc_days_before_month[month + 1U];
+        if (month + 1U >= 2U && rtc_is_leap(year)) {
+            next++;
+        }
+        if (days < next) {
+            break;
+        }
+        month++;
+    }
+
+    uint32_t first = rtc_days_before_month[month];
+    if (month >= 2U && rtc_is_leap(year)) {
+        first++;
+    }
+
+    date[0] = year;
+    date[1] = (uint8_t)(month + 1U);
+    date[2] = (uint8_t)(days - first + 1U);
+}
+
+bool RTC_Anchor(void)
+{
+    pcf8563_time_t t;
+
+    if (!PCF8563_ReadTime(&t)) {
+        return false;
+    }
+    if (t.year < 2000U || t.year > 2099U || t.month < 1U || t.month > 12U || t.day < 1U || t.day > 31U) {
+        return false;
+    }
+    rtc_update_from_pcf(&t);
+
+    rtc_anchor_seconds = RTC_DateToSeconds(my_time);
+    rtc_anchor_ms = millis();
+    rtc_anchor_valid = !t.voltage_low;
+    return true;
+}
+
+bool RTC_AnchorValid(void)
+{
+    return rtc_anchor_valid;
+}
+
+uint32_t RTC_Seconds(void)
+{
+    return rtc_anchor_seconds + (uint32_t)(millis() - rtc_anchor_ms) / 1000U;
+}
@@ -4,6 +4,7 @@
 #ifndef HARDWARE_DP32G030_RTC_H
 #define HARDWARE_DP32G030_RTC_H
 #include <stdint.h>
+#include <stdbool.h>
 
 //RCLF 32768HZ
 #define RTC_BASE_ADD 0x40069000
@@ -39,6 +40,15 @@ void RTC_INIT(void);
 void RTC_Set( );
 void RTC_Get();
 
+// date[] uses the my_time layout: YY(-2000), M, D, h, m, s
+uint32_t RTC_DateToSeconds(const uint8_t date[6]);
+void RTC_SecondsToDate(uint32_t seconds, uint8_t date[6]);
+
+// Read the PCF8563 once and extrapolate with millis() afterwards.
+bool RTC_Anchor(void);
+bool RTC_AnchorValid(void);
+uint32_t RTC_Seconds(void);
+
 extern uint8_t my_time[6];
 
 #endif
\ No newline at end of file
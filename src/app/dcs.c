@@ -13,8 +13,11 @@
  *     See the License for the specific language governing permissions and
  *     limitations under the License.
  */
+#include <stdbool.h>
+
 #include "driver/eeprom.h"
 #include "dcs.h"
+#include "dcs_table.h"
 
 #ifndef ARRAY_SIZE
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
@@ -58,48 +61,47 @@ const uint16_t DCS_Options[104] = {
         0x01C3, 0x01CA, 0x01D3, 0x01D9, 0x01DA, 0x01DC, 0x01E3, 0x01EC,
 };
 
-static uint32_t DCS_CalculateGolay(uint32_t CodeWord) {
-    unsigned int i;
-    uint32_t Word = CodeWord;
-    for (i = 0; i < 12; i++) {
-        Word <<= 1;
-        if (Word & 0x1000)
-            Word ^= 0x08EA;
-    }
-    return CodeWord | ((Word & 0x0FFE) << 11);
+uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option) {
+    if (CodeType == CODE_TYPE_REVERSE_DIGITAL)
+        return DCS_GolayWordsReverse[Option];
+    return DCS_GolayWords[Option];
 }
 
-uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option) {
+// Every 23-bit rotation of every DCS codeword (23 x 104 = 2392 words) sits in
+// a perfect hash in dcs_table.h, generated offline and checked in; regenerate
+// it with tools/gen_dcs_tables.py after editing DCS_Options.  The bucket picks
+// a displacement, the displaced slot holds the only word that can match.
+// Entry = codeword | (option + 1) << 24, 0 = empty slot.
+#define DCS_WORD_MASK  0x7FFFFFU
 
-    uint32_t Code = DCS_CalculateGolay(DCS_Options[Option] + 0x800U);
-    if (CodeType == CODE_TYPE_REVERSE_DIGITAL)
-        Code ^= 0x7FFFFF;
-    return Code;
+static inline uint32_t DCS_RotateLeft(uint32_t Word) {
+    return ((Word << 1) | (Word >> 22)) & DCS_WORD_MASK;
 }
 
 uint8_t DCS_GetCdcssCode(uint32_t Code) {
-    unsigned int i;
-    for (i = 0; i < 23; i++) {
-        uint32_t Shift;
+    bool Folded = false;
+
+    // REG_69/6A hold 24 bits; fold the extra bit out the way the first
+    // rotate step always did.
+    if (Code & ~DCS_WORD_MASK) {
+        Code = ((Code >> 1) | ((Code & 1U) << 22)) & DCS_WORD_MASK;
+        Folded = true;
+    }
 
-        if (((Code >> 9) & 0x7U) == 4) {
-            unsigned int j;
+    const uint32_t Bucket = (Code * DCS_HASH_BUCKET_MUL) >> (32U - DCS_HASH_BUCKET_BITS);
+    const uint32_t Slot = ((Code * DCS_HASH_SLOT_MUL) >> (32U - DCS_HASH_SLOT_BITS)) ^ DCS_HashDisplace[Bucket];
+    const uint32_t Entry = DCS_HashTable[Slot];
 
+    if (Entry == 0 || (Entry & DCS_WORD_MASK) != Code)
+        return 0xFF;
 
-            for (j = 0; j < 104; j++) {
-                if (DCS_Options[j] == (Code & 0x1FF))
-                    if (DCS_GetGolayCodeWord(2, j) == Code)
-                        return j;
-            }
-        }
+    const uint8_t Option = (uint8_t)((Entry >> 24) - 1);
 
-        Shift = Code >> 1;
-        if (Code & 1U)
-            Shift |= 0x400000U;
-        Code = Shift;
-    }
+    // A folded word has one rotation fewer left to try.
+    if (Folded && DCS_RotateLeft(Code) == DCS_GolayWords[Option])
+        return 0xFF;
 
-    return 0xFF;
+    return Option;
 }
 
 uint8_t DCS_GetCtcssCode(int Code) {
@@ -0,0 +1,650 @@
+/* Generated offline by tools/gen_dcs_tables.py from DCS_Options in dcs.c; rerun it after editing them. Do not edit. */
+#ifndef DCS_TABLE_H
+#define DCS_TABLE_H
+
+#include <stdint.h>
+
+#define DCS_HASH_BUCKET_BITS 10U
+#define DCS_HASH_SLOT_BITS   12U
+#define DCS_HASH_BUCKET_MUL  0x9E3779B1U
+#define DCS_HASH_SLOT_MUL    0x85EBCA6BU
+
+static const uint32_t DCS_GolayWords[104] = {
+    0x763813, 0x6B7815, 0x65D816, 0x51F819, 0x5F581A, 0x0BE81E, 0x5B6823, 0x0FD827,
+    0x7CA829, 0x35582B, 0x6F482C, 0x5D1835, 0x679839, 0x69383A, 0x2E683B, 0x74783C,
+    0x35E84C, 0x72B84D, 0x7C184E, 0x5DA852, 0x07B855, 0x3D3859, 0x33985A, 0x2ED85C,
+    0x37A863, 0x2AE865, 0x1EC86A, 0x44D86D, 0x4A786E, 0x6BC872, 0x31D875, 0x05F87A,
+    0x18B87C, 0x6E9885, 0x5AB88A, 0x68E893, 0x75A895, 0x7B0896, 0x45B8A3, 0x1FA8A4,
+    0x58F8A5, 0x5658A6, 0x6278A9, 0x6CD8AA, 0x36C8AD, 0x1778B1, 0x5E88B3, 0x43C8B5,
+    0x4D68B6, 0x7948B9, 0x6AA8BC, 0x0CF8C6, 0x38D8C9, 0x6C68CD, 0x1968D5, 0x23E8D9,
+    0x2D48DA, 0x2978E3, 0x3A98E6, 0x0EB8E9, 0x54A8EE, 0x6858F4, 0x2F08F5, 0x1588F9,
+    0x776909, 0x79C90A, 0x3E990B, 0x4B9913, 0x6C5919, 0x62F91A, 0x7B8925, 0x752926,
+    0x4FA92A, 0x52E92C, 0x15B92D, 0x3AA932, 0x27E934, 0x60B935, 0x6E1936, 0x3C6943,
+    0x2F8946, 0x41B94E, 0x275953, 0x34B956, 0x0E395A, 0x19E966, 0x0C7975, 0x5D9986,
+    0x67198A, 0x0F5994, 0x01F997, 0x728999, 0x7C299A, 0x4C39AC, 0x2479B2, 0x3939B4,
+    0x22B9C3, 0x0BD9CA, 0x3989D3, 0x1E49D9, 0x10E9DA, 0x0DA9DC, 0x14D9E3, 0x20F9EC,
+};
+
+static const uint32_t DCS_GolayWordsReverse[104] = {
+    0x09C7EC, 0x1487EA, 0x1A27E9, 0x2E07E6, 0x20A7E5, 0x7417E1, 0x2497DC, 0x7027D8,
+    0x0357D6, 0x4AA7D4, 0x10B7D3, 0x22E7CA, 0x1867C6, 0x16C7C5, 0x5197C4, 0x0B87C3,
+    0x4A17B3, 0x0D47B2, 0x03E7B1, 0x2257AD, 0x7847AA, 0x42C7A6, 0x4C67A5, 0x5127A3,
+    0x48579C, 0x55179A, 0x613795, 0x3B2792, 0x358791, 0x14378D, 0x4E278A, 0x7A0785,
+    0x674783, 0x11677A, 0x254775, 0x17176C, 0x0A576A, 0x04F769, 0x3A475C, 0x60575B,
+    0x27075A, 0x29A759, 0x1D8756, 0x132755, 0x493752, 0x68874E, 0x21774C, 0x3C374A,
+    0x329749, 0x06B746, 0x155743, 0x730739, 0x472736, 0x139732, 0x66972A, 0x5C1726,
+    0x52B725, 0x56871C, 0x456719, 0x714716, 0x2B5711, 0x17A70B, 0x50F70A, 0x6A7706,
+    0x0896F6, 0x0636F5, 0x4166F4, 0x3466EC, 0x13A6E6, 0x1D06E5, 0x0476DA, 0x0AD6D9,
+    0x3056D5, 0x2D16D3, 0x6A46D2, 0x4556CD, 0x5816CB, 0x1F46CA, 0x11E6C9, 0x4396BC,
+    0x5076B9, 0x3E46B1, 0x58A6AC, 0x4B46A9, 0x71C6A5, 0x661699, 0x73868A, 0x226679,
+    0x18E675, 0x70A66B, 0x7E0668, 0x0D7666, 0x03D665, 0x33C653, 0x5B864D, 0x46C64B,
+    0x5D463C, 0x742635, 0x46762C, 0x61B626, 0x6F1625, 0x725623, 0x6B261C, 0x5F0613,
+};
+
+// Bucket -> displacement XORed into the slot hash.
+static const uint16_t DCS_HashDisplace[1024] = {
+    0x001, 0x001, 0x005, 0x002, 0x001, 0x000, 0x001, 0x001, 0x002, 0x000, 0x000, 0x002,
+    0x001, 0x000, 0x001, 0x000, 0x007, 0x003, 0x000, 0x001, 0x000, 0x002, 0x000, 0x002,
+    0x000, 0x000, 0x001, 0x002, 0x004, 0x001, 0x000, 0x000, 0x004, 0x001, 0x002, 0x002,
+    0x001, 0x00A, 0x000, 0x002, 0x002, 0x002, 0x002, 0x000, 0x000, 0x000, 0x007, 0x009,
+    0x000, 0x000, 0x001, 0x001, 0x001, 0x005, 0x001, 0x002, 0x003, 0x000, 0x000, 0x001,
+    0x000, 0x000, 0x001, 0x001, 0x000, 0x000, 0x001, 0x001, 0x001, 0x001, 0x002, 0x001,
+    0x000, 0x005, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x002, 0x000, 0x000,
+    0x003, 0x002, 0x000, 0x000, 0x00B, 0x002, 0x000, 0x000, 0x000, 0x001, 0x00B, 0x001,
+    0x001, 0x000, 0x000, 0x00F, 0x000, 0x001, 0x000, 0x001, 0x001, 0x019, 0x005, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x002, 0x009, 0x001, 0x000, 0x000, 0x001, 0x006, 0x001,
+    0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x008, 0x000, 0x007, 0x003, 0x000,
+    0x000, 0x002, 0x000, 0x001, 0x001, 0x000, 0x002, 0x001, 0x000, 0x001, 0x000, 0x001,
+    0x002, 0x000, 0x005, 0x000, 0x000, 0x000, 0x003, 0x001, 0x001, 0x000, 0x000, 0x000,
+    0x001, 0x003, 0x000, 0x000, 0x000, 0x002, 0x001, 0x000, 0x001, 0x000, 0x007, 0x000,
+    0x001, 0x001, 0x001, 0x007, 0x002, 0x001, 0x000, 0x000, 0x002, 0x000, 0x002, 0x000,
+    0x005, 0x000, 0x005, 0x000, 0x001, 0x002, 0x004, 0x000, 0x001, 0x001, 0x009, 0x000,
+    0x008, 0x001, 0x003, 0x001, 0x000, 0x000, 0x001, 0x001, 0x002, 0x001, 0x001, 0x000,
+    0x000, 0x000, 0x001, 0x000, 0x001, 0x000, 0x000, 0x000, 0x001, 0x002, 0x000, 0x004,
+    0x002, 0x000, 0x000, 0x000, 0x000, 0x000, 0x004, 0x002, 0x002, 0x001, 0x001, 0x000,
+    0x000, 0x006, 0x003, 0x000, 0x002, 0x005, 0x000, 0x001, 0x001, 0x003, 0x002, 0x000,
+    0x002, 0x001, 0x001, 0x000, 0x000, 0x002, 0x002, 0x000, 0x000, 0x000, 0x001, 0x003,
+    0x000, 0x001, 0x000, 0x001, 0x000, 0x005, 0x001, 0x000, 0x000, 0x001, 0x007, 0x001,
+    0x000, 0x004, 0x000, 0x005, 0x002, 0x005, 0x000, 0x000, 0x002, 0x000, 0x001, 0x000,
+    0x000, 0x000, 0x003, 0x000, 0x000, 0x00A, 0x000, 0x007, 0x000, 0x002, 0x001, 0x005,
+    0x002, 0x000, 0x001, 0x000, 0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x002, 0x000, 0x006, 0x000, 0x004, 0x001, 0x000, 0x008, 0x002,
+    0x002, 0x000, 0x003, 0x002, 0x000, 0x003, 0x000, 0x002, 0x000, 0x000, 0x000, 0x001,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x002, 0x001, 0x000,
+    0x008, 0x004, 0x002, 0x001, 0x000, 0x009, 0x001, 0x000, 0x000, 0x001, 0x000, 0x001,
+    0x007, 0x004, 0x003, 0x000, 0x000, 0x000, 0x000, 0x000, 0x001, 0x000, 0x000, 0x001,
+    0x005, 0x000, 0x001, 0x003, 0x003, 0x000, 0x004, 0x000, 0x004, 0x000, 0x000, 0x000,
+    0x002, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x001, 0x002, 0x000, 0x002,
+    0x005, 0x001, 0x001, 0x003, 0x001, 0x000, 0x001, 0x001, 0x000, 0x008, 0x002, 0x000,
+    0x000, 0x000, 0x007, 0x001, 0x002, 0x007, 0x008, 0x000, 0x001, 0x001, 0x000, 0x000,
+    0x008, 0x001, 0x000, 0x001, 0x004, 0x000, 0x000, 0x000, 0x000, 0x000, 0x002, 0x003,
+    0x000, 0x003, 0x002, 0x000, 0x001, 0x000, 0x002, 0x000, 0x000, 0x000, 0x001, 0x003,
+    0x001, 0x003, 0x000, 0x000, 0x000, 0x003, 0x001, 0x000, 0x000, 0x000, 0x000, 0x001,
+    0x003, 0x000, 0x005, 0x004, 0x001, 0x001, 0x000, 0x000, 0x000, 0x002, 0x000, 0x000,
+    0x004, 0x000, 0x001, 0x002, 0x001, 0x000, 0x003, 0x000, 0x004, 0x001, 0x004, 0x001,
+    0x000, 0x000, 0x005, 0x000, 0x000, 0x000, 0x000, 0x006, 0x000, 0x00C, 0x000, 0x000,
+    0x003, 0x001, 0x002, 0x001, 0x002, 0x000, 0x006, 0x003, 0x001, 0x003, 0x001, 0x002,
+    0x000, 0x000, 0x001, 0x000, 0x000, 0x001, 0x000, 0x000, 0x003, 0x001, 0x000, 0x003,
+    0x001, 0x001, 0x000, 0x000, 0x001, 0x000, 0x000, 0x001, 0x002, 0x000, 0x000, 0x001,
+    0x000, 0x000, 0x000, 0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x003, 0x00A,
+    0x000, 0x002, 0x000, 0x004, 0x000, 0x000, 0x008, 0x000, 0x003, 0x002, 0x002, 0x001,
+    0x000, 0x002, 0x002, 0x002, 0x000, 0x003, 0x000, 0x001, 0x005, 0x000, 0x000, 0x000,
+    0x006, 0x005, 0x000, 0x000, 0x000, 0x000, 0x001, 0x003, 0x002, 0x002, 0x002, 0x000,
+    0x001, 0x00A, 0x000, 0x000, 0x002, 0x000, 0x00D, 0x000, 0x001, 0x007, 0x001, 0x001,
+    0x000, 0x004, 0x000, 0x000, 0x001, 0x003, 0x000, 0x000, 0x009, 0x001, 0x000, 0x000,
+    0x001, 0x000, 0x000, 0x008, 0x010, 0x003, 0x004, 0x000, 0x000, 0x010, 0x004, 0x00D,
+    0x000, 0x000, 0x001, 0x000, 0x004, 0x001, 0x000, 0x00A, 0x001, 0x000, 0x000, 0x004,
+    0x009, 0x000, 0x00A, 0x002, 0x006, 0x000, 0x000, 0x000, 0x004, 0x005, 0x002, 0x004,
+    0x006, 0x001, 0x000, 0x002, 0x003, 0x000, 0x001, 0x006, 0x004, 0x002, 0x001, 0x000,
+    0x001, 0x000, 0x000, 0x000, 0x002, 0x000, 0x005, 0x001, 0x00C, 0x003, 0x001, 0x000,
+    0x002, 0x00D, 0x00C, 0x004, 0x004, 0x000, 0x000, 0x001, 0x000, 0x000, 0x004, 0x004,
+    0x006, 0x003, 0x004, 0x003, 0x000, 0x002, 0x000, 0x001, 0x000, 0x005, 0x000, 0x001,
+    0x00B, 0x000, 0x000, 0x003, 0x000, 0x008, 0x002, 0x000, 0x003, 0x009, 0x005, 0x002,
+    0x004, 0x000, 0x008, 0x000, 0x003, 0x001, 0x001, 0x004, 0x000, 0x000, 0x000, 0x007,
+    0x000, 0x002, 0x001, 0x000, 0x000, 0x001, 0x001, 0x000, 0x008, 0x000, 0x001, 0x002,
+    0x005, 0x000, 0x000, 0x000, 0x004, 0x001, 0x003, 0x004, 0x000, 0x007, 0x004, 0x003,
+    0x008, 0x002, 0x004, 0x000, 0x001, 0x000, 0x005, 0x000, 0x003, 0x005, 0x006, 0x004,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x001, 0x003, 0x000, 0x000, 0x000, 0x003, 0x000,
+    0x000, 0x001, 0x000, 0x001, 0x006, 0x002, 0x001, 0x001, 0x002, 0x007, 0x000, 0x007,
+    0x002, 0x002, 0x000, 0x001, 0x000, 0x007, 0x001, 0x002, 0x000, 0x001, 0x000, 0x001,
+    0x000, 0x009, 0x007, 0x000, 0x000, 0x000, 0x005, 0x001, 0x003, 0x000, 0x000, 0x013,
+    0x002, 0x00B, 0x000, 0x000, 0x001, 0x000, 0x000, 0x002, 0x000, 0x001, 0x003, 0x006,
+    0x002, 0x008, 0x004, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x001, 0x001, 0x005, 0x00B, 0x000, 0x004, 0x002, 0x000, 0x000,
+    0x001, 0x002, 0x000, 0x001, 0x000, 0x000, 0x000, 0x010, 0x000, 0x001, 0x007, 0x001,
+    0x000, 0x000, 0x005, 0x000, 0x001, 0x000, 0x003, 0x003, 0x008, 0x007, 0x002, 0x000,
+    0x003, 0x000, 0x001, 0x000, 0x000, 0x005, 0x003, 0x003, 0x005, 0x000, 0x000, 0x008,
+    0x000, 0x000, 0x000, 0x003, 0x003, 0x002, 0x001, 0x001, 0x001, 0x000, 0x001, 0x00A,
+    0x000, 0x001, 0x000, 0x002, 0x003, 0x001, 0x001, 0x000, 0x003, 0x006, 0x000, 0x000,
+    0x004, 0x001, 0x001, 0x000, 0x003, 0x000, 0x004, 0x000, 0x004, 0x003, 0x000, 0x001,
+    0x002, 0x003, 0x000, 0x001, 0x001, 0x00A, 0x002, 0x000, 0x003, 0x000, 0x001, 0x000,
+    0x003, 0x002, 0x000, 0x000, 0x000, 0x000, 0x003, 0x008, 0x000, 0x002, 0x002, 0x002,
+    0x001, 0x000, 0x002, 0x002, 0x001, 0x004, 0x00C, 0x000, 0x000, 0x004, 0x001, 0x008,
+    0x000, 0x000, 0x007, 0x001, 0x000, 0x002, 0x000, 0x000, 0x004, 0x000, 0x000, 0x001,
+    0x000, 0x00A, 0x007, 0x001, 0x000, 0x003, 0x001, 0x000, 0x000, 0x001, 0x013, 0x000,
+    0x001, 0x000, 0x010, 0x003, 0x002, 0x004, 0x000, 0x000, 0x000, 0x003, 0x000, 0x000,
+    0x005, 0x000, 0x003, 0x006, 0x000, 0x001, 0x001, 0x001, 0x002, 0x000, 0x008, 0x011,
+    0x002, 0x009, 0x000, 0x00A, 0x000, 0x00E, 0x000, 0x000, 0x001, 0x004, 0x001, 0x003,
+    0x004, 0x000, 0x002, 0x003, 0x005, 0x003, 0x000, 0x006, 0x001, 0x002, 0x003, 0x009,
+    0x000, 0x000, 0x002, 0x000, 0x005, 0x000, 0x001, 0x001, 0x002, 0x000, 0x005, 0x000,
+    0x000, 0x000, 0x001, 0x00F, 0x000, 0x001, 0x000, 0x006, 0x00A, 0x000, 0x004, 0x005,
+    0x019, 0x002, 0x005, 0x001,
+};
+
+// Slot -> codeword | (option + 1) << 24, 0 = no code.
+static const uint32_t DCS_HashTable[4096] = {
+    0x5A41EB32, 0x00000000, 0x3379AAA2, 0x333CD551, 0x5A20F599, 0x00000000, 0x00000000, 0x546972AC,
+    0x1D5D29E1, 0x00000000, 0x134184EF, 0x00000000, 0x00000000, 0x00000000, 0x5E1CD64C, 0x00000000,
+    0x00000000, 0x5C1E5133, 0x00000000, 0x2C2B66C5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C275526, 0x4D1344FD, 0x4C2A9327, 0x00000000, 0x4717DC49, 0x5E39AC98, 0x20787A0B, 0x5206E53A,
+    0x5959C662, 0x307916B0, 0x493EA4AA, 0x3C523AE3, 0x340C619F, 0x2143170F, 0x1F558EC3, 0x1705A673,
+    0x2C56CD8A, 0x00000000, 0x3D6EA951, 0x2C4556CD, 0x583330D7, 0x49752553, 0x00000000, 0x542CD2E5,
+    0x4C4EAA4C, 0x4B392D2B, 0x52741B94, 0x5B0FCCB8, 0x5C3CA266, 0x3754CB46, 0x4C55264E, 0x4D2689FA,
+    0x472FB892, 0x520DCA74, 0x581986BB, 0x033B02D9, 0x00000000, 0x5F123CD9, 0x5E735930, 0x00000000,
+    0x3418C33E, 0x4C6AA4C9, 0x2170C5C3, 0x1761699C, 0x6627706D, 0x586CCC35, 0x497D4954, 0x1937A863,
+    0x170B4CE6, 0x586661AE, 0x052BEB03, 0x00000000, 0x5459A5CA, 0x326522E7, 0x423CE485, 0x32148B9F,
+    0x00000000, 0x2B29C4F1, 0x00000000, 0x634C4E9B, 0x00000000, 0x00000000, 0x6413C93B, 0x280FD452,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x27371471, 0x00000000,
+    0x4B725A56, 0x1845DB0B, 0x4C24C9D5, 0x5C7944CC, 0x2D2DB22B, 0x482524DD, 0x22442EE9, 0x232B5711,
+    0x5B1F9970, 0x660DA9DC, 0x037605B2, 0x1073A3C1, 0x00000000, 0x3B18E675, 0x0F2E683B, 0x4D4D13F4,
+    0x00000000, 0x4E60B935, 0x475F7124, 0x165E9C2C, 0x58330D76, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x5F2479B2, 0x00000000, 0x00000000, 0x5A3D6650, 0x00000000, 0x521B94E8,
+    0x00000000, 0x665C1B53, 0x196F50C6, 0x38651F46, 0x00000000, 0x3A71C6A5, 0x0202BADE, 0x00000000,
+    0x664EE0DA, 0x3431867C, 0x00000000, 0x2544AF5A, 0x00000000, 0x00000000, 0x687620F9, 0x00000000,
+    0x0557D606, 0x4B49695B, 0x00000000, 0x00000000, 0x171699CC, 0x5006F1A5, 0x51789465, 0x4A5D2594,
+    0x3B6A6399, 0x444E5CC8, 0x4279C90A, 0x2B3C54E2, 0x00000000, 0x3229173E, 0x00000000, 0x3925A91B,
+    0x5C651333, 0x00000000, 0x035816CB, 0x44644E5C, 0x00000000, 0x2B5389E2, 0x64279276, 0x1B4351EC,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x281FA8A4, 0x0670BE81, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x39523696, 0x00000000, 0x2C3362AB, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4A52594B, 0x0C3A306B, 0x3668CDD8, 0x00000000, 0x00000000, 0x276E28E2, 0x263D844B,
+    0x02575BC0, 0x00000000, 0x5B3F32E0, 0x4927D495, 0x4C4993AA, 0x2D5B6456, 0x104E8F07, 0x2356AE22,
+    0x6879EC41, 0x1946DEA1, 0x300B5879, 0x0B37A416, 0x3B667531, 0x484A49BA, 0x210B87C3, 0x1F761D58,
+    0x155C2A87, 0x0C0C1ADD, 0x42490AF3, 0x4546762C, 0x3B31CCEA, 0x00000000, 0x661B53B8, 0x00000000,
+    0x075B6823, 0x0640F0BE, 0x00000000, 0x0F5CD076, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x4E02E4D7, 0x00000000, 0x0965414F, 0x254AF5A8, 0x3C38E91D,
+    0x4912A9F5, 0x5D785335, 0x5D335F0A, 0x4F49B6E1, 0x00000000, 0x58661AEC, 0x00000000, 0x00000000,
+    0x010E04FB, 0x2E44BBC5, 0x0D60E73C, 0x00000000, 0x4954FA92, 0x5F48F364, 0x674A6CF1, 0x00000000,
+    0x00000000, 0x00000000, 0x5A7ACCA0, 0x523729D0, 0x00000000, 0x00000000, 0x00000000, 0x2A26ACB1,
+    0x00000000, 0x00000000, 0x3007916B, 0x00000000, 0x00000000, 0x00000000, 0x31535A2D, 0x00000000,
+    0x2D15ADB2, 0x00000000, 0x00000000, 0x00000000, 0x020575BC, 0x00000000, 0x00000000, 0x2F08B3BD,
+    0x45762C8C, 0x00000000, 0x00000000, 0x00000000, 0x34630CF8, 0x193D431B, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5B1703F3, 0x00000000, 0x00000000, 0x00000000,
+    0x37354CB4, 0x500DE34A, 0x2020BF0F, 0x38147D1B, 0x23388AB5, 0x3F2AF08F, 0x5369D654, 0x0C41ADD1,
+    0x65510E9D, 0x3E1E9A16, 0x172D3398, 0x39352369, 0x3A46A5E3, 0x055606AF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x1638597A, 0x00000000, 0x00000000, 0x2B78A9C4, 0x626CE50B, 0x00000000,
+    0x6569DA21, 0x00000000, 0x060BE81E, 0x483A9493, 0x00000000, 0x32522E7C, 0x394B5236, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x5A33283D, 0x3A471A97, 0x3F047AAF, 0x00000000, 0x00000000,
+    0x311AD16D, 0x644F24EC, 0x00000000, 0x644EC9E4, 0x446644E5, 0x00000000, 0x335545E6, 0x00000000,
+    0x4B2B725A, 0x00000000, 0x685883E7, 0x52653A0D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x142ED429, 0x00000000, 0x5A141EB3, 0x5253A0DC, 0x00000000, 0x283F5148, 0x00000000,
+    0x4712FB89, 0x51625197, 0x067D03C2, 0x6168AE70, 0x00000000, 0x1B6C86A3, 0x6369B989, 0x3D1DD52A,
+    0x221885DD, 0x2C66C556, 0x564B319E, 0x2E5E2C4B, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x15543DC2, 0x4353216F, 0x00000000, 0x03016CBB, 0x3B298E67, 0x463E46B1, 0x0C7460D6, 0x542ACD2E,
+    0x00000000, 0x00000000, 0x3B1D4C73, 0x00000000, 0x267B0896, 0x5F66C923, 0x613868AE, 0x00000000,
+    0x4C49D549, 0x4267242B, 0x00000000, 0x00000000, 0x494FA92A, 0x5B7E65C0, 0x4337D321, 0x0C1835BA,
+    0x3C0E91D7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3A25E38D, 0x00000000, 0x26096F61,
+    0x627285EC, 0x00000000, 0x00000000, 0x2843F514, 0x3016B0F2, 0x00000000, 0x417BB484, 0x2A2CB14D,
+    0x00000000, 0x385947D1, 0x420AF392, 0x00000000, 0x0B6F482C, 0x00000000, 0x00000000, 0x21170F86,
+    0x44113973, 0x5C144CCF, 0x00000000, 0x3512E363, 0x3E69A163, 0x2B4F1538, 0x453233B1, 0x30358791,
+    0x1265709B, 0x3B6399D4, 0x00000000, 0x6820F9EC, 0x6636A770, 0x00000000, 0x3F3C23D5, 0x00000000,
+    0x00000000, 0x0B4DE905, 0x06503C2F, 0x00000000, 0x573A8C79, 0x00000000, 0x183B6171, 0x00000000,
+    0x00000000, 0x49553EA4, 0x121BCAE1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x1C1B626C, 0x00000000, 0x13309DF0, 0x646C9E49, 0x0F6D7341, 0x4E05C9AE, 0x00000000,
+    0x54172ACD, 0x3C71D23A, 0x00000000, 0x0642FA07, 0x00000000, 0x00000000, 0x437A642D, 0x164E165E,
+    0x4F61936D, 0x00000000, 0x33555179, 0x00000000, 0x5D66BE14, 0x6733C653, 0x0E7075A4, 0x00000000,
+    0x492553EA, 0x00000000, 0x00000000, 0x00000000, 0x614E1A2B, 0x4762497D, 0x0E03AD27, 0x026B7815,
+    0x0723B6D0, 0x00000000, 0x00000000, 0x00000000, 0x011C09F6, 0x00000000, 0x5E3261CD, 0x00000000,
+    0x00000000, 0x6205ECE5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16538597, 0x1E10E5AF,
+    0x00000000, 0x21387C31, 0x462358BE, 0x00000000, 0x00000000, 0x36233763, 0x00000000, 0x00000000,
+    0x53654D3A, 0x2F688B3B, 0x5071A50D, 0x222EE988, 0x2A4D5962, 0x1E1CB5E4, 0x526E53A0, 0x0A2DAAC1,
+    0x00000000, 0x2A35658A, 0x00000000, 0x00000000, 0x2738A38B, 0x300F22D6, 0x00000000, 0x5B01F997,
+    0x476E2497, 0x00000000, 0x401588F9, 0x2947C52D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4409CB99, 0x00000000, 0x2D2B5B64, 0x6867B107, 0x5C226679, 0x3E58F4D0, 0x360D19BB, 0x64724EC9,
+    0x1F0EC3AB, 0x020AEB78, 0x00000000, 0x00000000, 0x0A5560AD, 0x35171B19, 0x2F11677A, 0x00000000,
+    0x136F8309, 0x00000000, 0x00000000, 0x00000000, 0x3B19D4C7, 0x00000000, 0x00000000, 0x1F587563,
+    0x00000000, 0x00000000, 0x197A8636, 0x1146BD09, 0x00000000, 0x00000000, 0x264225BD, 0x00000000,
+    0x025E0575, 0x3934B523, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5763CBA8, 0x073B6D04, 0x00000000, 0x5B2E07E6, 0x00000000, 0x00000000, 0x2205DD31, 0x28290FD4,
+    0x623D9CA1, 0x20417E1E, 0x3828FA36, 0x376A9968, 0x175A6730, 0x570C7975, 0x501BC694, 0x2371156A,
+    0x5A3283D6, 0x3F55E11E, 0x46562F91, 0x00000000, 0x291F14B6, 0x1D2786E9, 0x574BA8C7, 0x5F3CD924,
+    0x00000000, 0x396A46D2, 0x3E3D342C, 0x1A555D0C, 0x1C589B0D, 0x601B4727, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x271C5B8A, 0x00000000, 0x00000000, 0x207A0BF0,
+    0x2A4B14D5, 0x3E63D342, 0x0B0B37A4, 0x5918ACE3, 0x650874ED, 0x1204DE57, 0x1670B2F4, 0x5125197C,
+    0x546559A5, 0x1C26C36C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x6344E9B9, 0x00000000, 0x00000000, 0x00000000, 0x48752926, 0x0617D03C, 0x00000000, 0x041A3F03,
+    0x00000000, 0x6023939B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x223A6217, 0x0A5582B6,
+    0x081C7EC1, 0x344F8C61, 0x00000000, 0x00000000, 0x5A66507A, 0x00000000, 0x145A852B, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x3F08F55E, 0x00000000, 0x205F87A0, 0x41109EED, 0x321173E5,
+    0x3135A2DA, 0x0530357D, 0x635CC4E9, 0x43642DF4, 0x00000000, 0x00000000, 0x2B44F153, 0x2854521F,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4008F92B, 0x5938CC56, 0x444B9913,
+    0x1B351EC8, 0x4B56E4B4, 0x142576A1, 0x0E2D2707, 0x125E5709, 0x240E893D, 0x162CBD38, 0x00000000,
+    0x1F61D58E, 0x0915053F, 0x3322F355, 0x00000000, 0x00000000, 0x3658D19B, 0x00000000, 0x31516D35,
+    0x00000000, 0x00000000, 0x00000000, 0x145DA852, 0x287EA290, 0x4E4D705C, 0x43216FA6, 0x364DD8D1,
+    0x58186BB3, 0x00000000, 0x122E1379, 0x5D614CD7, 0x00000000, 0x00000000, 0x5A283D66, 0x3E50B1E9,
+    0x00000000, 0x00000000, 0x00000000, 0x40792B11, 0x2107C317, 0x4725F712, 0x3D3BAA54, 0x00000000,
+    0x260896F6, 0x00000000, 0x00000000, 0x027815D6, 0x111AF426, 0x00000000, 0x00000000, 0x6629DC1B,
+    0x00000000, 0x00000000, 0x00000000, 0x1E16BC87, 0x22310BBA, 0x00000000, 0x0D039CF3, 0x564F4B31,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x047819A3, 0x0302D976, 0x5021BC69, 0x241E8E89, 0x54559A5C, 0x513E2519, 0x0A60ADAA, 0x0403347E,
+    0x467C8D62, 0x1D4374A7, 0x011F6381, 0x3B531CCE, 0x0E1383AD, 0x2C6C556C, 0x1931B7A8, 0x3B3A98E6,
+    0x677194D9, 0x00000000, 0x00000000, 0x00000000, 0x4109EED2, 0x374B46A9, 0x00000000, 0x00000000,
+    0x4F326DB8, 0x4645F235, 0x00000000, 0x6170D15C, 0x00000000, 0x2E312EF1, 0x5A6B3283, 0x00000000,
+    0x00000000, 0x00000000, 0x32173E52, 0x00000000, 0x232E22AD, 0x500D286F, 0x436FA642, 0x00000000,
+    0x00000000, 0x225310BB, 0x653443A7, 0x00000000, 0x0C306B74, 0x00000000, 0x35464B8D, 0x00000000,
+    0x00000000, 0x3F57847A, 0x3C1D23AE, 0x0B59BD20, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x17699CC2, 0x00000000, 0x3A4BC71A, 0x2612DEC2, 0x00000000, 0x2575A895, 0x00000000, 0x4C327552,
+    0x00000000, 0x0D730739, 0x481BA949, 0x00000000, 0x00000000, 0x452C8CEC, 0x1C5B1361, 0x00000000,
+    0x302D61E4, 0x2A59629A, 0x572EA31E, 0x1226F2B8, 0x2005F87A, 0x6543A768, 0x00000000, 0x0F3B5CD0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5F4923CD, 0x00000000, 0x4658BE46,
+    0x62217B39, 0x4215E724, 0x00000000, 0x00000000, 0x503C6943, 0x212E1F0C, 0x0E527075, 0x2355C455,
+    0x00000000, 0x5C28999E, 0x442272E6, 0x1719CC2D, 0x4558B233, 0x00000000, 0x3525C6C6, 0x171CC2D3,
+    0x334D5517, 0x306B0F22, 0x2630896F, 0x45646762, 0x00000000, 0x00000000, 0x134EF830, 0x00000000,
+    0x11684C6B, 0x6841F3D8, 0x46358BE4, 0x00000000, 0x1A557432, 0x1C61B626, 0x00000000, 0x00000000,
+    0x666D4EE0, 0x00000000, 0x54395669, 0x00000000, 0x2A453565, 0x080FD827, 0x3F7847AA, 0x00000000,
+    0x412427BB, 0x1C626C36, 0x00000000, 0x00000000, 0x2423A24F, 0x0317605B, 0x123795C2, 0x340C33E3,
+    0x36337634, 0x3328BCD5, 0x5571CAD0, 0x31345B4D, 0x1876C2E2, 0x577518F2, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x2D5915AD, 0x00000000, 0x00000000, 0x00000000, 0x4B695B92, 0x00000000,
+    0x00000000, 0x00000000, 0x29714B63, 0x536B2A69, 0x00000000, 0x2E2C4BBC, 0x00000000, 0x00000000,
+    0x270A38B7, 0x00000000, 0x1E5790E5, 0x350D8C97, 0x631D3731, 0x174C2D33, 0x253D6A25, 0x1C36C4D8,
+    0x4E0B935C, 0x13613BE0, 0x164BD385, 0x00000000, 0x1F0EAC76, 0x3D6A951D, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x2D36456B, 0x542E559A, 0x2A314D59, 0x0953F2A0, 0x0C5BA306,
+    0x1378309D, 0x332A2F35, 0x00000000, 0x0158E04F, 0x312D16D3, 0x00000000, 0x00000000, 0x5572B438,
+    0x327CA45C, 0x2E5DE2C4, 0x2A2C5356, 0x0501ABEB, 0x00000000, 0x1118D7A1, 0x00000000, 0x112635E8,
+    0x67678CA6, 0x00000000, 0x6233942F, 0x2F5E88B3, 0x00000000, 0x00000000, 0x624E50BD, 0x00000000,
+    0x68441F3D, 0x53275953, 0x00000000, 0x494AA7D4, 0x00000000, 0x00000000, 0x097CA829, 0x00000000,
+    0x14214AED, 0x00000000, 0x00000000, 0x5014378D, 0x00000000, 0x00000000, 0x0E075A4E, 0x00000000,
+    0x48137529, 0x1A4AABA1, 0x00000000, 0x5B665C0F, 0x07476DA0, 0x00000000, 0x013813EC, 0x4A25D259,
+    0x00000000, 0x0D39E60E, 0x1A2BA195, 0x00000000, 0x5E64C39A, 0x245127A3, 0x531D654D, 0x00000000,
+    0x6313A6E6, 0x372354CB, 0x00000000, 0x620BD9CA, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x563319E9, 0x00000000, 0x00000000, 0x00000000, 0x1E21CB5E, 0x00000000, 0x00000000,
+    0x4545919D, 0x00000000, 0x00000000, 0x3868D947, 0x00000000, 0x00000000, 0x4646B17C, 0x00000000,
+    0x36466EC6, 0x6412764F, 0x2B62A713, 0x00000000, 0x4D69344F, 0x14052BB5, 0x00000000, 0x4A594BA4,
+    0x2170F862, 0x6064E6D1, 0x00000000, 0x3D28EEA9, 0x225DD310, 0x00000000, 0x00000000, 0x00000000,
+    0x1E396BC8, 0x3C6B8E91, 0x65768874, 0x00000000, 0x5D0A66BE, 0x0A5B5582, 0x65276887, 0x00000000,
+    0x00000000, 0x2A6ACB14, 0x301E45AC, 0x5E073593, 0x00000000, 0x29363E29, 0x00000000, 0x4F6E1936,
+    0x594662B3, 0x27714716, 0x0A560ADA, 0x2043D05F, 0x5E6B261C, 0x521D06E5, 0x1830B8BB, 0x5B03F32E,
+    0x00000000, 0x343E3186, 0x00000000, 0x00000000, 0x402B11F2, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x1B28F643, 0x66036A77, 0x00000000, 0x5A0F5994, 0x5F6C923C, 0x00000000, 0x00000000,
+    0x5C33CA26, 0x2D56B6C8, 0x1838BB61, 0x1A2E8655, 0x05357D60, 0x4A174965, 0x146A14AE, 0x44139732,
+    0x44191397, 0x5C44CCF2, 0x00000000, 0x0D679839, 0x4F5B70C9, 0x1B10D47B, 0x4D513F49, 0x361A3376,
+    0x1F1D8756, 0x0215D6F0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2E71625D, 0x00000000,
+    0x3048B587, 0x01604FB1, 0x00000000, 0x2637B089, 0x00000000, 0x2F22CEF4, 0x352E3632, 0x51465F12,
+    0x00000000, 0x207E1E82, 0x47492FB8, 0x34631867, 0x451D8B23, 0x00000000, 0x00000000, 0x00000000,
+    0x531A7595, 0x196DEA18, 0x1542A87B, 0x3B33A98E, 0x00000000, 0x370D532D, 0x637313A6, 0x00000000,
+    0x00000000, 0x2D6B6C8A, 0x6413B279, 0x3F47AAF0, 0x00000000, 0x5214E837, 0x3D52A3BA, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x39696A46, 0x00000000, 0x411EED21, 0x00000000, 0x2162E1F0, 0x220BBA62,
+    0x5933159C, 0x28521FA8, 0x2C6CD8AA, 0x56467A59, 0x2851487E, 0x60347273, 0x48493752, 0x427242BC,
+    0x00000000, 0x564C67A5, 0x5B5C0FCC, 0x363B1A33, 0x00000000, 0x00000000, 0x582ECCC3, 0x0776DA08,
+    0x2B13C54E, 0x315B4D68, 0x130C277C, 0x3C23AE3A, 0x49292A9F, 0x1023C1E7, 0x00000000, 0x1E072D79,
+    0x3F6ABC23, 0x5550E395, 0x442E644E, 0x3851F46C, 0x50378D28, 0x627B3942, 0x195431B7, 0x113D098D,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x293E296C, 0x00000000, 0x4B5B92D2, 0x5718F2EA,
+    0x00000000, 0x00000000, 0x5A6507AC, 0x201E82FC, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5109465F, 0x0B02CDE9, 0x5F79B248, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x6122B9C3, 0x1B321A8F, 0x00000000, 0x06740F0B, 0x3E7A6858, 0x12795C26, 0x1521EE15,
+    0x6326E627, 0x1D253C37, 0x5835D998, 0x36376346, 0x43190B7D, 0x4D4FD268, 0x1F58EC3A, 0x60368E4E,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2D48AD6D, 0x00000000, 0x552D0E39, 0x413B484F,
+    0x00000000, 0x1D4F0DD2, 0x190C6DEA, 0x2C1B155B, 0x2738B714, 0x00000000, 0x00000000, 0x00000000,
+    0x3663466E, 0x593159C6, 0x592B38CC, 0x00000000, 0x0B166F48, 0x3145B4D6, 0x2F33BD11, 0x396D2D48,
+    0x5772EA31, 0x0736823B, 0x1209BCAE, 0x0F0ED734, 0x00000000, 0x5220DCA7, 0x6510E9DA, 0x514A32F8,
+    0x1041E747, 0x6066D1C9, 0x1313BE0C, 0x1C4D86D8, 0x2745B8A3, 0x12613795, 0x00000000, 0x00000000,
+    0x415A427B, 0x5D266BE1, 0x551C72B4, 0x00000000, 0x1476A14A, 0x00000000, 0x2E0B12EF, 0x095053F2,
+    0x00000000, 0x00000000, 0x40623E4A, 0x00000000, 0x00000000, 0x0F4D076B, 0x00000000, 0x1E65AF21,
+    0x04347E06, 0x3D23BAA5, 0x4047C958, 0x321F2917, 0x2E1778B1, 0x00000000, 0x4E35C172, 0x062FA078,
+    0x00000000, 0x42215E72, 0x00000000, 0x60472736, 0x00000000, 0x0C51835B, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2274C42E, 0x651DA21D, 0x00000000,
+    0x00000000, 0x00000000, 0x0838FD82, 0x5E1AC987, 0x00000000, 0x266C225B, 0x5A03D665, 0x5F1B248F,
+    0x07411DB6, 0x00000000, 0x00000000, 0x383E8D94, 0x33735545, 0x3E42C7A6, 0x00000000, 0x00000000,
+    0x00000000, 0x5452E559, 0x00000000, 0x421C90AF, 0x0365D816, 0x3F11EABC, 0x00000000, 0x1D3A53C3,
+    0x00000000, 0x41213DDA, 0x2118B87C, 0x00000000, 0x00000000, 0x130309DF, 0x3222E7CA, 0x2958F8A5,
+    0x316B45B4, 0x00000000, 0x00000000, 0x05606AFA, 0x2F77A22C, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4D13F49A, 0x5B799703, 0x580D7666, 0x00000000, 0x00000000, 0x247449E8, 0x00000000,
+    0x391B4B52, 0x590ACE33, 0x0F03B5CD, 0x00000000, 0x1E3C872D, 0x00000000, 0x084138FD, 0x4D7A4D13,
+    0x00000000, 0x1842E2ED, 0x2070F417, 0x4011F256, 0x00000000, 0x597198AC, 0x00000000, 0x00000000,
+    0x241D127A, 0x144AED42, 0x1B6A3D90, 0x0E5A4E0E, 0x00000000, 0x00000000, 0x59338CC5, 0x21062E1F,
+    0x30722D61, 0x3C2475C7, 0x2F1DE88B, 0x3478C619, 0x456762C8, 0x3D5D52A3, 0x16597A70, 0x2C2D9B15,
+    0x00000000, 0x505286F1, 0x00000000, 0x1F2B1D87, 0x3345E6AA, 0x00000000, 0x496A4AA7, 0x0C35BA30,
+    0x402C47C9, 0x092A0A7E, 0x00000000, 0x2C0AAD9B, 0x00000000, 0x374CB46A, 0x624A17B3, 0x5C333CA2,
+    0x00000000, 0x00000000, 0x563D2CC6, 0x107079D1, 0x00000000, 0x4C1D5499, 0x0A056D56, 0x073411DB,
+    0x416ED213, 0x3729968D, 0x4342DF4C, 0x52683729, 0x5C266794, 0x101E7478, 0x2C2AB66C, 0x2308AB57,
+    0x5830D766, 0x00000000, 0x00000000, 0x00000000, 0x4C2A4C9D, 0x00000000, 0x125C26F2, 0x00000000,
+    0x00000000, 0x5E66B261, 0x00000000, 0x00000000, 0x5D2F8533, 0x5A507ACC, 0x00000000, 0x67194D9E,
+    0x210F862E, 0x00000000, 0x00000000, 0x00000000, 0x3D7754A8, 0x21618B87, 0x1B23D90D, 0x2C55B362,
+    0x474BEE24, 0x5C4F2899, 0x4C554993, 0x0B3D20B3, 0x1742D339, 0x5859986B, 0x4617C8D6, 0x54566972,
+    0x26112DEC, 0x2C62AB66, 0x00000000, 0x497A92A9, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x1135E84C, 0x584CC35D, 0x6653B836, 0x00000000, 0x00000000, 0x54334B95, 0x4C755264, 0x0A15B558,
+    0x00000000, 0x0555F581, 0x00000000, 0x324A45CF, 0x1A3A1955, 0x00000000, 0x1E2D790E, 0x2B54E278,
+    0x275B8A38, 0x3E26858F, 0x22621774, 0x2322AD5C, 0x63189D37, 0x4C5264EA, 0x0D0739E6, 0x1862ED85,
+    0x1D0DD29E, 0x00000000, 0x1079D1E0, 0x3B4C733A, 0x2925B1F1, 0x00000000, 0x1215C26F, 0x253512BD,
+    0x3B0E6753, 0x00000000, 0x060F0BE8, 0x00000000, 0x00000000, 0x00000000, 0x666E0DA9, 0x00000000,
+    0x243D1D12, 0x00000000, 0x00000000, 0x0305B2EC, 0x00000000, 0x504378D2, 0x517C4A32, 0x4B64B4AD,
+    0x3B7531CC, 0x013EC702, 0x00000000, 0x180BB617, 0x040668FC, 0x036C0B65, 0x00000000, 0x5C728999,
+    0x19636F50, 0x00000000, 0x00000000, 0x22085DD3, 0x00000000, 0x00000000, 0x00000000, 0x091F9505,
+    0x265EC225, 0x4A14BA4B, 0x00000000, 0x0C5D1835, 0x0E27075A, 0x687CF620, 0x10674783, 0x00000000,
+    0x00000000, 0x00000000, 0x3045AC3C, 0x00000000, 0x156E1543, 0x4D1A27E9, 0x372D1AA6, 0x00000000,
+    0x00000000, 0x00000000, 0x4113DDA4, 0x163D3859, 0x1A0CAABA, 0x473EE249, 0x00000000, 0x4E41726B,
+    0x5D7C299A, 0x4F64DB70, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x67653678, 0x0147027D,
+    0x00000000, 0x00000000, 0x2E625DE2, 0x2F0B3BD1, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3538D8C9, 0x322E7CA4, 0x00000000, 0x195EA18D,
+    0x00000000, 0x501A50DE, 0x5B4B81F9, 0x00000000, 0x235C455A, 0x384A3E8D, 0x663836A7, 0x20505F87,
+    0x6568874E, 0x00000000, 0x00000000, 0x00000000, 0x661DC1B5, 0x5132F894, 0x00000000, 0x0C60D6E8,
+    0x00000000, 0x6574ED10, 0x00000000, 0x00000000, 0x25095EB5, 0x00000000, 0x5A59941E, 0x3A638D4B,
+    0x00000000, 0x686C41F3, 0x3C3A475C, 0x00000000, 0x1B1EC86A, 0x2E6F1625, 0x00000000, 0x213E18B8,
+    0x35192E36, 0x052FAC0D, 0x0F35CD07, 0x610D15CE, 0x64327927, 0x517128CB, 0x1B764351, 0x47497DC4,
+    0x436990B7, 0x4B12D2B7, 0x224C42EE, 0x4A3A4B29, 0x465F2358, 0x3B4EA639, 0x3B54C733, 0x2625BD84,
+    0x00000000, 0x441CB991, 0x00000000, 0x00000000, 0x3030F22D, 0x42739215, 0x00000000, 0x4C64EAA4,
+    0x00000000, 0x00000000, 0x3A52F1C6, 0x2644B7B0, 0x3C4748EB, 0x00000000, 0x00000000, 0x48375292,
+    0x00000000, 0x00000000, 0x354971B1, 0x03302D97, 0x455919D8, 0x44489CB9, 0x2B2713C5, 0x5C4A2667,
+    0x0B66F482, 0x200BF0F4, 0x575D463C, 0x305AC3C8, 0x1B06A3D9, 0x00000000, 0x124DE570, 0x160597A7,
+    0x00000000, 0x00000000, 0x00000000, 0x3F5E11EA, 0x00000000, 0x00000000, 0x0F76B9A0, 0x4F064DB7,
+    0x437D3216, 0x00000000, 0x00000000, 0x06617D03, 0x00000000, 0x00000000, 0x5D1AF853, 0x00000000,
+    0x00000000, 0x00000000, 0x39246D2D, 0x61670D15, 0x0E41D693, 0x00000000, 0x00000000, 0x00000000,
+    0x6242F672, 0x422BCE48, 0x1104C6BD, 0x1E4872D7, 0x4E2E0B93, 0x151543DC, 0x3A2F1C6A, 0x36519BB1,
+    0x215C3E18, 0x5078D286, 0x2F74459D, 0x00000000, 0x0A56D560, 0x275C51C5, 0x00000000, 0x4A24B297,
+    0x00000000, 0x470925F7, 0x4444E5CC, 0x5C51333C, 0x0423F033, 0x00000000, 0x1733985A, 0x101D1E0F,
+    0x00000000, 0x190DBD43, 0x354B8D8C, 0x022EB781, 0x00000000, 0x6873D883, 0x173985A6, 0x3B4CEA63,
+    0x1F6C3AB1, 0x00000000, 0x00000000, 0x2D36C8AD, 0x266112DE, 0x4B1695B9, 0x4C132755, 0x022DE057,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x466B17C8, 0x00000000, 0x00000000, 0x00000000, 0x421215E7, 0x1538550F, 0x48149375, 0x1C6C4D86,
+    0x232D5C45, 0x450CEC59, 0x00000000, 0x00000000, 0x2A658A6A, 0x3F3D5784, 0x00000000, 0x594C5671,
+    0x00000000, 0x5472ACD2, 0x00000000, 0x00000000, 0x636274DC, 0x0D1CE798, 0x0736D047, 0x0601E17D,
+    0x6051C9CD, 0x00000000, 0x0F39A0ED, 0x225D310B, 0x00000000, 0x00000000, 0x00000000, 0x081FB04E,
+    0x1D374A78, 0x650E9DA2, 0x2B6278A9, 0x41484F76, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x286A290F, 0x4465CC89, 0x032EC0B6, 0x5F248F36, 0x341867C6, 0x2447449E, 0x583B330D, 0x126F2B84,
+    0x3666EC68, 0x3168B69A, 0x094A829F, 0x366C68CD, 0x335179AA, 0x2515EB51, 0x00000000, 0x00000000,
+    0x584C35D9, 0x4F136DC3, 0x5D70A66B, 0x125709BC, 0x48294937, 0x00000000, 0x00000000, 0x407C9588,
+    0x00000000, 0x00000000, 0x6654EE0D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0D41CE79,
+    0x063C2FA0, 0x244F4744, 0x00000000, 0x047C0CD1, 0x4929F525, 0x3C0EB8E9, 0x4662F91A, 0x3B399D4C,
+    0x6714D9E3, 0x6778CA6C, 0x5F11E6C9, 0x0E49C1D6, 0x00000000, 0x1D61BA53, 0x531534EB, 0x2E09778B,
+    0x00000000, 0x4924AA7D, 0x5A759941, 0x2E589778, 0x00000000, 0x00000000, 0x00000000, 0x50469437,
+    0x2714716E, 0x23571156, 0x2F222CEF, 0x00000000, 0x00000000, 0x00000000, 0x100F079D, 0x351B192E,
+    0x257AD44A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0316CBB0, 0x44399139, 0x1C6D89B0,
+    0x3126B45B, 0x52394E83, 0x1F1D58EC, 0x00000000, 0x00000000, 0x633A6E62, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x4E1726B8, 0x00000000, 0x00000000, 0x00000000, 0x174CE616, 0x505E34A1,
+    0x00000000, 0x0847EC13, 0x00000000, 0x00000000, 0x11742635, 0x00000000, 0x00000000, 0x00000000,
+    0x456C5919, 0x545CAB34, 0x2A629AB2, 0x00000000, 0x671B3C65, 0x00000000, 0x00000000, 0x182ED85C,
+    0x344619F1, 0x3335545E, 0x315A2DA6, 0x00000000, 0x33545E6A, 0x2D6C8AD6, 0x4738925F, 0x0419A3F0,
+    0x00000000, 0x00000000, 0x00000000, 0x2978A5B1, 0x00000000, 0x00000000, 0x1E6BC872, 0x255EB512,
+    0x00000000, 0x00000000, 0x050357D6, 0x00000000, 0x0A35582B, 0x00000000, 0x133BE0C2, 0x2A58A6AC,
+    0x00000000, 0x00000000, 0x1131AF42, 0x00000000, 0x114C6BD0, 0x00000000, 0x2221774C, 0x5E187359,
+    0x00000000, 0x6259CA17, 0x00000000, 0x65221D3B, 0x6807CF62, 0x5353ACA9, 0x0C035BA3, 0x6267285E,
+    0x097E5414, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4849BA94, 0x08271FB0, 0x00000000,
+    0x4A52E92C, 0x32245CF9, 0x534EB2A6, 0x3A0D4BC7, 0x3751AA65, 0x00000000, 0x052C0D5F, 0x1A55D0CA,
+    0x00000000, 0x00000000, 0x00000000, 0x3E342C7A, 0x00000000, 0x23156AE2, 0x00000000, 0x4562C8CE,
+    0x38746CA3, 0x64493B27, 0x2B715389, 0x681EC41F, 0x5633D2CC, 0x60727368, 0x50286F1A, 0x00000000,
+    0x6553B443, 0x3C75C748, 0x00000000, 0x144295DA, 0x00000000, 0x0E0EB49C, 0x2A14D596, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3916A46D, 0x00000000, 0x4826EA52, 0x00000000,
+    0x00000000, 0x00000000, 0x24093D1D, 0x00000000, 0x610AE70D, 0x00000000, 0x00000000, 0x4A4BA4B2,
+    0x1A57432A, 0x444C89CB, 0x185C5DB0, 0x4D689FA4, 0x641D93C9, 0x1B486A3D, 0x265BD844, 0x0D73CC1C,
+    0x3A0E352F, 0x017027D8, 0x1507B855, 0x00000000, 0x533ACA9A, 0x00000000, 0x00000000, 0x00000000,
+    0x133E0C27, 0x631B989D, 0x641E49D9, 0x63274DCC, 0x332A8BCD, 0x4012B11F, 0x3746A996, 0x6217B394,
+    0x00000000, 0x524A741B, 0x683107CF, 0x1D14F0DD, 0x00000000, 0x00000000, 0x00000000, 0x414F7690,
+    0x1A32AAE8, 0x00000000, 0x605A3939, 0x56633D2C, 0x566633D2, 0x00000000, 0x365D8D19, 0x58576661,
+    0x00000000, 0x00000000, 0x196A18DB, 0x00000000, 0x1E4396BC, 0x292D8F8A, 0x1051E0F3, 0x3D2A3BAA,
+    0x115E84C6, 0x00000000, 0x522741B9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4F36DC32, 0x5144A32F, 0x00000000, 0x2E3C5897, 0x1B590D47, 0x61515CE1, 0x00000000, 0x00000000,
+    0x63537313, 0x53269D65, 0x6424EC9E, 0x2D6456B6, 0x416D213D, 0x067A0785, 0x1D529E1B, 0x00000000,
+    0x140A576A, 0x2C4D8AAD, 0x00000000, 0x5616633D, 0x00000000, 0x00000000, 0x553438E5, 0x340CF8C6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15287B85, 0x432642DF,
+    0x2762DC51, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2F2CEF44, 0x00000000,
+    0x2E4BBC58, 0x324F948B, 0x3D51DD52, 0x00000000, 0x1E72D790, 0x0B1059BD, 0x00000000, 0x0C68C1AD,
+    0x00000000, 0x00000000, 0x00000000, 0x5D14CD7C, 0x00000000, 0x570F2EA3, 0x654ED10E, 0x6039B472,
+    0x5F4D9247, 0x00000000, 0x5434B956, 0x2676112D, 0x00000000, 0x00000000, 0x00000000, 0x5E0E6B26,
+    0x00000000, 0x296C7C52, 0x00000000, 0x424E4857, 0x4C13AA93, 0x00000000, 0x00000000, 0x5203729D,
+    0x303C8B58, 0x592CE331, 0x5B7CCB81, 0x491F5255, 0x1E5E4396, 0x00000000, 0x0F41DAE6, 0x4D7D2689,
+    0x523A0DCA, 0x372A65A3, 0x08609C7E, 0x18617176, 0x5B07E65C, 0x59456719, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x347C630C, 0x1730B4CE, 0x00000000, 0x2F4EF445, 0x50694378, 0x00000000,
+    0x405623E4, 0x2807EA29, 0x00000000, 0x00000000, 0x62650BD9, 0x00000000, 0x00000000, 0x00000000,
+    0x41776909, 0x234455AB, 0x075A08ED, 0x00000000, 0x10783CE8, 0x6606D4EE, 0x00000000, 0x00000000,
+    0x00000000, 0x162F4E16, 0x5D57C299, 0x00000000, 0x00000000, 0x00000000, 0x1B51EC86, 0x5A1EB328,
+    0x5C67944C, 0x38328FA3, 0x02015D6F, 0x0B5E9059, 0x00000000, 0x00000000, 0x252257AD, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x4A2E92CA, 0x44272E64, 0x2B1E2A71, 0x056AFAC0, 0x1A5D0CAA,
+    0x3E5342C7, 0x4432272E, 0x187176C2, 0x1B21A8F6, 0x00000000, 0x00000000, 0x124AE137, 0x2952D8F8,
+    0x255A895E, 0x39291B4B, 0x667706D4, 0x3B4733A9, 0x363466EC, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x022BADE0, 0x00000000, 0x1F3B0EAC, 0x00000000, 0x00000000, 0x0B1BD20B, 0x094FCA82,
+    0x45233B16, 0x4A4A5D25, 0x266F6112, 0x00000000, 0x00000000, 0x0C6E8C1A, 0x15770AA1, 0x0620785F,
+    0x00000000, 0x00000000, 0x25257AD4, 0x00000000, 0x00000000, 0x5D19AF85, 0x00000000, 0x0163813E,
+    0x0D30739E, 0x00000000, 0x2F459DE8, 0x492A7D49, 0x355C6C64, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x5B65C0FC, 0x20682FC3, 0x00000000, 0x00000000, 0x2D0AD6D9, 0x00000000,
+    0x453B1646, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x64593C93, 0x5334EB2A, 0x1B7B21A8, 0x2E778B12, 0x3E0F4D0B, 0x0605F40F, 0x3B67531C, 0x4374C85B,
+    0x00000000, 0x161C2CBD, 0x00000000, 0x30587916, 0x00000000, 0x3C63A475, 0x371AA65A, 0x0F5AE683,
+    0x00000000, 0x00000000, 0x642764F2, 0x3564B8D8, 0x00000000, 0x1642CBD3, 0x332AA2F3, 0x00000000,
+    0x4B15B92D, 0x00000000, 0x00000000, 0x00000000, 0x5229D06E, 0x4F4326DB, 0x5D4D7C29, 0x00000000,
+    0x3D0EEA95, 0x562598CF, 0x063E81E1, 0x61345738, 0x4E5705C9, 0x1E64396B, 0x0E60EB49, 0x1142635E,
+    0x6173868A, 0x2F7A22CE, 0x54156697, 0x152A1EE1, 0x00000000, 0x00000000, 0x0451F819, 0x611C3457,
+    0x474492FB, 0x00000000, 0x00000000, 0x0256F02B, 0x00000000, 0x00000000, 0x00000000, 0x4B4B4ADC,
+    0x00000000, 0x2821FA8A, 0x623942F6, 0x00000000, 0x00000000, 0x00000000, 0x413DDA42, 0x420579C9,
+    0x2B278A9C, 0x00000000, 0x59662B38, 0x6068E4E6, 0x00000000, 0x68107CF6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x226E9885, 0x00000000, 0x00000000, 0x492A9F52, 0x00000000, 0x00000000,
+    0x2B713C54, 0x1C0DB136, 0x28751487, 0x4472E644, 0x00000000, 0x585D9986, 0x16270B2F, 0x36763466,
+    0x4854A49B, 0x00000000, 0x00000000, 0x0E383AD2, 0x00000000, 0x00000000, 0x666A7706, 0x00000000,
+    0x0711DB68, 0x047E0668, 0x13184EF8, 0x00000000, 0x1D70DD29, 0x2F511677, 0x534A9A75, 0x3C475C74,
+    0x4611AC5F, 0x4952553E, 0x00000000, 0x104783CE, 0x50634A1B, 0x221774C4, 0x1E0E5AF2, 0x5332A69D,
+    0x00000000, 0x2A1AB2C5, 0x00000000, 0x00000000, 0x525CA741, 0x445CC89C, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x506F1A50, 0x3E2C7A68, 0x00000000, 0x00000000, 0x117A131A, 0x00000000,
+    0x00000000, 0x00000000, 0x674D9E32, 0x00000000, 0x00000000, 0x00000000, 0x0863F609, 0x475C492F,
+    0x00000000, 0x297C52D8, 0x00000000, 0x281487EA, 0x071DB682, 0x0A5AAC15, 0x5731E5D4, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x290F8A5B, 0x5E4C39AC, 0x5A1941EB, 0x00000000, 0x00000000,
+    0x1A2AAE86, 0x00000000, 0x5F1E6C92, 0x00000000, 0x00000000, 0x203D05F8, 0x270E2DC5, 0x3768D532,
+    0x3E31E9A1, 0x387A3651, 0x00000000, 0x51128CBE, 0x1C1361B6, 0x684F620F, 0x0B059BD2, 0x64649D93,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0A2AC15B,
+    0x00000000, 0x00000000, 0x24449E8E, 0x61457386, 0x1B64351E, 0x00000000, 0x202FC3D0, 0x00000000,
+    0x433216FA, 0x00000000, 0x1543DC2A, 0x00000000, 0x4049588F, 0x00000000, 0x135F0613, 0x591C662B,
+    0x1B1A8F64, 0x16165E9C, 0x634DCC4E, 0x1D4A786E, 0x366EC68C, 0x1F30EAC7, 0x606D1C9C, 0x586BB330,
+    0x1068F079, 0x4310B7D3, 0x00000000, 0x4E26B82E, 0x19750C6D, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x110D7A13, 0x00000000, 0x1D694F0D, 0x53534EB2, 0x26044B7B, 0x023C0AEB,
+    0x00000000, 0x00000000, 0x00000000, 0x4176909E, 0x00000000, 0x00000000, 0x555A1C72, 0x00000000,
+    0x27716E28, 0x00000000, 0x0A3056D5, 0x04019A3F, 0x3267CA45, 0x1918DBD4, 0x0B482CDE, 0x2C362AB6,
+    0x00000000, 0x57479751, 0x4104F769, 0x00000000, 0x4F1936DC, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x320B9F29, 0x00000000, 0x00000000, 0x59567198, 0x5241B94E, 0x00000000, 0x5962B38C,
+    0x0B2CDE90, 0x3F2BC23D, 0x375532D1, 0x4C193AA9, 0x4D7E9344, 0x1734CE61, 0x00000000, 0x2F677A22,
+    0x2002FC3D, 0x45164676, 0x076D0476, 0x00000000, 0x1213795C, 0x23622AD5, 0x5717518F, 0x0F1DAE68,
+    0x00000000, 0x00000000, 0x462C5F23, 0x5D6BE14C, 0x00000000, 0x6521D3B4, 0x0240AEB7, 0x25512BD6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13277C18,
+    0x1C30DB13, 0x39548DA5, 0x1A2ABA19, 0x461AC5F2, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4A652E92, 0x5D4CD7C2, 0x1C31361B, 0x00000000, 0x5538E568, 0x157B8550, 0x00000000, 0x3619BB1A,
+    0x00000000, 0x2E1625DE, 0x4B34ADC9, 0x00000000, 0x00000000, 0x00000000, 0x207417E1, 0x2D456B6C,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1F07563B, 0x3E47A685, 0x00000000,
+    0x00000000, 0x00000000, 0x0929F950, 0x00000000, 0x55395A1C, 0x00000000, 0x00000000, 0x0C2DD183,
+    0x2E2EF162, 0x323E522E, 0x4B4ADC96, 0x2A1629AB, 0x3D47754A, 0x166165E9, 0x065F40F0, 0x1E721CB5,
+    0x544AB34B, 0x00000000, 0x4E6B82E4, 0x15550F70, 0x0468FC0C, 0x5652CC67, 0x00000000, 0x11131AF4,
+    0x00000000, 0x00000000, 0x00000000, 0x4242BCE4, 0x0D1CF307, 0x00000000, 0x00000000, 0x00000000,
+    0x6309D373, 0x00000000, 0x22774C42, 0x00000000, 0x00000000, 0x287A8A43, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x486A524D, 0x4A2CA5D2, 0x00000000, 0x00000000, 0x1D786E94,
+    0x653B443A, 0x00000000, 0x00000000, 0x5359534E, 0x00000000, 0x4648D62F, 0x5D05335F, 0x00000000,
+    0x5E35930E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0871FB04, 0x4F370C9B, 0x0A2B056D,
+    0x00000000, 0x00000000, 0x5A4CA0F5, 0x00000000, 0x341F18C3, 0x5A07ACCA, 0x5F36491E, 0x0A6D560A,
+    0x387D1B28, 0x14350A57, 0x274716E2, 0x051ABEB0, 0x00000000, 0x5C19E513, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x51232F89, 0x00000000,
+    0x203F0F41, 0x472497DC, 0x43485BE9, 0x4064AC47, 0x594E3315, 0x1936F50C, 0x633989D3, 0x00000000,
+    0x1074783C, 0x2D35B645, 0x00000000, 0x00000000, 0x1D74A786, 0x3F23D578, 0x3D2951DD, 0x00000000,
+    0x2C366C55, 0x59198ACE, 0x2B09E2A7, 0x4239215E, 0x213170F8, 0x48249BA9, 0x0440CD1F, 0x2828A43F,
+    0x00000000, 0x130613BE, 0x41427BB4, 0x312DA6B4, 0x3C11D71D, 0x3245CF94, 0x0A582B6A, 0x3273E522,
+    0x44173227, 0x00000000, 0x00000000, 0x00000000, 0x4C4C9D54, 0x00000000, 0x00000000, 0x4B2DC969,
+    0x00000000, 0x00000000, 0x0260575B, 0x200F417E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x123CAE13, 0x4D27E934, 0x1C586D89, 0x00000000, 0x190636F5, 0x1F2C761D, 0x581AECCC, 0x361BB1A3,
+    0x00000000, 0x00000000, 0x00000000, 0x4B5A56E4, 0x00000000, 0x1F43AB1D, 0x00000000, 0x00000000,
+    0x0F076B9A, 0x3122DA6B, 0x59159C66, 0x393696A4, 0x00000000, 0x3631A337, 0x092829F9, 0x0C56E8C1,
+    0x1E790E5A, 0x1309DF06, 0x143B50A5, 0x0D4E7983, 0x00000000, 0x56696633, 0x550E395A, 0x00000000,
+    0x40311F25, 0x00000000, 0x00000000, 0x287D4521, 0x00000000, 0x4023E4AC, 0x00000000, 0x4E1AE0B9,
+    0x00000000, 0x46646B17, 0x5D4299AF, 0x00000000, 0x00000000, 0x4210AF39, 0x4F5B864D, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x381F46CA, 0x07208EDB, 0x5C4CF289, 0x3E2163D3,
+    0x00000000, 0x210C5C3E, 0x5967198A, 0x0332EC0B, 0x515197C4, 0x00000000, 0x40725623, 0x00000000,
+    0x2D5ADB22, 0x2C5B362A, 0x2F3BD116, 0x3D54A8EE, 0x5806BB33, 0x243A24F4, 0x0460668F, 0x4D09FA4D,
+    0x390DA5A9, 0x00000000, 0x00000000, 0x3C48EB8E, 0x00000000, 0x00000000, 0x48524DD4, 0x00000000,
+    0x00000000, 0x02702BAD, 0x4533B164, 0x00000000, 0x00000000, 0x1C6C36C4, 0x00000000, 0x1F563B0E,
+    0x0C1ADD18, 0x00000000, 0x00000000, 0x19431B7A, 0x0C6B7460, 0x37265A35, 0x00000000, 0x5C199E51,
+    0x40588F92, 0x5674B319, 0x095414FC, 0x0A02B6AB, 0x5C1333CA, 0x0D673CC1, 0x100F3A3C, 0x2C155B36,
+    0x670CA6CF, 0x4672358B, 0x4248579C, 0x4F6DC326, 0x561E9663, 0x00000000, 0x5C667944, 0x0750476D,
+    0x542B34B9, 0x03597605, 0x00000000, 0x2C2AD9B1, 0x567A598C, 0x00000000, 0x58435D99, 0x460BE46B,
+    0x00000000, 0x3946D2D4, 0x04703347, 0x4D44FD26, 0x060785F4, 0x0A0ADAAC, 0x4C3AA932, 0x2C3155B3,
+    0x5C4CCF28, 0x103CE8F0, 0x036CBB02, 0x2B2A713C, 0x231156AE, 0x272DC51C, 0x0A415B55, 0x0D739E60,
+    0x3B26399D, 0x37532D1A, 0x1D06E94F, 0x4C293275, 0x67465367, 0x076823B6, 0x46791AC5, 0x2C556CD8,
+    0x00000000, 0x2C58AAD9, 0x5861AECC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x676329B3, 0x00000000, 0x4C54993A, 0x00000000, 0x683E7B10, 0x00000000,
+    0x3022D61E, 0x00000000, 0x37168D53, 0x00000000, 0x00000000, 0x00000000, 0x1A06555D, 0x1A432AAE,
+    0x5D5F0A66, 0x5D3E14CD, 0x67329B3C, 0x00000000, 0x00000000, 0x087EC138, 0x00000000, 0x00000000,
+    0x087D8271, 0x6161A2B9, 0x1B47B21A, 0x3A6A5E38, 0x61434573, 0x5A566507, 0x087B04E3, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x51197C4A, 0x3A54BC71, 0x653A7688, 0x00000000, 0x5A2CCA0F,
+    0x211F0C5C, 0x00000000, 0x1B0F6435, 0x4724BEE2, 0x350C971B, 0x0B7A4166, 0x61068AE7, 0x435F4C85,
+    0x00000000, 0x22262177, 0x462F91AC, 0x087609C7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x26225BD8, 0x3A2978E3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x3F2F08F5, 0x0B337A41, 0x00000000, 0x00000000, 0x4E726B82,
+    0x433E990B, 0x0B7482CD, 0x00000000, 0x116BD098, 0x00000000, 0x34619F18, 0x00000000, 0x00000000,
+    0x00000000, 0x150AA1EE, 0x5466972A, 0x3A178E35, 0x00000000, 0x0F683B5C, 0x086C138F, 0x0A2B6AB0,
+    0x00000000, 0x00000000, 0x00000000, 0x256B512B, 0x17533985, 0x00000000, 0x00000000, 0x00000000,
+    0x0D660E73, 0x1A7432AA, 0x00000000, 0x00000000, 0x00000000, 0x2557AD44, 0x1E5AF21C, 0x00000000,
+    0x00000000, 0x00000000, 0x1C3626C3, 0x00000000, 0x00000000, 0x23455AB8, 0x3F1EABC2, 0x2A32C535,
+    0x00000000, 0x3E4D0B1E, 0x0D0E73CC, 0x63313A6E, 0x00000000, 0x00000000, 0x057D606A, 0x00000000,
+    0x00000000, 0x5F12479B, 0x0B69059B, 0x1D1BA53C, 0x00000000, 0x00000000, 0x4E64D705, 0x00000000,
+    0x3D4A8EEA, 0x65074ED1, 0x4F4DB70C, 0x403E4AC4, 0x294B63E2, 0x122B84DE, 0x1157A131, 0x256A257A,
+    0x00000000, 0x34433E31, 0x00000000, 0x2427A3A2, 0x061E17D0, 0x00000000, 0x46317C8D, 0x3B1CCEA6,
+    0x544D2E55, 0x0E24E0EB, 0x673C6536, 0x604E6D1C, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x232B88AB, 0x0F5076B9, 0x0858271F, 0x017D8E04, 0x00000000, 0x247A3A24, 0x00000000, 0x030B65D8,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1726730B,
+    0x00000000, 0x00000000, 0x2556A257, 0x00000000, 0x4548CEC5, 0x252F5A89, 0x00000000, 0x18176C2E,
+    0x1A686555, 0x0D4C1CE7, 0x331AAA2F, 0x040CD1F8, 0x00000000, 0x00000000, 0x1E35E439, 0x00000000,
+    0x00000000, 0x00000000, 0x30561E45, 0x131DF061, 0x00000000, 0x08138FD8, 0x00000000, 0x2210BBA6,
+    0x4824DD4A, 0x615CE1A2, 0x115098D7, 0x00000000, 0x093F2A0A, 0x6803E7B1, 0x00000000, 0x28487EA2,
+    0x1A2AE865, 0x4A297496, 0x00000000, 0x0E4E0EB4, 0x3E1A163D, 0x1C436C4D, 0x230AB571, 0x45316467,
+    0x665A9DC1, 0x00000000, 0x603939B4, 0x5619E966, 0x3C3AE3A4, 0x00000000, 0x2A0A6ACB, 0x057AC0D5,
+    0x00000000, 0x6753678C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x284521FA, 0x5F479B24,
+    0x375A354C, 0x1C44D86D, 0x262DEC22, 0x4D344FD2, 0x182E2ED8, 0x00000000, 0x00000000, 0x00000000,
+    0x4127BB48, 0x3F708F55, 0x00000000, 0x4E49AE0B, 0x556395A1, 0x5354D3AC, 0x2916C7C5, 0x167A70B2,
+    0x56319E96, 0x0B520B37, 0x576A31E5, 0x477DC492, 0x3D151DD5, 0x1A195574, 0x5B703F32, 0x00000000,
+    0x112F4263, 0x00000000, 0x186D85C5, 0x00000000, 0x4F1B6E19, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x2D322B5B, 0x34067C63, 0x25544AF5, 0x00000000, 0x0E75A4E0, 0x00000000,
+    0x4B52B725, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2F1677A2,
+    0x535654D3, 0x601CDA39, 0x2E25DE2C, 0x316D35A2, 0x4A4B2974, 0x296296C7, 0x00000000, 0x00000000,
+    0x541A5CAB, 0x2751C5B8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x24747449, 0x00000000,
+    0x3571B192, 0x325CF948, 0x00000000, 0x1E2F21CB, 0x017B1C09, 0x08304E3F, 0x00000000, 0x0F20ED73,
+    0x00000000, 0x17185A67, 0x5034A1BC, 0x00000000, 0x00000000, 0x00000000, 0x55438E56, 0x134277C1,
+    0x00000000, 0x00000000, 0x356C64B8, 0x00000000, 0x66706D4E, 0x1617A70B, 0x103C1E74, 0x3847D1B2,
+    0x00000000, 0x00000000, 0x3D552A3B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1950C6DE,
+    0x5165F128, 0x29296C7C, 0x00000000, 0x00000000, 0x252D44AF, 0x00000000, 0x00000000, 0x663B836A,
+    0x00000000, 0x00000000, 0x00000000, 0x0927E541, 0x45119D8B, 0x0C37460D, 0x035B2EC0, 0x00000000,
+    0x55656871, 0x2512BD6A, 0x0131C09F, 0x1A50CAAB, 0x0D1839CF, 0x1370613B, 0x00000000, 0x00000000,
+    0x6139C345, 0x00000000, 0x3C748EB8, 0x5B32E07E, 0x1F7563B0, 0x00000000, 0x4B6E4B4A, 0x00000000,
+    0x4E5C9AE0, 0x2E3BC589, 0x1B3D90D4, 0x217C3170, 0x00000000, 0x302C3C8B, 0x6464F24E, 0x327948B9,
+    0x00000000, 0x00000000, 0x35325C6C, 0x055F581A, 0x00000000, 0x00000000, 0x0F6B9A0E, 0x00000000,
+    0x611A2B9C, 0x00000000, 0x674F194D, 0x112131AF, 0x2F3D1167, 0x00000000, 0x2449E8E8, 0x00000000,
+    0x621CA17B, 0x00000000, 0x00000000, 0x4B25A56E, 0x2810FD45, 0x00000000, 0x61573868, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x4A749652, 0x49154FA9, 0x68083E7B, 0x00000000, 0x264B7B08,
+    0x44397322, 0x1C06D89B, 0x00000000, 0x2B389E2A, 0x09795053, 0x0E1C1D69, 0x00000000, 0x66353B83,
+    0x0708EDB4, 0x00000000, 0x3061E45A, 0x00000000, 0x00000000, 0x00000000, 0x043F0334, 0x00000000,
+    0x00000000, 0x00000000, 0x5F0F3649, 0x00000000, 0x00000000, 0x3E163D34, 0x3A71A978, 0x057581AB,
+    0x6726CF19, 0x486EA524, 0x00000000, 0x00000000, 0x3F611EAB, 0x5B4CB81F, 0x070EDB41, 0x280A43F5,
+    0x00000000, 0x00000000, 0x00000000, 0x5E261CD6, 0x1A155743, 0x00000000, 0x37346A99, 0x03605B2E,
+    0x00000000, 0x00000000, 0x1C09B0DB, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2B4E278A,
+    0x00000000, 0x24224F47, 0x5E498735, 0x2017E1E8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x1B0D47B2, 0x160B2F4E, 0x00000000, 0x00000000, 0x00000000, 0x4E135C17, 0x00000000, 0x00000000,
+    0x00000000, 0x676CF194, 0x5329A759, 0x00000000, 0x00000000, 0x00000000, 0x1674E165, 0x55472B43,
+    0x5B607E65, 0x4F0C9B6E, 0x0B24166F, 0x00000000, 0x00000000, 0x477B8925, 0x00000000, 0x00000000,
+    0x00000000, 0x1F63B0EA, 0x00000000, 0x00000000, 0x00000000, 0x575463CB, 0x4D3F49A2, 0x00000000,
+    0x00000000, 0x450B233B, 0x252895EB, 0x00000000, 0x00000000, 0x5D35F0A6, 0x185B0B8B, 0x00000000,
+    0x3851B28F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3948DA5A, 0x2B454E27, 0x460D62F9,
+    0x04668FC0, 0x00000000, 0x00000000, 0x153DC2A8, 0x4A329749, 0x360CDD8D, 0x2D22B5B6, 0x4D52689F,
+    0x00000000, 0x0E6B49C1, 0x00000000, 0x00000000, 0x42579C90, 0x551CAD0E, 0x00000000, 0x0914FCA8,
+    0x4B256E4B, 0x152A87B8, 0x4E5C1726, 0x11098D7A, 0x3A5E38D4, 0x2161F0C5, 0x00000000, 0x6049CDA3,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x223BA621, 0x00000000, 0x00000000, 0x00000000,
+    0x4A49652E, 0x1D3C374A, 0x4A1652E9, 0x3C571D23, 0x532CA9A7, 0x656D10E9, 0x00000000, 0x315A6B45,
+    0x29452D8F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0A36AB05, 0x00000000, 0x00000000,
+    0x050D5F58, 0x0447E066, 0x176730B4, 0x00000000, 0x00000000, 0x27238B71, 0x00000000, 0x2A559629,
+    0x5E564C39, 0x47124BEE, 0x191B7A86, 0x00000000, 0x2468E893, 0x103A3C1E, 0x4F5C326D, 0x025D6F02,
+    0x27628E2D, 0x0A2C15B5, 0x35636325, 0x3239F291, 0x17730B4C, 0x416909EE, 0x3116D35A, 0x590CC567,
+    0x025BC0AE, 0x2D6D915A, 0x00000000, 0x01763813, 0x57518F2E, 0x2007A0BF, 0x4C264EAA, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4B2D2B72, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1304EF83, 0x55071CAD, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x5E61CD64, 0x3558C971, 0x00000000, 0x186C2E2E, 0x00000000,
+    0x380FA365, 0x6660DA9D, 0x235AB88A, 0x5F592479, 0x00000000, 0x00000000, 0x5128CBE2, 0x00000000,
+    0x2D2D6D91, 0x00000000, 0x09414FCA, 0x482926EA, 0x1570AA1E, 0x3D2A5477, 0x00000000, 0x00000000,
+    0x1C361B62, 0x00000000, 0x1454295D, 0x00000000, 0x19218DBD, 0x0C0D6E8C, 0x00000000, 0x4519D8B2,
+    0x5C0999E5, 0x10079D1E, 0x514BE251, 0x3F7AAF08, 0x00000000, 0x4F36E193, 0x42242BCE, 0x0D4F3073,
+    0x00000000, 0x3846CA3E, 0x00000000, 0x4D227E93, 0x3923696A, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x2B15389E, 0x2716E28E, 0x00000000, 0x03365D81, 0x076DA08E, 0x0603C2FA, 0x0D39CF30,
+    0x00000000, 0x2E62C4BB, 0x00000000, 0x00000000, 0x00000000, 0x0F7341DA, 0x681F3D88, 0x554AD0E3,
+    0x30116B0F, 0x00000000, 0x01409F63, 0x00000000, 0x1A219557, 0x335E6AA8, 0x083F609C, 0x00000000,
+    0x1D6E94F0, 0x3A352F1C, 0x651D3B44, 0x1360C277, 0x510CBE25, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x47125F71, 0x207C3D05, 0x344630CF, 0x3C691D71, 0x4D49A27E, 0x00000000, 0x1F6AC761,
+    0x00000000, 0x035D816C, 0x00000000, 0x00000000, 0x4B5C9695, 0x00000000, 0x00000000, 0x4E3935C1,
+    0x00000000, 0x5F491E6C, 0x3430CF8C, 0x0F341DAE, 0x195BD431, 0x150550F7, 0x5876661A, 0x217862E1,
+    0x00000000, 0x00000000, 0x32729173, 0x425E7242, 0x6366274D, 0x00000000, 0x252BD6A2, 0x6449E49D,
+    0x00000000, 0x3F0F55E1, 0x00000000, 0x00000000, 0x00000000, 0x2D56D915, 0x053EB035, 0x00000000,
+    0x401F2562, 0x0F57341D, 0x4852926E, 0x2355AB88, 0x3D254775, 0x00000000, 0x4F26DB86, 0x4E705C9A,
+    0x2413D1D1, 0x00000000, 0x00000000, 0x00000000, 0x671E329B, 0x6027368E, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x3A78E352, 0x00000000, 0x687B107C, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3952D48D, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4953EA4A, 0x28243F51, 0x06785F40, 0x612E70D1, 0x2C59B155, 0x0809C7EC, 0x48126EA5,
+    0x00000000, 0x4A692CA5, 0x00000000, 0x3B733A98, 0x560CF4B3, 0x0C460D6E, 0x3C1D71D2, 0x601C9CDA,
+    0x282290FD, 0x5B381F99, 0x6729B3C6, 0x5F23CD92, 0x2145C3E1, 0x2616F611, 0x42648579, 0x1817176C,
+    0x5618CF4B, 0x076DB411, 0x532A69D6, 0x00000000, 0x00000000, 0x00000000, 0x3C5C748E, 0x0972A0A7,
+    0x00000000, 0x494954FA, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E3AD270,
+    0x2A535658, 0x31369AD1, 0x3169AD16, 0x00000000, 0x3043C8B5, 0x2E12EF16, 0x00000000, 0x4A2594BA,
+    0x2728E2DC, 0x00000000, 0x00000000, 0x00000000, 0x2F4459DE, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x5521C72B, 0x00000000, 0x62767285, 0x3F557847, 0x101E0F3A, 0x3823E8D9, 0x3536325C,
+    0x00000000, 0x395A91B4, 0x1928636F, 0x056B0357, 0x00000000, 0x2914B63E, 0x00000000, 0x3A6352F1,
+    0x00000000, 0x485D4A49, 0x032D9760, 0x00000000, 0x00000000, 0x00000000, 0x44732272, 0x3F423D57,
+    0x5B19703F, 0x314D68B6, 0x4B3725A5, 0x1F3AB1D8, 0x00000000, 0x52729D06, 0x6374DCC4, 0x4E2E4D70,
+    0x00000000, 0x14576A14, 0x00000000, 0x00000000, 0x5A4A0F59, 0x2424F474, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x5F736491, 0x612B9C34, 0x0340B65D, 0x00000000, 0x00000000, 0x00000000,
+    0x2B1C4F15, 0x00000000, 0x00000000, 0x00000000, 0x435BE990, 0x070476DA, 0x041F819A, 0x00000000,
+    0x00000000, 0x00000000, 0x3E0B1E9A, 0x3A38D4BC, 0x00000000, 0x00000000, 0x2A5658A6, 0x00000000,
+    0x5E130E6B, 0x00000000, 0x3E74D0B1, 0x386CA3E8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x1272B84D, 0x00000000, 0x00000000, 0x06681E17, 0x00000000, 0x00000000, 0x00000000,
+    0x673678CA, 0x185DB0B8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x64764F24,
+    0x544B9566, 0x00000000, 0x4D1FA4D1, 0x1F31D875, 0x336AA8BC, 0x6759E329, 0x00000000, 0x4F70C9B6,
+    0x00000000, 0x00000000, 0x477124BE, 0x5E5930E6, 0x0275BC0A, 0x151EE154, 0x043347E0, 0x2D115ADB,
+    0x00000000, 0x00000000, 0x090A7E54, 0x550E5687, 0x1669C2CB, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5B40FCCB, 0x1D1E1BA5,
+    0x404AC47C, 0x2963E296, 0x00000000, 0x4777124B, 0x0506AFAC, 0x00000000, 0x00000000, 0x00000000,
+    0x36468CDD, 0x00000000, 0x0A6AB056, 0x1F4761D5, 0x413484F7, 0x1377C184, 0x64792764, 0x310B69AD,
+    0x00000000, 0x395A5A91, 0x5728C797, 0x00000000, 0x11635E84, 0x026F02BA, 0x00000000, 0x00000000,
+    0x00000000, 0x5E30E6B2, 0x00000000, 0x00000000, 0x18361717, 0x625ECE50, 0x2242EE98, 0x00000000,
+    0x5765D463, 0x57463CBA, 0x00000000, 0x604DA393, 0x511465F1, 0x00000000, 0x00000000, 0x0920A7E5,
+    0x00000000, 0x1C1B0DB1, 0x12426F2B, 0x0C06B746, 0x65443A76, 0x1003CE8F, 0x00000000, 0x1D53C374,
+    0x3823651F, 0x044D1F81, 0x3911B4B5, 0x00000000, 0x2B0A9C4F, 0x270B7147, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x680F9EC4, 0x00000000, 0x084E3F60, 0x3467C630, 0x146D4295, 0x332F3554,
+    0x00000000, 0x3A1A978E, 0x00000000, 0x00000000, 0x4D24D13F, 0x05581ABE, 0x636E6274, 0x3248B9F2,
+    0x00000000, 0x40447C95, 0x00000000, 0x00000000, 0x1452BB50, 0x00000000, 0x0E569383, 0x0F1A0ED7,
+    0x00000000, 0x422F3921, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x232AD5C4, 0x400F92B1, 0x4E382E4D, 0x60139B47, 0x00000000, 0x2143E18B, 0x3E6858F4,
+    0x3A3C71A9, 0x00000000, 0x683D883E, 0x00000000, 0x00000000, 0x00000000, 0x1E4B5E43, 0x00000000,
+    0x5667A598, 0x00000000, 0x515F128C, 0x0804E3F6, 0x014FB1C0, 0x5050DE34, 0x0C2306B7, 0x600E4E6D,
+    0x00000000, 0x00000000, 0x180B8BB6, 0x00000000, 0x00000000, 0x00000000, 0x3C2E3A47, 0x3765A354,
+    0x00000000, 0x4A12CA5D, 0x0E1D6938, 0x00000000, 0x00000000, 0x00000000, 0x3134D68B, 0x2A29AB2C,
+    0x655A21D3, 0x2269885D, 0x356325C6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x290A5B1F, 0x392D48DA, 0x484DD4A4, 0x0D79839C, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5F6491E6, 0x432DF4C8, 0x00000000, 0x24127A3A,
+    0x00000000, 0x6250BD9C, 0x236AE22A, 0x0E69383A, 0x6115CE1A, 0x040FC0CD, 0x142BB50A, 0x07023B6D,
+    0x2A2B2C53, 0x3E058F4D, 0x3366AA8B, 0x265844B7, 0x3A1C6A5E, 0x383651F4, 0x174E6169, 0x5E2C9873,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x415213DD, 0x00000000, 0x643B2792, 0x034BB02D,
+    0x2451D127, 0x5425CAB3, 0x4F3864DB, 0x00000000, 0x00000000, 0x00000000, 0x023ADE05, 0x00000000,
+    0x09053F2A, 0x53759534, 0x150F70AA, 0x00000000, 0x27451C5B, 0x00000000, 0x17661699, 0x3546C64B,
+    0x634E9B98, 0x2931F14B, 0x1665E9C2, 0x3D754A8E, 0x643C93B2, 0x4025623E, 0x00000000, 0x00000000,
+    0x0540D5F5, 0x3355179A, 0x0237815D, 0x2D5B22B5, 0x016C7027, 0x31568B69, 0x622F6728, 0x137C184E,
+    0x00000000, 0x57231E5D, 0x2F6F4459, 0x00000000, 0x1D29E1BA, 0x68620F9E, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x504A1BC6, 0x00000000, 0x1450A576, 0x5B732E07, 0x3433E318, 0x33179AAA,
+    0x1A6555D0, 0x00000000, 0x00000000, 0x246893D1, 0x00000000, 0x00000000, 0x6337313A, 0x14295DA8,
+    0x00000000, 0x00000000, 0x56598CF4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x080271FB, 0x00000000, 0x3732D1AA, 0x4D749A27, 0x00000000, 0x0127D8E0, 0x512F8946,
+    0x00000000, 0x3D547754, 0x5E439AC9, 0x1805C5DB, 0x00000000, 0x00000000, 0x00000000, 0x295B1F14,
+    0x5F3248F3, 0x59633159, 0x524E8372, 0x18585C5D, 0x2061E82F, 0x0D3CC1CE, 0x353192E3, 0x6641B53B,
+    0x62285ECE, 0x1415DA85, 0x4316FA64, 0x00000000, 0x0E349C1D, 0x1B547B21, 0x23357115, 0x00000000,
+    0x381B28FA, 0x00000000, 0x2E78B12E, 0x4F6DB864, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x30645AC3, 0x00000000, 0x09029F95, 0x34718C33, 0x454EC591,
+    0x534D3ACA, 0x3D3AA547, 0x6449D93C, 0x1561543D, 0x00000000, 0x00000000, 0x1632F4E1, 0x00000000,
+    0x00000000, 0x50250DE3, 0x00000000, 0x00000000, 0x00000000, 0x3419F18C, 0x330BCD55, 0x142852BB,
+    0x00000000, 0x00000000, 0x1414AED4, 0x0113EC70, 0x00000000, 0x562CC67A, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x4954954F, 0x5117C4A3, 0x371968D5, 0x556871CA, 0x00000000, 0x3F755E11,
+    0x00000000, 0x00000000, 0x00000000, 0x0D1E60E7, 0x00000000, 0x430B7D32, 0x62142F67, 0x00000000,
+    0x0B4166F4, 0x380D947D, 0x00000000, 0x00000000, 0x434C85BE, 0x00000000, 0x1550F70A, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x415DA427, 0x5556871C,
+    0x00000000, 0x00000000, 0x52506E53, 0x00000000, 0x0109F638, 0x00000000, 0x00000000, 0x2F59DE88,
+    0x075B411D, 0x57797518, 0x1060F3A3, 0x4305BE99, 0x0B20B37A, 0x607368E4, 0x12709BCA, 0x0104FB1C,
+    0x00000000, 0x00000000, 0x552B438E, 0x5D5335F0, 0x0F6683B5, 0x00000000, 0x2E458977, 0x00000000,
+    0x12384DE5, 0x00000000, 0x00000000, 0x00000000, 0x573CBA8C, 0x5D299AF8, 0x5515A1C7, 0x01027D8E,
+    0x571E5D46, 0x00000000, 0x00000000, 0x00000000, 0x5E4D64C3, 0x00000000, 0x00000000, 0x01013EC7,
+};
+
+#endif
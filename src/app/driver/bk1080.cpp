@@ -16,6 +16,7 @@
 #include "../dcs.h"
 #include "bk1080.h"
 #include "i2c1.h"
+#include "i2c_bus.h"
 #include "system.h"
 #include "../frequencies.h"
 //#define CHAN_SPACING     0u  // 200kHz
@@ -138,22 +139,16 @@ void BK1080_Init(const uint16_t frequency, const bool initialise) {
 }
 
 uint16_t BK1080_ReadRegister(BK1080_Register_t Register) {
-    uint8_t Value[2];
-    I2C_Start();
-    I2C_Write(0x80);
-    I2C_Write((Register << 1) | I2C_READ);
-    I2C_ReadBuffer(Value, sizeof(Value));
-    I2C_Stop();
+    uint8_t Value[2] = {0xFF, 0xFF};
+    const uint8_t Head = (uint8_t)((Register << 1) | I2C_READ);
+    I2CBUS_Read(I2CBUS_DEV_BK1080, &Head, 1, Value, sizeof(Value));
     return (Value[0] << 8) | Value[1];
 }
 
 void BK1080_WriteRegister(BK1080_Register_t Register, uint16_t Value) {
-    I2C_Start();
-    I2C_Write(0x80);
-    I2C_Write((Register << 1) | I2C_WRITE);
+    const uint8_t Head = (uint8_t)((Register << 1) | I2C_WRITE);
     Value = ((Value >> 8) & 0xFF) | ((Value & 0xFF) << 8);
-    I2C_WriteBuffer(&Value, sizeof(Value));
-    I2C_Stop();
+    I2CBUS_Write(I2CBUS_DEV_BK1080, &Head, 1, &Value, sizeof(Value));
 }
 
 void BK1080_Mute(const bool Mute) {
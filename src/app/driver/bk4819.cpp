@@ -32,6 +32,8 @@ extern bool stop_mdc_flag;
 #endif
 
 #include "../misc.h"
+#include "../helper/profiler.h"
+#include "../helper/trace.h"
 
 // ===== ESP32 优化包含 =====
 
@@ -39,6 +41,8 @@ extern bool stop_mdc_flag;
 #ifndef ENABLE_OPENCV
 #include <esp_timer.h>
 #include <xtensa/hal.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #else
 #include "opencv/Arduino.hpp"
 #endif
@@ -71,6 +75,18 @@ static const uint8_t DTMF_TONE2_GAIN = 93;
 
 static uint16_t gBK4819_GpioOutState;
 
+// 电台任务和主循环（界面读数、调试显示）可能同时访问，一次寄存器读写是一个事务。
+// 在 BK4819_Init 里创建，之前只有启动代码在用，不加锁
+#ifndef ENABLE_OPENCV
+static StaticSemaphore_t gBK4819_LockBuffer;
+static SemaphoreHandle_t gBK4819_Lock;
+#define BK4819_LOCK()   do { if (gBK4819_Lock) xSemaphoreTake(gBK4819_Lock, portMAX_DELAY); } while (0)
+#define BK4819_UNLOCK() do { if (gBK4819_Lock) xSemaphoreGive(gBK4819_Lock); } while (0)
+#else
+#define BK4819_LOCK()   do { } while (0)
+#define BK4819_UNLOCK() do { } while (0)
+#endif
+
 bool gRxIdleMode;
 
 __inline uint16_t scale_freq(const uint16_t freq) {
@@ -80,6 +96,10 @@ __inline uint16_t scale_freq(const uint16_t freq) {
 
 
 void BK4819_Init(void) {
+#ifndef ENABLE_OPENCV
+    if (gBK4819_Lock == NULL)
+        gBK4819_Lock = xSemaphoreCreateMutexStatic(&gBK4819_LockBuffer);
+#endif
     pinMode(AUDIO_PATH, OUTPUT);
     // ESP32 GPIO 配置
     gpio_config_t gpio_conf = {};
@@ -96,6 +116,10 @@ void BK4819_Init(void) {
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SCN);
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SCL);
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SDA);
+#ifdef BK4819_PIN_IRQ
+    // BK4819_ReadIrq 靠它的电平判断有没有中断，不管接没接边沿中断
+    pinMode(BK4819_PIN_IRQ, INPUT);
+#endif
 
     BK4819_WriteRegister(BK4819_REG_00, 0x8000);
     BK4819_WriteRegister(BK4819_REG_00, 0x0000);
@@ -167,6 +191,30 @@ void BK4819_Init(void) {
     BK4819_WriteRegister(BK4819_REG_3F, 0);
 }
 
+bool BK4819_ReadIrq(BK4819_IrqStatus_t *pStatus) {
+#if defined(BK4819_PIN_IRQ) && !defined(ENABLE_OPENCV)
+    if (gpio_get_level((gpio_num_t)BK4819_PIN_IRQ) != BK4819_IRQ_ACTIVE_LEVEL)
+        return false;
+#endif
+    if ((BK4819_ReadRegister(BK4819_REG_0C) & 1u) == 0)
+        return false;
+
+    // clear interrupts
+    BK4819_WriteRegister(BK4819_REG_02, 0);
+    // fetch interrupt status bits
+    pStatus->__raw = BK4819_ReadRegister(BK4819_REG_02);
+    return true;
+}
+
+void BK4819_AttachIrq(void (*pHandler)(void *), void *pArg) {
+#if defined(BK4819_PIN_IRQ) && !defined(ENABLE_OPENCV)
+    attachInterruptArg(BK4819_PIN_IRQ, pHandler, pArg, BK4819_IRQ_ACTIVE_LEVEL ? RISING : FALLING);
+#else
+    (void)pHandler;
+    (void)pArg;
+#endif
+}
+
 static uint16_t BK4819_ReadU16(void) {
     unsigned int i;
     uint16_t Value;
@@ -193,11 +241,13 @@ static uint16_t BK4819_ReadU16(void) {
 }
 
 uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register) {
+    PROFILER_ZONE(BK4819_READ);
     #ifdef ENABLE_OPENCV
     return 0;
     #endif
     uint16_t Value;
 
+    BK4819_LOCK();
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SCN);
     GPIO_SET_LOW(GPIOC_PIN_BK4819_SCL);
 
@@ -212,12 +262,16 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register) {
 
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SCL);
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SDA);
+    BK4819_UNLOCK();
 
     return Value;
 
 }
 
 void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data) {
+    PROFILER_ZONE(BK4819_WRITE);
+    TRACE(REG_WRITE, Register, Data);
+    BK4819_LOCK();
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SCN);
     GPIO_SET_LOW(GPIOC_PIN_BK4819_SCL);
 
@@ -234,6 +288,7 @@ void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data) {
 
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SCL);
     GPIO_SET_HIGH(GPIOC_PIN_BK4819_SDA);
+    BK4819_UNLOCK();
 }
 
 void BK4819_WriteU8(uint8_t Data) {
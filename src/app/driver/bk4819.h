@@ -31,6 +31,13 @@ extern "C" {
 #define GPIOC_PIN_BK4819_SCL ((gpio_num_t)1)   // 串行时钟
 #define GPIOC_PIN_BK4819_SDA ((gpio_num_t)34)  // 串行数据
 
+// 可选：把 BK4819 的中断输出接到 ESP32 的 BK4819_PIN_IRQ（在 build_flags 里定义，
+// 芯片侧的引脚功能须由硬件改装配好）。接了线就只在线有效时才读清中断状态，
+// 电台任务在跑时由边沿中断唤醒它；没接线时照旧每个节拍读一次 REG_0C
+#ifndef BK4819_IRQ_ACTIVE_LEVEL
+#define BK4819_IRQ_ACTIVE_LEVEL 1
+#endif
+
 enum BK4819_AF_Type_t
 {
 	BK4819_AF_MUTE      =  0u,  //
@@ -71,11 +78,39 @@ enum BK4819_CssScanResult_t
 
 typedef enum BK4819_CssScanResult_t BK4819_CssScanResult_t;
 
+// REG_02 中断状态，位置同 REG_3F 的中断使能
+typedef union {
+	struct {
+		uint16_t __UNUSED: 1;
+		uint16_t fskRxSync: 1;
+		uint16_t sqlLost: 1;
+		uint16_t sqlFound: 1;
+		uint16_t voxLost: 1;
+		uint16_t voxFound: 1;
+		uint16_t ctcssLost: 1;
+		uint16_t ctcssFound: 1;
+		uint16_t cdcssLost: 1;
+		uint16_t cdcssFound: 1;
+		uint16_t cssTailFound: 1;
+		uint16_t dtmf5ToneFound: 1;
+		uint16_t fskFifoAlmostFull: 1;
+		uint16_t fskRxFinied: 1;
+		uint16_t fskFifoAlmostEmpty: 1;
+		uint16_t fskTxFinied: 1;
+	};
+	uint16_t __raw;
+} BK4819_IrqStatus_t;
+
 // radio is asleep, not listening
 extern bool gRxIdleMode;
 
 void     BK4819_Init(void);
 
+// 有待处理的中断时清除并取出状态；没有时返回 false（接了中断线则不走总线）
+bool     BK4819_ReadIrq(BK4819_IrqStatus_t *pStatus);
+// 中断线变为有效时在中断上下文里调用 pHandler；没接线时什么都不做
+void     BK4819_AttachIrq(void (*pHandler)(void *), void *pArg);
+
 uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register);
 void     BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data);
 void     BK4819_SetRegValue(RegisterSpec s, uint16_t v);
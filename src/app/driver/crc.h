@@ -30,6 +30,14 @@ uint16_t compute_crc(const void *data, const unsigned int data_len) ;    // let
 
 void CRC_InitReverse(void);
 
+// CRC-32 (zlib/IEEE, reflected 0xEDB88320).  Start with Crc = 0; feed the
+// previous result back in to continue over several buffers.
+uint32_t CRC32_Update(uint32_t Crc, const void *pBuffer, uint32_t Size);
+
+// XORs Size bytes in place with the repeating 16-byte Key (key index 0 at
+// pBuffer[0]) and returns the CRC16-XMODEM of the result, in one pass.
+uint16_t CRC_XorCalculate(uint8_t *pBuffer, uint32_t Size, const uint8_t Key[16]);
+
 #ifdef __cplusplus
 }
 #endif
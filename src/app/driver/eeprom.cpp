@@ -16,13 +16,45 @@
 
 #include "eeprom.h"
 #include "i2c1.h"
+#include "i2c_bus.h"
+#include "../helper/profiler.h"
 #include <Arduino.h>
 #include <string.h>
 
 static constexpr uint32_t EEPROM_DIRECT_EEPROM_LIMIT = 0x2000U; // Use only first 8KB on real EEPROM.
 static constexpr uint32_t EEPROM_WRITE_READY_TIMEOUT_MS = 120U;
-static constexpr uint32_t EEPROM_READY_POLL_INTERVAL_US = 500U;
-static constexpr uint32_t EEPROM_POST_WRITE_DELAY_MS = 3U;
+static constexpr uint32_t EEPROM_READY_POLL_INTERVAL_US = 100U;
+
+// Page buffer size of the I2C EEPROM.  Every write cycle programs one whole
+// page (or the partial head/tail of a range), so larger parts can set this
+// with -D to move more data per write cycle.  32 is the smallest 24Cxx page.
+#ifndef EEPROM_I2C_PAGE_SIZE
+#define EEPROM_I2C_PAGE_SIZE 32U
+#endif
+static constexpr uint32_t EEPROM_PAGE_SIZE = EEPROM_I2C_PAGE_SIZE;
+static_assert(EEPROM_PAGE_SIZE >= 8U && EEPROM_PAGE_SIZE <= 256U &&
+              (EEPROM_PAGE_SIZE & (EEPROM_PAGE_SIZE - 1U)) == 0U,
+              "EEPROM_I2C_PAGE_SIZE must be a power of two in 8..256");
+
+// RAM mirror of the I2C EEPROM window [0x0000..0x1FFF].  Loaded once by
+// EEPROM_MirrorLoad(); afterwards reads are memcpy() and writes only mark
+// pages dirty.  EEPROM_MirrorTimeSlice() writes dirty pages back in address
+// order, one full page per write cycle, and checks completion with a single
+// ACK poll per call, so no caller ever waits on the I2C bus.  Write-back
+// starts only once the mirror has been quiet for EEPROM_MIRROR_SETTLE_MS, so
+// a burst of small writes (CPS restore, menu edits) lands on each page once.
+static constexpr uint32_t EEPROM_MIRROR_PAGES = EEPROM_DIRECT_EEPROM_LIMIT / EEPROM_PAGE_SIZE;
+static constexpr uint32_t EEPROM_MIRROR_SETTLE_MS = 100U;
+static constexpr uint32_t EEPROM_MIRROR_MAX_DEFER_MS = 2000U;
+
+static uint8_t gEepromMirror[EEPROM_DIRECT_EEPROM_LIMIT];
+static uint32_t gEepromMirrorDirty[(EEPROM_MIRROR_PAGES + 31U) / 32U];
+static bool gEepromMirrorValid;
+static bool gEepromMirrorHasDirty;
+static int32_t gEepromMirrorBusyPage = -1;  // page whose write cycle may still be running
+static uint32_t gEepromMirrorBusySinceMs;
+static uint32_t gEepromMirrorTouchedMs;     // last mirror modification
+static uint32_t gEepromMirrorDirtySinceMs;  // oldest unwritten modification
 
 static inline bool EEPROM_IsDirectEepromRange(uint32_t address, uint32_t size)
 {
@@ -46,7 +78,10 @@ static inline bool EEPROM_IsDirectEepromRange(uint32_t address, uint32_t size)
 // in the same 512KB partition, we swap the overlapping "shadow" ranges:
 // - logical [0x00000..0x00FFF] <-> shared [0x02000..0x02FFF]
 // - logical [0x10000..0x11DFF] <-> shared [0x1E200..0x1FFFF]
-static constexpr uint32_t EEPROM_LOGICAL_SIZE = 0x80000; // 512KB
+//
+// The top of the partition [EEPROM_SHARED_RESERVED_BASE..] is not mapped: it belongs
+// to the activity log, so logical EEPROM ends there (448KB).
+static constexpr uint32_t EEPROM_LOGICAL_SIZE = EEPROM_SHARED_RESERVED_BASE;
 
 static constexpr uint32_t EEPROM_WELCOME_START = 0x02000;
 static constexpr uint32_t EEPROM_WELCOME_SIZE  = 0x01000;
@@ -197,10 +232,7 @@ static bool EEPROM_WaitReady(uint8_t controlByteWrite, uint32_t timeoutMs)
 {
     const uint32_t start = millis();
     while ((uint32_t)(millis() - start) < timeoutMs) {
-        I2C_Start();
-        const int ack = I2C_Write(controlByteWrite);
-        I2C_Stop();
-        if (ack == 0) {
+        if (I2CBUS_Probe(I2CBUS_DEV_EEPROM, controlByteWrite)) {
             return true;
         }
         delayMicroseconds(EEPROM_READY_POLL_INTERVAL_US);
@@ -208,14 +240,194 @@ static bool EEPROM_WaitReady(uint8_t controlByteWrite, uint32_t timeoutMs)
     return false;
 }
 
+static bool EEPROM_PollReady(uint8_t controlByteWrite)
+{
+    return I2CBUS_Probe(I2CBUS_DEV_EEPROM, controlByteWrite);
+}
+
+// 24xx 系列控制字节: 1010 A2 A1 A0 R/W
+// 对于 512KB 线性空间（2x256KB），使用 Address[18:16] 映射到 A2..A0
+static inline void EEPROM_XferInit(I2CBUS_Xfer_t *pXfer, uint32_t Address)
+{
+    memset(pXfer, 0, sizeof(*pXfer));
+    pXfer->Device = I2CBUS_DEV_EEPROM;
+    pXfer->Address = EEPROM_ControlByteWrite(Address);
+    pXfer->HeadSize = 2;
+    pXfer->Head[0] = (uint8_t)(Address >> 8);
+    pXfer->Head[1] = (uint8_t)(Address >> 0);
+}
+
+static bool EEPROM_DirectReadLong(uint32_t Address, void *pBuffer, uint16_t Size)
+{
+    I2CBUS_Xfer_t xfer;
+    EEPROM_XferInit(&xfer, Address);
+    xfer.pRx = pBuffer;
+    xfer.RxSize = Size;
+    return I2CBUS_Transfer(&xfer) == I2CBUS_OK;
+}
+
+static void EEPROM_DirectRead(uint32_t Address, void *pBuffer, uint8_t Size)
+{
+    (void)EEPROM_DirectReadLong(Address, pBuffer, Size);
+}
+
+// Page write without waiting for the write cycle; returns false on NAK.
+static bool EEPROM_DirectWritePage(uint32_t Address, const void *pBuffer, uint16_t Size)
+{
+    I2CBUS_Xfer_t xfer;
+    EEPROM_XferInit(&xfer, Address);
+    xfer.pTx = pBuffer;
+    xfer.TxSize = Size;
+    return I2CBUS_Transfer(&xfer) == I2CBUS_OK;
+}
+
+// Page-aligned burst write without the mirror: each page-bounded piece is
+// compared against the chip and, if different, written in one write cycle.
+// Completion is ACK polling only.
+static void EEPROM_DirectWriteRange(uint32_t Address, const uint8_t *pSrc, uint32_t Size)
+{
+    uint8_t current[EEPROM_PAGE_SIZE];
+
+    while (Size > 0U) {
+        uint32_t chunk = EEPROM_PAGE_SIZE - (Address % EEPROM_PAGE_SIZE);
+        if (chunk > Size) {
+            chunk = Size;
+        }
+
+        if (!EEPROM_DirectReadLong(Address, current, (uint16_t)chunk) || memcmp(current, pSrc, chunk) != 0) {
+            if (EEPROM_DirectWritePage(Address, pSrc, (uint16_t)chunk)) {
+                (void)EEPROM_WaitReady(EEPROM_ControlByteWrite(Address), EEPROM_WRITE_READY_TIMEOUT_MS);
+            }
+        }
+
+        Address += chunk;
+        pSrc += chunk;
+        Size -= chunk;
+    }
+}
+
+static inline void EEPROM_MirrorMarkDirty(uint32_t Address, uint32_t Size)
+{
+    const uint32_t first = Address / EEPROM_PAGE_SIZE;
+    const uint32_t last = (Address + Size - 1U) / EEPROM_PAGE_SIZE;
+    for (uint32_t page = first; page <= last; page++) {
+        gEepromMirrorDirty[page >> 5] |= 1UL << (page & 31U);
+    }
+
+    gEepromMirrorTouchedMs = millis();
+    if (!gEepromMirrorHasDirty) {
+        gEepromMirrorHasDirty = true;
+        gEepromMirrorDirtySinceMs = gEepromMirrorTouchedMs;
+    }
+}
+
+static int32_t EEPROM_MirrorNextDirty(void)
+{
+    for (uint32_t i = 0; i < (EEPROM_MIRROR_PAGES + 31U) / 32U; i++) {
+        if (gEepromMirrorDirty[i]) {
+            return (int32_t)(i * 32U + (uint32_t)__builtin_ctz(gEepromMirrorDirty[i]));
+        }
+    }
+    return -1;
+}
+
+static void EEPROM_MirrorWritePage(int32_t page)
+{
+    const uint32_t address = (uint32_t)page * EEPROM_PAGE_SIZE;
+
+    gEepromMirrorDirty[page >> 5] &= ~(1UL << (page & 31));
+    if (!EEPROM_DirectWritePage(address, &gEepromMirror[address], EEPROM_PAGE_SIZE)) {
+        // Still in a previous write cycle or the bus glitched: retry later.
+        gEepromMirrorDirty[page >> 5] |= 1UL << (page & 31);
+        return;
+    }
+    gEepromMirrorBusyPage = page;
+    gEepromMirrorBusySinceMs = millis();
+}
+
 // EEPROM 初始化
 void EEPROM_Init(void) {
     I2C_Init();
+    I2CBUS_Init();
 }
 
+bool EEPROM_MirrorLoad(void)
+{
+    // One sequential read of the whole window.
+    if (!EEPROM_DirectReadLong(0, gEepromMirror, EEPROM_DIRECT_EEPROM_LIMIT)) {
+        return false;
+    }
+
+    memset(gEepromMirrorDirty, 0, sizeof(gEepromMirrorDirty));
+    gEepromMirrorHasDirty = false;
+    gEepromMirrorBusyPage = -1;
+    gEepromMirrorValid = true;
+    return true;
+}
 
+void EEPROM_MirrorTimeSlice(void)
+{
+    if (!gEepromMirrorValid) {
+        return;
+    }
+
+    if (gEepromMirrorBusyPage >= 0) {
+        const uint32_t address = (uint32_t)gEepromMirrorBusyPage * EEPROM_PAGE_SIZE;
+        if (!EEPROM_PollReady(EEPROM_ControlByteWrite(address))) {
+            if ((uint32_t)(millis() - gEepromMirrorBusySinceMs) < EEPROM_WRITE_READY_TIMEOUT_MS) {
+                return;
+            }
+            // Never acknowledged: write the page again.
+            EEPROM_MirrorMarkDirty(address, EEPROM_PAGE_SIZE);
+        }
+        gEepromMirrorBusyPage = -1;
+        // Write cycle done: go straight on to the next page.
+    }
+
+    const int32_t page = EEPROM_MirrorNextDirty();
+    if (page < 0) {
+        gEepromMirrorHasDirty = false;
+        return;
+    }
+
+    const uint32_t now = millis();
+    if ((uint32_t)(now - gEepromMirrorTouchedMs) < EEPROM_MIRROR_SETTLE_MS &&
+        (uint32_t)(now - gEepromMirrorDirtySinceMs) < EEPROM_MIRROR_MAX_DEFER_MS) {
+        return;
+    }
+
+    EEPROM_MirrorWritePage(page);
+}
+
+void EEPROM_MirrorFlush(void)
+{
+    if (!gEepromMirrorValid) {
+        return;
+    }
+
+    for (uint32_t attempts = 0; attempts < EEPROM_MIRROR_PAGES * 2U; attempts++) {
+        if (gEepromMirrorBusyPage >= 0) {
+            (void)EEPROM_WaitReady(EEPROM_ControlByteWrite((uint32_t)gEepromMirrorBusyPage * EEPROM_PAGE_SIZE),
+                                   EEPROM_WRITE_READY_TIMEOUT_MS);
+            gEepromMirrorBusyPage = -1;
+        }
+
+        const int32_t page = EEPROM_MirrorNextDirty();
+        if (page < 0) {
+            gEepromMirrorHasDirty = false;
+            return;
+        }
+        EEPROM_MirrorWritePage(page);
+    }
+}
+
+bool EEPROM_MirrorPending(void)
+{
+    return gEepromMirrorValid && (gEepromMirrorBusyPage >= 0 || EEPROM_MirrorNextDirty() >= 0);
+}
 
 void EEPROM_ReadBuffer(uint32_t Address, void *pBuffer, uint8_t Size) {
+    PROFILER_ZONE(EEPROM_READ);
 
     if (Size == 0U || pBuffer == nullptr) {
         return;
@@ -265,34 +477,12 @@ void EEPROM_ReadBuffer(uint32_t Address, void *pBuffer, uint8_t Size) {
     }
 #endif
 
-    noInterrupts();
-    I2C_Start();
-
-    // 24xx 系列控制字节: 1010 A2 A1 A0 R/W
-    // 对于 512KB 线性空间（2x256KB），使用 Address[18:16] 映射到 A2..A0
-    const uint8_t IIC_ADD = EEPROM_ControlByteWrite(Address);
-
-    if (I2C_Write(IIC_ADD) < 0 ||
-        I2C_Write((Address >> 8) & 0xFF) < 0 ||
-        I2C_Write((Address >> 0) & 0xFF) < 0) {
-        I2C_Stop();
-        interrupts();
+    if (gEepromMirrorValid && EEPROM_IsDirectEepromRange(Address, Size)) {
+        memcpy(pBuffer, &gEepromMirror[Address], Size);
         return;
     }
 
-    I2C_Start();
-
-    if (I2C_Write(IIC_ADD + 1) < 0) {
-        I2C_Stop();
-        interrupts();
-        return;
-    }
-
-    I2C_ReadBuffer(pBuffer, Size);
-
-    I2C_Stop();
-    interrupts();
-
+    EEPROM_DirectRead(Address, pBuffer, Size);
 }
 
 bool EEPROM_Probe(uint32_t Address)
@@ -302,29 +492,24 @@ bool EEPROM_Probe(uint32_t Address)
         return Address < EEPROM_SharedLogicalSize();
     }
 #endif
-    noInterrupts();
-    I2C_Start();
-
-    const uint8_t iic_add = EEPROM_ControlByteWrite(Address);
-    if (I2C_Write(iic_add) < 0) {
-        I2C_Stop();
-        interrupts();
-        return false;
-    }
-
-    // 发送 16-bit word address（块内寻址）
-    if (I2C_Write((Address >> 8) & 0xFF) < 0 || I2C_Write(Address & 0xFF) < 0) {
-        I2C_Stop();
-        interrupts();
-        return false;
-    }
-
-    I2C_Stop();
-    interrupts();
-    return true;
+    // 发送控制字节 + 16-bit word address（块内寻址），不传数据
+    I2CBUS_Xfer_t xfer;
+    EEPROM_XferInit(&xfer, Address);
+    return I2CBUS_Transfer(&xfer) == I2CBUS_OK;
 }
 
+uint32_t EEPROM_GetLogicalSize(void)
+{
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+    const uint32_t shared = EEPROM_SharedLogicalSize();
+    return shared > 0U ? shared : EEPROM_DIRECT_EEPROM_LIMIT;
+#else
+    return 0x80000U; // whole address range goes to the I2C device
+#endif
+}
+
 void EEPROM_WriteBuffer(uint32_t Address, const void *pBuffer, uint8_t WRITE_SIZE) {
+    PROFILER_ZONE(EEPROM_WRITE);
 
     if (WRITE_SIZE == 0U || pBuffer == nullptr) {
         return;
@@ -384,37 +569,196 @@ void EEPROM_WriteBuffer(uint32_t Address, const void *pBuffer, uint8_t WRITE_SIZ
     }
 #endif
 
+    if (gEepromMirrorValid && EEPROM_IsDirectEepromRange(Address, WRITE_SIZE)) {
+        if (memcmp(&gEepromMirror[Address], pBuffer, WRITE_SIZE) != 0) {
+            memcpy(&gEepromMirror[Address], pBuffer, WRITE_SIZE);
+            EEPROM_MirrorMarkDirty(Address, WRITE_SIZE);
+        }
+        return;
+    }
 
+    EEPROM_DirectWriteRange(Address, (const uint8_t *)pBuffer, WRITE_SIZE);
+}
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+static bool EEPROM_SharedDiffers(uint32_t offset, const uint8_t *src, uint32_t size)
+{
     uint8_t buffer[256];
-    EEPROM_ReadBuffer(Address, buffer, WRITE_SIZE);
-    if (memcmp(pBuffer, buffer, WRITE_SIZE) != 0) {
-        const uint8_t IIC_ADD = EEPROM_ControlByteWrite(Address);
-
-        noInterrupts();
-
-        I2C_Start();
-
-        if (I2C_Write(IIC_ADD) < 0 ||
-            I2C_Write((Address >> 8) & 0xFF) < 0 ||
-            I2C_Write((Address) & 0xFF) < 0 ||
-            I2C_WriteBuffer(pBuffer, WRITE_SIZE) < 0) {
-            I2C_Stop();
-            interrupts();
-            if (EEPROM_POST_WRITE_DELAY_MS > 0U) {
-                delay(EEPROM_POST_WRITE_DELAY_MS);
+    while (size > 0U) {
+        const uint32_t chunk = size > sizeof(buffer) ? (uint32_t)sizeof(buffer) : size;
+        if (!shared_read((size_t)offset, buffer, (size_t)chunk) || memcmp(src, buffer, (size_t)chunk) != 0) {
+            return true;
+        }
+        offset += chunk;
+        src += chunk;
+        size -= chunk;
+    }
+    return false;
+}
+#endif
+
+// Largest piece starting at Address that stays inside one backing store:
+// the I2C window, or one contiguous window of the shared-partition mapping.
+static uint32_t EEPROM_BulkSpan(uint32_t Address, uint32_t Size)
+{
+    uint32_t span = Size;
+
+    if (Address < EEPROM_DIRECT_EEPROM_LIMIT) {
+        if (span > EEPROM_DIRECT_EEPROM_LIMIT - Address) {
+            span = EEPROM_DIRECT_EEPROM_LIMIT - Address;
+        }
+        return span;
+    }
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+    if (EEPROM_SharedLogicalSize() > 0U) {
+        const uint32_t contiguous = EEPROM_ContiguousSpan(Address);
+        if (span > contiguous) {
+            span = contiguous;
+        }
+    }
+#endif
+    return span;
+}
+
+bool EEPROM_ReadBulk(uint32_t Address, void *pBuffer, uint32_t Size)
+{
+    uint8_t *dst = (uint8_t *)pBuffer;
+    bool ok = true;
+
+    if (pBuffer == nullptr) {
+        return false;
+    }
+
+    while (Size > 0U) {
+        uint32_t chunk = EEPROM_BulkSpan(Address, Size);
+        if (chunk == 0U) {
+            memset(dst, 0, Size);
+            return false;
+        }
+
+        if (gEepromMirrorValid && EEPROM_IsDirectEepromRange(Address, chunk)) {
+            memcpy(dst, &gEepromMirror[Address], chunk);
+        }
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+        else if (Address >= EEPROM_DIRECT_EEPROM_LIMIT && EEPROM_SharedLogicalSize() > 0U) {
+            uint32_t off = 0U;
+            if (!EEPROM_AddressToSharedOffset(Address, chunk, &off) ||
+                !shared_read((size_t)off, dst, (size_t)chunk)) {
+                memset(dst, 0, (size_t)chunk);
+                ok = false;
             }
-            return;
         }
-        I2C_Stop();
+#endif
+        else {
+            if (chunk > 0x80U) {
+                chunk = 0x80U;
+            }
+            EEPROM_ReadBuffer(Address, dst, (uint8_t)chunk);
+        }
+
+        Address += chunk;
+        dst += chunk;
+        Size -= chunk;
+    }
+    return ok;
+}
 
-        // 写周期 ACK 轮询（比固定 delay 更可靠）
-        (void)EEPROM_WaitReady(IIC_ADD, EEPROM_WRITE_READY_TIMEOUT_MS);
+bool EEPROM_WriteBulk(uint32_t Address, const void *pBuffer, uint32_t Size)
+{
+    const uint8_t *src = (const uint8_t *)pBuffer;
+    bool ok = true;
 
-        interrupts();
+    if (pBuffer == nullptr) {
+        return false;
     }
-    // 兜底延时，避免某些器件/布线在连续访问时不稳
-    if (EEPROM_POST_WRITE_DELAY_MS > 0U) {
-        delay(EEPROM_POST_WRITE_DELAY_MS);
+
+    while (Size > 0U) {
+        uint32_t chunk = EEPROM_BulkSpan(Address, Size);
+        if (chunk == 0U) {
+            return false;
+        }
+
+        if (gEepromMirrorValid && EEPROM_IsDirectEepromRange(Address, chunk)) {
+            if (memcmp(&gEepromMirror[Address], src, chunk) != 0) {
+                memcpy(&gEepromMirror[Address], src, chunk);
+                EEPROM_MirrorMarkDirty(Address, chunk);
+            }
+        }
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
+        else if (Address >= EEPROM_DIRECT_EEPROM_LIMIT && EEPROM_SharedLogicalSize() > 0U) {
+            uint32_t off = 0U;
+            if (!EEPROM_AddressToSharedOffset(Address, chunk, &off)) {
+                return false;
+            }
+            // One flash sector at a time: every changed sector costs exactly one erase.
+            const uint32_t sectorLeft = (uint32_t)FLASH_SECTOR - (off % (uint32_t)FLASH_SECTOR);
+            if (chunk > sectorLeft) {
+                chunk = sectorLeft;
+            }
+            if (EEPROM_SharedDiffers(off, src, chunk) && !shared_write((size_t)off, src, (size_t)chunk)) {
+                ok = false;
+            }
+        }
+#endif
+        else {
+            EEPROM_DirectWriteRange(Address, src, chunk);
+        }
+
+        Address += chunk;
+        src += chunk;
+        Size -= chunk;
     }
+    return ok;
+}
+
+bool EEPROM_ReadSegments(const EEPROM_Segment_t *pSegments, uint32_t Count)
+{
+    bool ok = true;
+    for (uint32_t i = 0; i < Count; i++) {
+        ok = EEPROM_ReadBulk(pSegments[i].Address, pSegments[i].pBuffer, pSegments[i].Size) && ok;
+    }
+    return ok;
+}
+
+bool EEPROM_WriteSegments(const EEPROM_Segment_t *pSegments, uint32_t Count)
+{
+    bool ok = true;
+    for (uint32_t i = 0; i < Count; i++) {
+        ok = EEPROM_WriteBulk(pSegments[i].Address, pSegments[i].pBuffer, pSegments[i].Size) && ok;
+    }
+    return ok;
+}
+
+bool EEPROM_ReadStream(uint32_t Address, uint32_t Size, void *pScratch, uint32_t ScratchSize,
+                       EEPROM_SpanCallback_t Callback, void *pContext)
+{
+    uint8_t *scratch = (uint8_t *)pScratch;
 
+    if (pScratch == nullptr || ScratchSize == 0U || Callback == nullptr) {
+        return false;
+    }
+
+    while (Size > 0U) {
+        uint32_t span = EEPROM_BulkSpan(Address, Size);
+        const uint32_t sectorLeft = EEPROM_STREAM_SECTOR - (Address % EEPROM_STREAM_SECTOR);
+        if (span > sectorLeft) {
+            span = sectorLeft;
+        }
+        if (span > ScratchSize) {
+            span = ScratchSize;
+        }
+        if (span == 0U) {
+            return false;
+        }
+
+        if (!EEPROM_ReadBulk(Address, scratch, span) ||
+            !Callback(Address, scratch, span, pContext)) {
+            return false;
+        }
+
+        Address += span;
+        Size -= span;
+    }
+    return true;
 }
@@ -36,6 +36,42 @@ void EEPROM_WriteBuffer(uint32_t Address, const void *pBuffer, uint8_t Size);
 // 仅用于诊断：返回指定地址所在块是否在 I2C 上应答
 bool EEPROM_Probe(uint32_t Address);
 
+// 逻辑 EEPROM 地址空间大小（I2C 窗口 + shared 分区映射部分）
+uint32_t EEPROM_GetLogicalSize(void);
+
+// shared 分区从这里到末尾不映射成逻辑 EEPROM，留给活动记录（app/actlog.h）；
+// CPS / 批量 EEPROM 写入到不了这里，记录擦扇区也不会碰到 EEPROM 数据
+#define EEPROM_SHARED_RESERVED_BASE 0x70000U
+
+// RAM 镜像：启动时一次性读入 I2C EEPROM 前 8KB，之后读写均走镜像，
+// 脏页(32 字节)由 EEPROM_MirrorTimeSlice() 在后台逐页写回。
+bool EEPROM_MirrorLoad(void);
+void EEPROM_MirrorTimeSlice(void);
+void EEPROM_MirrorFlush(void);      // 阻塞写回全部脏页（重启/关机前调用）
+bool EEPROM_MirrorPending(void);
+
+// 批量接口：32 位长度，仅在后端存储（I2C 窗口 / shared 分区映射窗口 / 4KB 扇区）
+// 变化处切分，大块数据按 flash 读取速度传输。
+#define EEPROM_STREAM_SECTOR 0x1000U
+
+typedef struct {
+    uint32_t Address;
+    void    *pBuffer;   // EEPROM_WriteSegments 只读取，不修改
+    uint32_t Size;
+} EEPROM_Segment_t;
+
+// 返回 false 时停止流式读取
+typedef bool (*EEPROM_SpanCallback_t)(uint32_t Address, const uint8_t *pData, uint32_t Size, void *pContext);
+
+bool EEPROM_ReadBulk(uint32_t Address, void *pBuffer, uint32_t Size);
+bool EEPROM_WriteBulk(uint32_t Address, const void *pBuffer, uint32_t Size);
+bool EEPROM_ReadSegments(const EEPROM_Segment_t *pSegments, uint32_t Count);
+bool EEPROM_WriteSegments(const EEPROM_Segment_t *pSegments, uint32_t Count);
+
+// 经 pScratch 逐段读取 [Address, Address+Size)，每段不跨 4KB 扇区或映射窗口
+bool EEPROM_ReadStream(uint32_t Address, uint32_t Size, void *pScratch, uint32_t ScratchSize,
+                       EEPROM_SpanCallback_t Callback, void *pContext);
+
 #ifdef __cplusplus
 }
 #endif
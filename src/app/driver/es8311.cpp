@@ -1,6 +1,7 @@
 #include "driver/es8311.h"
 
 #include "driver/i2c1.h"
+#include "driver/i2c_bus.h"
 
 #include <Arduino.h>
 #include <driver/i2s.h>
@@ -19,8 +20,6 @@
 
 namespace {
 
-constexpr uint8_t kEs8311Addr = 0x18; // 7-bit I2C address
-
 constexpr int kPinDin = 36;   // codec DIN, data from MCU
 constexpr int kPinDout = 38;  // codec DOUT, data to MCU
 constexpr int kPinBclk = 42;
@@ -207,23 +206,8 @@ static void dtmf_fill_frame(DtmfGeneratorState *state, int16_t *dst, const size_
 static bool es8311_write_reg(uint8_t reg, uint8_t value) {
     bool ok = false;
     for (int attempt = 0; attempt < 2; ++attempt) {
-        I2C_Start();
-        ok = true;
-        if (I2C_Write((kEs8311Addr << 1) | I2C_WRITE) < 0) {
-            ok = false;
-            goto stop_once;
-        }
-        if (I2C_Write(reg) < 0) {
-            ok = false;
-            goto stop_once;
-        }
-        if (I2C_Write(value) < 0) {
-            ok = false;
-            goto stop_once;
-        }
-
-    stop_once:
-        I2C_Stop();
+        const uint8_t head[2] = {reg, value};
+        ok = I2CBUS_Write(I2CBUS_DEV_CODEC, head, sizeof(head), nullptr, 0) == I2CBUS_OK;
         if (ok) {
             return true;
         }
@@ -610,6 +594,7 @@ bool ES8311_Init(void) {
     es8311_apply_switch_level(ES8311_AUDIO_MODE_RECEIVE);
 
     I2C_Init();
+    I2CBUS_Init();
 
     if (!es8311_configure_codec()) {
         s_es8311_ready = false;
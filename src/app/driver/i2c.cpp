@@ -55,6 +55,13 @@ static inline void I2C_RestoreSharedPinsForKeyboard(void)
 
 // I2C 初始化
 void I2C_Init(void) {
+    // 只在第一次调用时配置：ES8311_Init / EEPROM_Init 会再调一次，
+    // 并行启动时此刻可能有别的任务正在总线上传输，重新配置引脚会打断它。
+    static bool inited;
+    if (inited)
+        return;
+    inited = true;
+
     // 配置引脚
     pinMode(I2C_PIN_EN, OUTPUT);
     // 某些外设使用该引脚作为 I2C 使能（常见为低有效）
@@ -0,0 +1,552 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "i2c_bus.h"
+#include "i2c1.h"
+#include <Arduino.h>
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV) && defined(ENABLE_I2C_BUS)
+#define I2CBUS_HW 1
+#include <driver/gpio.h>
+#include <driver/i2c.h>
+#include <esp_rom_gpio.h>
+#include <soc/i2c_periph.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#else
+#define I2CBUS_HW 0
+#endif
+
+typedef struct {
+    uint8_t  Address;   // 8-bit write address
+    uint8_t  Flags;     // OR'ed into every transaction
+    uint32_t ClockHz;
+} I2CBUS_Device_Info_t;
+
+// Indexed by I2CBUS_Device_t.
+static I2CBUS_Device_Info_t gI2cDevices[I2CBUS_DEV_COUNT] = {
+    {0xA0, 0,                                                I2CBUS_CLOCK_EEPROM},   // 24Cxx, A2..A0 from the address
+    {0xA2, 0,                                                I2CBUS_CLOCK_RTC},      // PCF8563
+    {0x30, 0,                                                I2CBUS_CLOCK_CODEC},    // ES8311
+    {0x22, I2CBUS_FLAG_IGNORE_NACK,                          I2CBUS_CLOCK_SI4732},
+    {0x80, I2CBUS_FLAG_IGNORE_NACK | I2CBUS_FLAG_NO_RESTART, I2CBUS_CLOCK_BK1080},
+};
+
+// i2c.cpp: three 5us delays per bit.
+static constexpr uint32_t I2CBUS_BITBANG_HZ = 1000000U / 15U;
+
+static bool gI2cBusReady;
+static uint32_t gI2cKeypadDeferred;
+static I2CBUS_Stats_t gI2cStats[I2CBUS_DEV_COUNT];
+static I2CBUS_Trace_t gI2cTrace[I2CBUS_TRACE_LENGTH];
+static uint16_t gI2cTraceHead;
+static uint16_t gI2cTraceCount;
+
+#if I2CBUS_HW
+static constexpr i2c_port_t I2CBUS_PORT = I2C_NUM_1;
+static constexpr uint32_t I2CBUS_TIMEOUT_BASE_MS = 20U;
+
+static SemaphoreHandle_t gI2cMutex;
+static QueueHandle_t gI2cQueue;
+static uint32_t gI2cInFlight;  // queued + running, updated atomically
+static uint32_t gI2cHwClock;
+static uint32_t gI2cClockLimitHz = 1000000U;
+static uint8_t gI2cCmdLink[I2C_LINK_RECOMMENDED_SIZE(8)];
+
+static inline bool I2CBUS_Lock(TickType_t wait)
+{
+    return xSemaphoreTake(gI2cMutex, wait) == pdTRUE;
+}
+
+static inline void I2CBUS_Unlock(void)
+{
+    xSemaphoreGive(gI2cMutex);
+}
+
+static void I2CBUS_HwAcquire(uint32_t clock)
+{
+    if (clock != gI2cHwClock) {
+        i2c_config_t conf = {};
+        conf.mode = I2C_MODE_MASTER;
+        conf.sda_io_num = I2C_PIN_SDA;
+        conf.scl_io_num = I2C_PIN_SCL;
+        conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
+        conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
+        conf.master.clk_speed = clock;
+        i2c_param_config(I2CBUS_PORT, &conf);
+        gI2cHwClock = clock;
+        return;
+    }
+    i2c_set_pin(I2CBUS_PORT, I2C_PIN_SDA, I2C_PIN_SCL, GPIO_PULLUP_ENABLE, GPIO_PULLUP_ENABLE, I2C_MODE_MASTER);
+}
+
+static void I2CBUS_HwRelease(void)
+{
+    // 把 KEY4/KEY5 还给键盘矩阵：普通 GPIO 输出高，I2C 输入信号接常高，
+    // 避免键盘扫描的电平变化被外设当成总线活动。
+    esp_rom_gpio_connect_out_signal(I2C_PIN_SDA, SIG_GPIO_OUT_IDX, false, false);
+    esp_rom_gpio_connect_out_signal(I2C_PIN_SCL, SIG_GPIO_OUT_IDX, false, false);
+#ifdef GPIO_MATRIX_CONST_ONE_INPUT
+    esp_rom_gpio_connect_in_signal(GPIO_MATRIX_CONST_ONE_INPUT, i2c_periph_signal[I2CBUS_PORT].sda_in_sig, false);
+    esp_rom_gpio_connect_in_signal(GPIO_MATRIX_CONST_ONE_INPUT, i2c_periph_signal[I2CBUS_PORT].scl_in_sig, false);
+#endif
+    gpio_set_level((gpio_num_t)I2C_PIN_SDA, 1);
+    gpio_set_level((gpio_num_t)I2C_PIN_SCL, 1);
+    gpio_set_direction((gpio_num_t)I2C_PIN_SDA, GPIO_MODE_OUTPUT);
+    gpio_set_direction((gpio_num_t)I2C_PIN_SCL, GPIO_MODE_OUTPUT);
+}
+
+static int I2CBUS_HwExecute(const I2CBUS_Xfer_t *pXfer, uint8_t address, uint8_t flags, uint32_t clock)
+{
+    const bool hasWrite = pXfer->HeadSize > 0U || pXfer->TxSize > 0U;
+    const bool ackCheck = (flags & I2CBUS_FLAG_IGNORE_NACK) == 0U;
+    const uint32_t bytes = 1U + pXfer->HeadSize + pXfer->TxSize + 1U + pXfer->RxSize;
+    const uint32_t timeoutMs = I2CBUS_TIMEOUT_BASE_MS + (bytes * 9U * 2000U) / clock;
+
+    I2CBUS_HwAcquire(clock);
+
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(gI2cCmdLink, sizeof(gI2cCmdLink));
+    if (hasWrite || pXfer->RxSize == 0U) {
+        i2c_master_start(cmd);
+        i2c_master_write_byte(cmd, address | I2C_WRITE, ackCheck);
+        if (pXfer->HeadSize > 0U) {
+            i2c_master_write(cmd, pXfer->Head, pXfer->HeadSize, ackCheck);
+        }
+        if (pXfer->TxSize > 0U) {
+            i2c_master_write(cmd, (const uint8_t *)pXfer->pTx, pXfer->TxSize, ackCheck);
+        }
+    }
+    if (pXfer->RxSize > 0U) {
+        if (!hasWrite || (flags & I2CBUS_FLAG_NO_RESTART) == 0U) {
+            i2c_master_start(cmd);
+            i2c_master_write_byte(cmd, address | I2C_READ, ackCheck);
+        }
+        i2c_master_read(cmd, (uint8_t *)pXfer->pRx, pXfer->RxSize, I2C_MASTER_LAST_NACK);
+    }
+    i2c_master_stop(cmd);
+
+    const esp_err_t err = i2c_master_cmd_begin(I2CBUS_PORT, cmd, pdMS_TO_TICKS(timeoutMs));
+    i2c_cmd_link_delete_static(cmd);
+
+    I2CBUS_HwRelease();
+
+    if (err == ESP_OK) {
+        return I2CBUS_OK;
+    }
+    return err == ESP_ERR_TIMEOUT ? I2CBUS_ERR_TIMEOUT : I2CBUS_ERR_NACK;
+}
+#else
+static bool gI2cLocked;
+
+static inline bool I2CBUS_Lock(uint32_t wait)
+{
+    (void)wait;
+    if (gI2cLocked) {
+        return false;
+    }
+    gI2cLocked = true;
+    return true;
+}
+
+static inline void I2CBUS_Unlock(void)
+{
+    gI2cLocked = false;
+}
+#endif
+
+static int I2CBUS_BitBangExecute(const I2CBUS_Xfer_t *pXfer, uint8_t address, uint8_t flags)
+{
+    const bool hasWrite = pXfer->HeadSize > 0U || pXfer->TxSize > 0U;
+    const bool ackCheck = (flags & I2CBUS_FLAG_IGNORE_NACK) == 0U;
+    const uint8_t *pTx = (const uint8_t *)pXfer->pTx;
+    uint8_t *pRx = (uint8_t *)pXfer->pRx;
+    bool nack = false;
+
+    I2C_Start();
+    if (hasWrite || pXfer->RxSize == 0U) {
+        nack |= I2C_Write(address | I2C_WRITE) < 0;
+        for (uint8_t i = 0; i < pXfer->HeadSize && !(nack && ackCheck); i++) {
+            nack |= I2C_Write(pXfer->Head[i]) < 0;
+        }
+        for (uint16_t i = 0; i < pXfer->TxSize && !(nack && ackCheck); i++) {
+            nack |= I2C_Write(pTx[i]) < 0;
+        }
+    }
+    if (pXfer->RxSize > 0U && !(nack && ackCheck)) {
+        if (!hasWrite || (flags & I2CBUS_FLAG_NO_RESTART) == 0U) {
+            I2C_Start();
+            nack |= I2C_Write(address | I2C_READ) < 0;
+        }
+        for (uint16_t i = 0; i < pXfer->RxSize && !(nack && ackCheck); i++) {
+            pRx[i] = I2C_Read(i == pXfer->RxSize - 1U);
+        }
+    }
+    I2C_Stop();
+
+    return (nack && ackCheck) ? I2CBUS_ERR_NACK : I2CBUS_OK;
+}
+
+static void I2CBUS_Record(const I2CBUS_Xfer_t *pXfer, uint8_t address, uint8_t flags, uint32_t startUs, uint32_t elapsedUs, int status)
+{
+    const uint16_t bytes = (uint16_t)(pXfer->HeadSize + pXfer->TxSize + pXfer->RxSize);
+    I2CBUS_Stats_t *pStats = &gI2cStats[pXfer->Device];
+
+    pStats->Count++;
+    pStats->Bytes += bytes;
+    pStats->BusyUs += elapsedUs;
+    if (elapsedUs > pStats->MaxUs) {
+        pStats->MaxUs = elapsedUs;
+    }
+    if (status != I2CBUS_OK) {
+        pStats->Errors++;
+    }
+
+    I2CBUS_Trace_t *pTrace = &gI2cTrace[gI2cTraceHead];
+    pTrace->StartUs = startUs;
+    pTrace->DurationUs = (uint16_t)(elapsedUs > 0xFFFFU ? 0xFFFFU : elapsedUs);
+    pTrace->Bytes = bytes;
+    pTrace->Device = pXfer->Device;
+    pTrace->Address = address;
+    pTrace->Flags = flags;
+    pTrace->Status = (int8_t)status;
+    gI2cTraceHead = (uint16_t)((gI2cTraceHead + 1U) % I2CBUS_TRACE_LENGTH);
+    if (gI2cTraceCount < I2CBUS_TRACE_LENGTH) {
+        gI2cTraceCount++;
+    }
+}
+
+// Caller holds the bus lock.
+static int I2CBUS_Execute(I2CBUS_Xfer_t *pXfer)
+{
+    const I2CBUS_Device_Info_t *pInfo = &gI2cDevices[pXfer->Device];
+    const uint8_t address = pXfer->Address ? pXfer->Address : pInfo->Address;
+    const uint8_t flags = (uint8_t)(pXfer->Flags | pInfo->Flags);
+    const uint32_t startUs = micros();
+    int status;
+
+#if I2CBUS_HW
+    if ((flags & I2CBUS_FLAG_BITBANG) == 0U) {
+        const uint32_t clock = pInfo->ClockHz < gI2cClockLimitHz ? pInfo->ClockHz : gI2cClockLimitHz;
+        status = I2CBUS_HwExecute(pXfer, address, flags, clock);
+    } else
+#endif
+    {
+        status = I2CBUS_BitBangExecute(pXfer, address, flags);
+    }
+
+    I2CBUS_Record(pXfer, address, flags, startUs, (uint32_t)(micros() - startUs), status);
+    pXfer->Status = (int8_t)status;
+    return status;
+}
+
+static inline bool I2CBUS_Valid(const I2CBUS_Xfer_t *pXfer)
+{
+    return pXfer != nullptr &&
+           pXfer->Device < I2CBUS_DEV_COUNT &&
+           pXfer->HeadSize <= sizeof(pXfer->Head) &&
+           (pXfer->TxSize == 0U || pXfer->pTx != nullptr) &&
+           (pXfer->RxSize == 0U || pXfer->pRx != nullptr);
+}
+
+#if I2CBUS_HW
+static void I2CBUS_Task(void *pArg)
+{
+    (void)pArg;
+    for (;;) {
+        I2CBUS_Xfer_t *pXfer;
+        if (xQueueReceive(gI2cQueue, &pXfer, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        I2CBUS_Lock(portMAX_DELAY);
+        I2CBUS_Execute(pXfer);
+        I2CBUS_Unlock();
+        if (pXfer->Callback) {
+            pXfer->Callback(pXfer);
+        }
+        __atomic_sub_fetch(&gI2cInFlight, 1U, __ATOMIC_SEQ_CST);
+    }
+}
+#endif
+
+void I2CBUS_Init(void)
+{
+    if (gI2cBusReady) {
+        return;
+    }
+
+#if I2CBUS_HW
+    gI2cMutex = xSemaphoreCreateMutex();
+    gI2cQueue = xQueueCreate(I2CBUS_QUEUE_LENGTH, sizeof(I2CBUS_Xfer_t *));
+    i2c_driver_install(I2CBUS_PORT, I2C_MODE_MASTER, 0, 0, 0);
+    xTaskCreatePinnedToCore(I2CBUS_Task, "i2c_bus", 3072, nullptr, 5, nullptr, 0);
+    gI2cBusReady = true;
+
+    // 快速时钟下 EEPROM 不应答：上拉可能不足以支撑快速模式，整条总线限速。
+    // 100kHz 也不应答时同样保持限速，慢速对任何器件都是安全的。
+    if (!I2CBUS_Probe(I2CBUS_DEV_EEPROM, 0)) {
+        gI2cClockLimitHz = I2CBUS_CLOCK_SAFE;
+    }
+#else
+    gI2cBusReady = true;
+#endif
+}
+
+int I2CBUS_Transfer(I2CBUS_Xfer_t *pXfer)
+{
+    if (!I2CBUS_Valid(pXfer)) {
+        return I2CBUS_ERR_PARAM;
+    }
+    if (!gI2cBusReady) {
+        I2CBUS_Init();
+    }
+
+#if I2CBUS_HW
+    I2CBUS_Lock(portMAX_DELAY);
+#else
+    I2CBUS_Lock(0);
+#endif
+    const int status = I2CBUS_Execute(pXfer);
+    I2CBUS_Unlock();
+    return status;
+}
+
+bool I2CBUS_Submit(I2CBUS_Xfer_t *pXfer)
+{
+    if (!I2CBUS_Valid(pXfer)) {
+        return false;
+    }
+    if (!gI2cBusReady) {
+        I2CBUS_Init();
+    }
+
+    pXfer->Status = I2CBUS_PENDING;
+#if I2CBUS_HW
+    __atomic_add_fetch(&gI2cInFlight, 1U, __ATOMIC_SEQ_CST);
+    if (xQueueSend(gI2cQueue, &pXfer, 0) != pdTRUE) {
+        __atomic_sub_fetch(&gI2cInFlight, 1U, __ATOMIC_SEQ_CST);
+        pXfer->Status = I2CBUS_ERR_PARAM;
+        return false;
+    }
+#else
+    I2CBUS_Transfer(pXfer);
+    if (pXfer->Callback) {
+        pXfer->Callback(pXfer);
+    }
+#endif
+    return true;
+}
+
+bool I2CBUS_IsIdle(void)
+{
+#if I2CBUS_HW
+    return __atomic_load_n(&gI2cInFlight, __ATOMIC_SEQ_CST) == 0U;
+#else
+    return true;
+#endif
+}
+
+void I2CBUS_WaitIdle(void)
+{
+#if I2CBUS_HW
+    while (!I2CBUS_IsIdle()) {
+        vTaskDelay(1);
+    }
+#endif
+}
+
+int I2CBUS_Write(uint8_t Device, const uint8_t *pHead, uint8_t HeadSize, const void *pData, uint16_t Size)
+{
+    I2CBUS_Xfer_t xfer = {};
+    xfer.Device = Device;
+    xfer.HeadSize = HeadSize;
+    if (HeadSize > sizeof(xfer.Head)) {
+        return I2CBUS_ERR_PARAM;
+    }
+    if (HeadSize > 0U) {
+        memcpy(xfer.Head, pHead, HeadSize);
+    }
+    xfer.pTx = pData;
+    xfer.TxSize = Size;
+    return I2CBUS_Transfer(&xfer);
+}
+
+int I2CBUS_Read(uint8_t Device, const uint8_t *pHead, uint8_t HeadSize, void *pData, uint16_t Size)
+{
+    I2CBUS_Xfer_t xfer = {};
+    xfer.Device = Device;
+    xfer.HeadSize = HeadSize;
+    if (HeadSize > sizeof(xfer.Head)) {
+        return I2CBUS_ERR_PARAM;
+    }
+    if (HeadSize > 0U) {
+        memcpy(xfer.Head, pHead, HeadSize);
+    }
+    xfer.pRx = pData;
+    xfer.RxSize = Size;
+    return I2CBUS_Transfer(&xfer);
+}
+
+bool I2CBUS_Probe(uint8_t Device, uint8_t Address)
+{
+    I2CBUS_Xfer_t xfer = {};
+    xfer.Device = Device;
+    xfer.Address = Address;
+    return I2CBUS_Transfer(&xfer) == I2CBUS_OK;
+}
+
+void I2CBUS_SetClock(uint8_t Device, uint32_t Hz)
+{
+    if (Device < I2CBUS_DEV_COUNT && Hz > 0U) {
+        gI2cDevices[Device].ClockHz = Hz;
+    }
+}
+
+uint32_t I2CBUS_GetClock(uint8_t Device)
+{
+    if (Device >= I2CBUS_DEV_COUNT) {
+        return 0;
+    }
+#if I2CBUS_HW
+    const uint32_t clock = gI2cDevices[Device].ClockHz;
+    return clock < gI2cClockLimitHz ? clock : gI2cClockLimitHz;
+#else
+    return I2CBUS_BITBANG_HZ;
+#endif
+}
+
+bool I2CBUS_KeypadLock(void)
+{
+    if (!gI2cBusReady) {
+        return true;
+    }
+    if (!I2CBUS_Lock(0)) {
+        gI2cKeypadDeferred++;
+        return false;
+    }
+    return true;
+}
+
+void I2CBUS_KeypadUnlock(void)
+{
+    if (gI2cBusReady) {
+        I2CBUS_Unlock();
+    }
+}
+
+uint32_t I2CBUS_KeypadDeferred(void)
+{
+    return gI2cKeypadDeferred;
+}
+
+void I2CBUS_GetStats(uint8_t Device, I2CBUS_Stats_t *pStats)
+{
+    if (Device < I2CBUS_DEV_COUNT && pStats != nullptr) {
+        *pStats = gI2cStats[Device];
+    }
+}
+
+void I2CBUS_ResetStats(void)
+{
+    memset(gI2cStats, 0, sizeof(gI2cStats));
+    gI2cTraceHead = 0;
+    gI2cTraceCount = 0;
+    gI2cKeypadDeferred = 0;
+}
+
+uint16_t I2CBUS_TraceCount(void)
+{
+    return gI2cTraceCount;
+}
+
+bool I2CBUS_TraceRead(uint16_t Index, I2CBUS_Trace_t *pTrace)
+{
+    if (Index >= gI2cTraceCount || pTrace == nullptr) {
+        return false;
+    }
+    const uint16_t slot = (uint16_t)((gI2cTraceHead + I2CBUS_TRACE_LENGTH - 1U - Index) % I2CBUS_TRACE_LENGTH);
+    *pTrace = gI2cTrace[slot];
+    return true;
+}
+
+bool I2CBUS_Benchmark(uint8_t Device, uint16_t Rounds, I2CBUS_Bench_t *pResult)
+{
+    static uint8_t buffer[256];
+    I2CBUS_Xfer_t xfer = {};
+
+    if (Device >= I2CBUS_DEV_COUNT || pResult == nullptr || Rounds == 0U) {
+        return false;
+    }
+    // 主循环里同步跑，主机给的轮数不能把界面和 CPS 卡住几十分钟
+    if (Rounds > I2CBUS_BENCH_MAX_ROUNDS) {
+        Rounds = I2CBUS_BENCH_MAX_ROUNDS;
+    }
+
+    // 每个设备选一个只读事务，不改变器件状态。
+    xfer.Device = Device;
+    xfer.pRx = buffer;
+    switch (Device) {
+        case I2CBUS_DEV_EEPROM:   // 256 bytes from word address 0
+            xfer.HeadSize = 2;
+            xfer.RxSize = sizeof(buffer);
+            break;
+        case I2CBUS_DEV_RTC:      // time registers 0x02..0x08
+            xfer.HeadSize = 1;
+            xfer.Head[0] = 0x02;
+            xfer.RxSize = 7;
+            break;
+        case I2CBUS_DEV_CODEC:    // chip ID 0xFD..0xFE
+            xfer.HeadSize = 1;
+            xfer.Head[0] = 0xFD;
+            xfer.RxSize = 2;
+            break;
+        case I2CBUS_DEV_SI4732:   // status byte
+            xfer.RxSize = 1;
+            break;
+        case I2CBUS_DEV_BK1080:   // REG_00 chip ID
+            xfer.HeadSize = 1;
+            xfer.Head[0] = (0x00 << 1) | I2C_READ;
+            xfer.RxSize = 2;
+            break;
+    }
+
+    memset(pResult, 0, sizeof(*pResult));
+    pResult->ClockHz = I2CBUS_GetClock(Device);
+    pResult->Bytes = (uint32_t)Rounds * (xfer.HeadSize + xfer.RxSize);
+
+#if I2CBUS_HW
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < Rounds; i++) {
+        if (I2CBUS_Transfer(&xfer) != I2CBUS_OK) {
+            pResult->HwErrors++;
+        }
+    }
+    pResult->HwUs = (uint32_t)(micros() - start);
+#endif
+
+    xfer.Flags = I2CBUS_FLAG_BITBANG;
+    const uint32_t bitbangStart = micros();
+    for (uint16_t i = 0; i < Rounds; i++) {
+        if (I2CBUS_Transfer(&xfer) != I2CBUS_OK) {
+            pResult->BitBangErrors++;
+        }
+    }
+    pResult->BitBangUs = (uint32_t)(micros() - bitbangStart);
+
+    return true;
+}
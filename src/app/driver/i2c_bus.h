@@ -0,0 +1,168 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef DRIVER_I2C_BUS_H
+#define DRIVER_I2C_BUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// I2C 总线管理器：EEPROM / PCF8563 / ES8311 / SI4732 / BK1080 共用一条总线。
+// 每次访问是一个完整的事务（START .. STOP），由管理器串行执行：
+// - ESP32-S3 (ENABLE_I2C_BUS)：硬件 I2C 外设，按设备切换时钟；
+//   事务之间把 SDA/SCL 还给键盘矩阵（KEY4/KEY5 复用）。
+// - 其它构建：沿用 i2c.cpp 的软件位操作。
+//
+// 事务格式：
+//   S addr+W Head[] Tx[]  Sr addr+R Rx[]  P
+// 没有 Head/Tx 时省略写阶段；没有 Rx 时省略读阶段；两者都没有 = 地址探测。
+// I2CBUS_FLAG_NO_RESTART：读阶段直接跟在写阶段后（BK1080 的寄存器读法）。
+
+// 各设备默认时钟（Hz），可用 -D 覆盖；外部上拉偏弱时 I2CBUS_Init 会自动降到 100kHz。
+#ifndef I2CBUS_CLOCK_EEPROM
+#define I2CBUS_CLOCK_EEPROM  400000U
+#endif
+#ifndef I2CBUS_CLOCK_RTC
+#define I2CBUS_CLOCK_RTC     400000U
+#endif
+#ifndef I2CBUS_CLOCK_CODEC
+#define I2CBUS_CLOCK_CODEC   400000U
+#endif
+#ifndef I2CBUS_CLOCK_SI4732
+#define I2CBUS_CLOCK_SI4732  400000U
+#endif
+#ifndef I2CBUS_CLOCK_BK1080
+#define I2CBUS_CLOCK_BK1080  100000U
+#endif
+
+#define I2CBUS_CLOCK_SAFE    100000U
+#define I2CBUS_QUEUE_LENGTH  8U
+#define I2CBUS_TRACE_LENGTH  64U
+// EEPROM worst case: 32 x 258 bytes at 100kHz plus bit-banged, about 2 s
+#define I2CBUS_BENCH_MAX_ROUNDS 32U
+
+enum I2CBUS_Device_t {
+    I2CBUS_DEV_EEPROM = 0,
+    I2CBUS_DEV_RTC,
+    I2CBUS_DEV_CODEC,
+    I2CBUS_DEV_SI4732,
+    I2CBUS_DEV_BK1080,
+    I2CBUS_DEV_COUNT
+};
+
+enum {
+    I2CBUS_OK          = 0,
+    I2CBUS_PENDING     = 1,
+    I2CBUS_ERR_NACK    = -1,
+    I2CBUS_ERR_TIMEOUT = -2,
+    I2CBUS_ERR_PARAM   = -3
+};
+
+enum {
+    I2CBUS_FLAG_NO_RESTART  = 1U << 0,  // Rx follows Head/Tx without Sr + address
+    I2CBUS_FLAG_IGNORE_NACK = 1U << 1,  // keep clocking after a NACK (legacy SI4732/BK1080 behaviour)
+    I2CBUS_FLAG_BITBANG     = 1U << 2   // force the software path (benchmark)
+};
+
+typedef struct I2CBUS_Xfer_s I2CBUS_Xfer_t;
+typedef void (*I2CBUS_Callback_t)(I2CBUS_Xfer_t *pXfer);
+
+struct I2CBUS_Xfer_s {
+    uint8_t           Device;     // I2CBUS_Device_t
+    uint8_t           Address;    // 8-bit write address, 0 = device default
+    uint8_t           Flags;
+    uint8_t           HeadSize;   // register / word address bytes, <= sizeof(Head)
+    uint8_t           Head[4];
+    const void       *pTx;
+    uint16_t          TxSize;
+    uint16_t          RxSize;
+    void             *pRx;
+    volatile int8_t   Status;     // I2CBUS_PENDING until completed
+    I2CBUS_Callback_t Callback;   // async only, runs in the bus task
+    void             *pContext;
+};
+
+typedef struct {
+    uint32_t Count;
+    uint32_t Bytes;
+    uint32_t Errors;
+    uint32_t BusyUs;
+    uint32_t MaxUs;
+} I2CBUS_Stats_t;
+
+typedef struct {
+    uint32_t StartUs;
+    uint16_t DurationUs;  // saturates at 0xFFFF
+    uint16_t Bytes;       // Head + Tx + Rx
+    uint8_t  Device;
+    uint8_t  Address;
+    uint8_t  Flags;
+    int8_t   Status;
+} I2CBUS_Trace_t;
+
+typedef struct {
+    uint32_t ClockHz;
+    uint32_t Bytes;       // payload per backend
+    uint32_t HwUs;        // 0 when the hardware backend is not built
+    uint32_t BitBangUs;
+    uint16_t HwErrors;
+    uint16_t BitBangErrors;
+} I2CBUS_Bench_t;
+
+void     I2CBUS_Init(void);
+
+// Blocking; returns I2CBUS_OK or an error.
+int      I2CBUS_Transfer(I2CBUS_Xfer_t *pXfer);
+
+// Queued; the caller keeps *pXfer and its buffers alive until Status leaves
+// I2CBUS_PENDING.  Returns false when the queue is full.
+bool     I2CBUS_Submit(I2CBUS_Xfer_t *pXfer);
+bool     I2CBUS_IsIdle(void);
+void     I2CBUS_WaitIdle(void);
+
+int      I2CBUS_Write(uint8_t Device, const uint8_t *pHead, uint8_t HeadSize, const void *pData, uint16_t Size);
+int      I2CBUS_Read(uint8_t Device, const uint8_t *pHead, uint8_t HeadSize, void *pData, uint16_t Size);
+bool     I2CBUS_Probe(uint8_t Device, uint8_t Address);
+
+void     I2CBUS_SetClock(uint8_t Device, uint32_t Hz);
+uint32_t I2CBUS_GetClock(uint8_t Device);
+
+// 键盘扫描前后调用；总线正忙时返回 false，本轮扫描沿用上次结果。
+bool     I2CBUS_KeypadLock(void);
+void     I2CBUS_KeypadUnlock(void);
+uint32_t I2CBUS_KeypadDeferred(void);
+
+void     I2CBUS_GetStats(uint8_t Device, I2CBUS_Stats_t *pStats);
+void     I2CBUS_ResetStats(void);
+
+// Index 0 is the newest transaction.
+uint16_t I2CBUS_TraceCount(void);
+bool     I2CBUS_TraceRead(uint16_t Index, I2CBUS_Trace_t *pTrace);
+
+// Runs Rounds read-only transactions on the hardware and the bit-banged path.
+// Blocks the caller; Rounds is capped at I2CBUS_BENCH_MAX_ROUNDS, Bytes shows
+// how many were actually run.
+bool     I2CBUS_Benchmark(uint8_t Device, uint16_t Rounds, I2CBUS_Bench_t *pResult);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DRIVER_I2C_BUS_H
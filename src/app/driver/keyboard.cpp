@@ -10,9 +10,20 @@
  */
 
 #include "keyboard.h"
+#include "i2c_bus.h"
+#include "../helper/keys.h"
 #ifndef ENABLE_OPENCV
+#include <Arduino.h>
 #include <driver/gpio.h>
 #include <esp_rom_sys.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <hal/gpio_ll.h>
+#include <soc/gpio_reg.h>
+#include "i2c1.h"
+#include "../helper/timerwheel.h"
+#include "../scheduler.h"
 #else
 #include "opencv/Arduino.hpp"
 #include "opencv/opencv_dis.hpp"
@@ -25,17 +36,13 @@ KEY_Code_t gKeyReading1 = KEY_INVALID;
 uint16_t gDebounceCounter = 0;
 bool gWasFKeyPressed = false;
 
-static uint32_t gKeyDownMask = 0;
-
-#ifndef ENABLE_OPENCV
 extern "C" bool KEYBOARD_IsKeyDown(KEY_Code_t key)
 {
     if (key < 0 || key >= KEY_INVALID) {
         return false;
     }
-    return (gKeyDownMask & (1u << static_cast<unsigned>(key))) != 0;
+    return (KEYS_DownMask() & KEYS_MASK(key)) != 0;
 }
-#endif
 
 #ifdef ENABLE_OPENCV
 static KEY_Code_t MapOpenCVKey(int key)
@@ -102,57 +109,42 @@ static KEY_Code_t MapOpenCVKey(int key)
     return KEY_INVALID;
 }
 
-static int KeyToOpenCVKey(KEY_Code_t key)
-{
-    switch (key) {
-    case KEY_SIDE1:
-        return GLFW_KEY_LEFT_BRACKET;
-    case KEY_SIDE2:
-        return GLFW_KEY_RIGHT_BRACKET;
-    case KEY_EXIT:
-        return GLFW_KEY_ESCAPE;
-    case KEY_MENU:
-        return GLFW_KEY_ENTER;
-    case KEY_PTT:
-        return GLFW_KEY_SPACE;
-    case KEY_F:
-        return GLFW_KEY_MINUS;
-    case KEY_STAR:
-        return GLFW_KEY_EQUAL;
-    default:
-        break;
-    }
-    return -1;
-}
+// Several desktop keys map to one radio key (2 and W), so a key is only
+// released when the last of them goes up.  GLFW key repeat is ignored: the
+// KEYS module generates its own.
+static uint8_t gHostKeyCount[KEY_INVALID];
 
-extern "C" bool KEYBOARD_IsKeyDown(KEY_Code_t key)
+static void HostKeyHandler(int key, int pressed)
 {
-    const int cvKey = KeyToOpenCVKey(key);
-    if (cvKey < 0) {
-        return false;
+    const KEY_Code_t k = MapOpenCVKey(key);
+    if (k == KEY_INVALID) {
+        return;
+    }
+    if (pressed) {
+        if (gHostKeyCount[k]++ == 0) {
+            KEYS_Input(static_cast<uint8_t>(k), true, KEYS_NowUs());
+        }
+    } else if (gHostKeyCount[k] > 0 && --gHostKeyCount[k] == 0) {
+        KEYS_Input(static_cast<uint8_t>(k), false, KEYS_NowUs());
     }
-    return OPENCV_IsKeyDown(cvKey) != 0;
 }
 
 void KEYBOARD_Init(void)
 {
+    KEYS_Init();
+    OPENCV_SetKeyHandler(HostKeyHandler);
+}
+
+// GLFW delivers key callbacks from glfwPollEvents on this thread
+void KEYBOARD_Update(void)
+{
+    OPENCV_PumpEvents();
 }
 
 KEY_Code_t KEYBOARD_Poll(void)
 {
     const int polled = OPENCV_PollKey();
-    KEY_Code_t get_key = MapOpenCVKey(polled);
-
-    // Best-effort key-down tracking for combos.
-    // (On desktop we can query instantaneous key state via GLFW.)
-    uint32_t mask = 0;
-    for (int k = 0; k < KEY_INVALID; ++k) {
-        if (KEYBOARD_IsKeyDown(static_cast<KEY_Code_t>(k))) {
-            mask |= (1u << static_cast<unsigned>(k));
-        }
-    }
-    gKeyDownMask = mask;
-    return get_key;
+    return MapOpenCVKey(polled);
 }
 
 KEY_Code_t GetKey(void)
@@ -225,12 +217,303 @@ static const struct {
     }
 };
 
+#define KEYBOARD_COLUMN_PINS ((1UL << GPIO_KEY4) | (1UL << GPIO_KEY5) | (1UL << GPIO_KEY6) | (1UL << GPIO_KEY7))
+#define KEYBOARD_ROW_PINS    ((1ULL << GPIO_KEY0) | (1ULL << GPIO_KEY1) | (1ULL << GPIO_KEY2) | (1ULL << GPIO_KEY3))
+
+static_assert(GPIO_KEY4 < 32 && GPIO_KEY5 < 32 && GPIO_KEY6 < 32 && GPIO_KEY7 < 32,
+              "column pins are driven through GPIO_OUT_W1TS/W1TC");
+static_assert(((1UL << I2C_PIN_SDA) | (1UL << I2C_PIN_SCL)) == ((1UL << GPIO_KEY4) | (1UL << GPIO_KEY5)),
+              "KEY4/KEY5 are the I2C lines");
+
+// Microsecond delay function
+static inline void delay_us(uint32_t us) {
+    esp_rom_delay_us(us);
+}
+
+// All four rows in one register read, bit n set = row n pulled low
+static inline uint8_t KEYBOARD_ReadRows(void) {
+    const uint64_t in = ((uint64_t)REG_READ(GPIO_IN1_REG) << 32) | REG_READ(GPIO_IN_REG);
+
+    return (uint8_t)~(((in >> GPIO_KEY0) & 1U) << 0 |
+                      ((in >> GPIO_KEY1) & 1U) << 1 |
+                      ((in >> GPIO_KEY2) & 1U) << 2 |
+                      ((in >> GPIO_KEY3) & 1U) << 3) & 0x0FU;
+}
+
+// All columns high.  SDA goes first: changing SCL while SDA is low would
+// otherwise look like a START to the devices on the bus.
+static inline void KEYBOARD_ReleaseColumns(void) {
+    REG_WRITE(GPIO_OUT_W1TS_REG, KEYBOARD_COLUMN_PINS & ~(1UL << I2C_PIN_SCL));
+    REG_WRITE(GPIO_OUT_W1TS_REG, 1UL << I2C_PIN_SCL);
+}
+
+// Levels left between scans: KEY4/KEY5 high (I2C idle), KEY6 low, KEY7 high
+static inline void KEYBOARD_ParkColumns(void) {
+    KEYBOARD_ReleaseColumns();
+    REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << GPIO_KEY6);
+}
+
+// Caller holds KeypadLock.  Returns false if a column never read back the
+// same twice (bouncing contact), leaving *pMask untouched.
+static bool KEYBOARD_ScanMatrix(uint32_t *pMask) {
+    uint32_t mask = 0;
+
+    for (unsigned int col = 0; col < sizeof(keyboard_matrix) / sizeof(keyboard_matrix[0]); col++) {
+        KEYBOARD_ReleaseColumns();
+
+        // Set the target column LOW (or keep all high for SIDE keys)
+        if (keyboard_matrix[col].column_pin != (gpio_num_t)0xFF) {
+            REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << keyboard_matrix[col].column_pin);
+        }
+
+        // Small delay to let signals settle
+        delay_us(10);
+
+        // Debouncing proper is done on timestamps by the caller; here only
+        // reject a reading taken mid-bounce.
+        const uint8_t state = KEYBOARD_ReadRows();
+        delay_us(1);
+        if (KEYBOARD_ReadRows() != state) {
+            return false;
+        }
+
+        for (unsigned int row = 0; row < 4; row++) {
+            const KEY_Code_t k = keyboard_matrix[col].rows[row].key;
+            if ((state & (1 << row)) != 0 && k != KEY_INVALID) {
+                mask |= (1u << static_cast<unsigned>(k));
+            }
+        }
+    }
+
+    *pMask = mask;
+    return true;
+}
+
+// First pressed key in scan order, same priority the polled scan always had
+static KEY_Code_t KEYBOARD_FirstKey(uint32_t mask) {
+    for (unsigned int col = 0; col < sizeof(keyboard_matrix) / sizeof(keyboard_matrix[0]); col++) {
+        for (unsigned int row = 0; row < 4; row++) {
+            const KEY_Code_t k = keyboard_matrix[col].rows[row].key;
+            if (k != KEY_INVALID && (mask & (1u << static_cast<unsigned>(k))) != 0) {
+                return k;
+            }
+        }
+    }
+    return KEY_INVALID;
+}
+
+// How long a new reading has to hold before it is reported
+#define KEYBOARD_DEBOUNCE_US    10000U
+
+// Debounced state, written by whoever scans (scan task or KEYBOARD_Update)
+static uint32_t gKeyStableMask;
+static uint32_t gKeyCandidate;
+static uint32_t gKeyCandidateUs;
+
+// A reading becomes the debounced state once it has held for
+// KEYBOARD_DEBOUNCE_US; the edges go to the KEYS queue stamped with the time
+// the level first appeared.  Releases go first so a rolled-over pair is never
+// reported as a chord.
+static void KEYBOARD_Debounce(uint32_t raw, uint32_t nowUs) {
+    if (raw != gKeyCandidate) {
+        gKeyCandidate = raw;
+        gKeyCandidateUs = nowUs;
+        return;
+    }
+
+    const uint32_t stable = gKeyStableMask;
+    if (raw == stable || nowUs - gKeyCandidateUs < KEYBOARD_DEBOUNCE_US) {
+        return;
+    }
+
+    const uint32_t changed = raw ^ stable;
+    for (unsigned int k = 0; k < KEY_INVALID; k++) {
+        if (changed & ~raw & (1u << k)) {
+            KEYS_Input((uint8_t)k, false, gKeyCandidateUs);
+        }
+    }
+    for (unsigned int k = 0; k < KEY_INVALID; k++) {
+        if (changed & raw & (1u << k)) {
+            KEYS_Input((uint8_t)k, true, gKeyCandidateUs);
+        }
+    }
+    __atomic_store_n(&gKeyStableMask, raw, __ATOMIC_RELAXED);
+    SCHEDULER_Notify(SCHEDULER_EVENT_KEY);
+}
+
+#ifdef ENABLE_KEYPAD_IRQ
+// Scan period while any key is down
+#define KEYBOARD_SCAN_MS        5U
+// Probe period for the KEY4/KEY5 columns while armed.  Each probe holds SDA
+// and SCL low for about 10us, so the pull-ups conduct ~0.05% of the time
+// instead of continuously.
+#define KEYBOARD_PROBE_MS       20U
+// Same core as the UI loop that consumes the events, below i2c_bus (5)
+#define KEYBOARD_TASK_PRIORITY  4
+#define KEYBOARD_TASK_CORE      1
+
+static TaskHandle_t gKeypadTask;
+// Set by the row interrupt, cleared by the task
+static volatile bool gKeypadIrq;
+
+// Idle: KEY6/KEY7 low, so their keys (and SIDE1/SIDE2, wired to ground) pull
+// a row down.  KEY4/KEY5 are the I2C lines and stay high; holding them low
+// would run current through the bus pull-ups for as long as the radio idles.
+static inline void KEYBOARD_ArmColumns(void) {
+    KEYBOARD_ReleaseColumns();
+    REG_WRITE(GPIO_OUT_W1TC_REG, (1UL << GPIO_KEY6) | (1UL << GPIO_KEY7));
+}
+
+// Caller holds KeypadLock.  Briefly pulls KEY4/KEY5 low to see whether a key
+// on those columns is down.  SCL falls first and SDA rises first, so the
+// devices on the bus never see a START.
+static bool KEYBOARD_ProbeI2cColumns(void) {
+    REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << I2C_PIN_SCL);
+    REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << I2C_PIN_SDA);
+    delay_us(10);
+    const bool down = KEYBOARD_ReadRows() != 0;
+    REG_WRITE(GPIO_OUT_W1TS_REG, 1UL << I2C_PIN_SDA);
+    REG_WRITE(GPIO_OUT_W1TS_REG, 1UL << I2C_PIN_SCL);
+    return down;
+}
+
+static inline void IRAM_ATTR KEYBOARD_DisableRowIrq(void) {
+    gpio_ll_intr_disable(&GPIO, GPIO_KEY0);
+    gpio_ll_intr_disable(&GPIO, GPIO_KEY1);
+    gpio_ll_intr_disable(&GPIO, GPIO_KEY2);
+    gpio_ll_intr_disable(&GPIO, GPIO_KEY3);
+}
+
+// Any row falling edge.  One wake-up per burst of activity: the rows stay
+// masked until the task has seen everything released again.
+static void IRAM_ATTR KEYBOARD_Irq(void *pArg) {
+    BaseType_t woken = pdFALSE;
+
+    (void)pArg;
+    KEYBOARD_DisableRowIrq();
+    gKeypadIrq = true;
+    vTaskNotifyGiveFromISR(gKeypadTask, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void KEYBOARD_Tick(void *pArg) {
+    (void)pArg;
+    xTaskNotifyGive(gKeypadTask);
+}
+
+static TIMERWHEEL_Timer_t gKeypadTimer = TIMERWHEEL_TIMER(KEYBOARD_Tick, NULL);
+
+// Caller holds KeypadLock.  Rows are read once more after the interrupts
+// are enabled, so a press landing between the last scan and the enable is
+// not lost.
+static bool KEYBOARD_Arm(void) {
+    KEYBOARD_ArmColumns();
+    delay_us(10);
+
+    gpio_ll_clear_intr_status(&GPIO, (uint32_t)KEYBOARD_ROW_PINS);
+    gpio_ll_clear_intr_status_high(&GPIO, (uint32_t)(KEYBOARD_ROW_PINS >> 32));
+    gpio_intr_enable(GPIO_KEY0);
+    gpio_intr_enable(GPIO_KEY1);
+    gpio_intr_enable(GPIO_KEY2);
+    gpio_intr_enable(GPIO_KEY3);
+
+    if (KEYBOARD_ReadRows() == 0) {
+        return true;
+    }
+    KEYBOARD_DisableRowIrq();
+    return false;
+}
+
+// Armed wake-up, from the row interrupt or the probe timer.  Returns true
+// when a key is down and the matrix has to be scanned.
+static bool KEYBOARD_Wake(void) {
+    if (gKeypadIrq) {
+        gKeypadIrq = false;
+        return true;
+    }
+    // Bus busy: probe again next period
+    if (!I2CBUS_KeypadLock()) {
+        return false;
+    }
+    const bool down = KEYBOARD_ProbeI2cColumns();
+    I2CBUS_KeypadUnlock();
+    if (down) {
+        KEYBOARD_DisableRowIrq();
+    }
+    return down;
+}
+
+// One scan.  Returns true once everything is released, reported and the
+// matrix is armed again.
+static bool KEYBOARD_Service(void) {
+    uint32_t raw;
+    bool armed = false;
+
+    // Bus busy: try again on the next tick
+    if (!I2CBUS_KeypadLock()) {
+        return false;
+    }
+
+    if (KEYBOARD_ScanMatrix(&raw)) {
+        KEYBOARD_Debounce(raw, (uint32_t)esp_timer_get_time());
+        if (raw == 0 && gKeyStableMask == 0) {
+            armed = KEYBOARD_Arm();
+        }
+    }
+    if (!armed) {
+        KEYBOARD_ParkColumns();
+    }
+
+    I2CBUS_KeypadUnlock();
+    return armed;
+}
+
+static void KEYBOARD_Task(void *pArg) {
+    (void)pArg;
+    for (;;) {
+        // Armed: a row interrupt, or a KEY4/KEY5 probe, finds the next press
+        TIMERWHEEL_Start(&gKeypadTimer, KEYBOARD_PROBE_MS, KEYBOARD_PROBE_MS);
+        do {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        } while (!KEYBOARD_Wake());
+
+        TIMERWHEEL_Start(&gKeypadTimer, KEYBOARD_SCAN_MS, KEYBOARD_SCAN_MS);
+        while (!KEYBOARD_Service()) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+}
+
+static void KEYBOARD_StartScanner(void) {
+    if (gKeypadTask) {
+        return;
+    }
+    if (xTaskCreatePinnedToCore(KEYBOARD_Task, "keypad", 3072, NULL, KEYBOARD_TASK_PRIORITY, &gKeypadTask,
+                                KEYBOARD_TASK_CORE) != pdPASS) {
+        // Without the task KEYBOARD_Poll keeps scanning on every call
+        gKeypadTask = NULL;
+        return;
+    }
+
+    attachInterruptArg(GPIO_KEY0, KEYBOARD_Irq, NULL, FALLING);
+    attachInterruptArg(GPIO_KEY1, KEYBOARD_Irq, NULL, FALLING);
+    attachInterruptArg(GPIO_KEY2, KEYBOARD_Irq, NULL, FALLING);
+    attachInterruptArg(GPIO_KEY3, KEYBOARD_Irq, NULL, FALLING);
+    KEYBOARD_DisableRowIrq();
+
+    // Scan once straight away: a key may already be held for a boot chord
+    gKeypadIrq = true;
+    xTaskNotifyGive(gKeypadTask);
+}
+#endif
+
 // Initialize keyboard GPIOs
 void KEYBOARD_Init(void) {
     // Configure row pins (KEY0-KEY3) as inputs with pull-up
     gpio_config_t row_config = {
-        .pin_bit_mask = (1ULL << GPIO_KEY0) | (1ULL << GPIO_KEY1) | 
-                        (1ULL << GPIO_KEY2) | (1ULL << GPIO_KEY3),
+        .pin_bit_mask = KEYBOARD_ROW_PINS,
         .mode = GPIO_MODE_INPUT,
         .pull_up_en = GPIO_PULLUP_ENABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
@@ -240,8 +523,7 @@ void KEYBOARD_Init(void) {
     
     // Configure column pins (KEY4-KEY7) as outputs, initially HIGH
     gpio_config_t col_config = {
-        .pin_bit_mask = (1ULL << GPIO_KEY4) | (1ULL << GPIO_KEY5) | 
-                        (1ULL << GPIO_KEY6) | (1ULL << GPIO_KEY7),
+        .pin_bit_mask = KEYBOARD_COLUMN_PINS,
         .mode = GPIO_MODE_OUTPUT,
         .pull_up_en = GPIO_PULLUP_DISABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
@@ -250,10 +532,7 @@ void KEYBOARD_Init(void) {
     gpio_config(&col_config);
     
     // Set all column pins HIGH initially
-    gpio_set_level(GPIO_KEY4, 1);
-    gpio_set_level(GPIO_KEY5, 1);
-    gpio_set_level(GPIO_KEY6, 1);
-    gpio_set_level(GPIO_KEY7, 1);
+    KEYBOARD_ReleaseColumns();
     
     // Configure PTT button as input with pull-up (active low)
     gpio_config_t ptt_config = {
@@ -264,89 +543,60 @@ void KEYBOARD_Init(void) {
         .intr_type = GPIO_INTR_DISABLE
     };
     gpio_config(&ptt_config);
+
+    KEYS_Init();
+#ifdef ENABLE_KEYPAD_IRQ
+    KEYBOARD_StartScanner();
+#endif
 }
 
-// Microsecond delay function
-static inline void delay_us(uint32_t us) {
-    esp_rom_delay_us(us);
+// Without the scan task the KEYS queue is fed from here, every 10 ms from
+// CheckKeys or while someone waits in KEYS_Wait.
+void KEYBOARD_Update(void) {
+    uint32_t raw;
+
+#ifdef ENABLE_KEYPAD_IRQ
+    if (gKeypadTask) {
+        return;
+    }
+#endif
+    if (!I2CBUS_KeypadLock()) {
+        return;
+    }
+    const bool ok = KEYBOARD_ScanMatrix(&raw);
+    KEYBOARD_ParkColumns();
+    I2CBUS_KeypadUnlock();
+
+    if (ok) {
+        KEYBOARD_Debounce(raw, (uint32_t)esp_timer_get_time());
+    }
 }
 
 // Poll keyboard matrix
 KEY_Code_t KEYBOARD_Poll(void) {
-    KEY_Code_t Key = KEY_INVALID;
-    uint32_t pressedMask = 0;
-    
-    // Scan through each column configuration
-    for (unsigned int col = 0; col < sizeof(keyboard_matrix) / sizeof(keyboard_matrix[0]); col++) {
-        // Set all column pins HIGH first
-        gpio_set_level(GPIO_KEY4, 1);
-        gpio_set_level(GPIO_KEY5, 1);
-        gpio_set_level(GPIO_KEY6, 1);
-        gpio_set_level(GPIO_KEY7, 1);
-        
-        // Set the target column LOW (or keep all high for SIDE keys)
-        if (keyboard_matrix[col].column_pin != (gpio_num_t)0xFF) {
-            gpio_set_level(keyboard_matrix[col].column_pin, 0);
-        }
-        
-        // Small delay to let signals settle
-        delay_us(10);
-        
-        // Read row pins with de-bounce (multiple samples)
-        int stable_reads = 0;
-        uint8_t last_state = 0;
-        uint8_t current_state = 0;
-        
-        for (int sample = 0; sample < 8 && stable_reads < 3; sample++) {
-            delay_us(1);
-            
-            // Read all 4 row pins
-            current_state = 0;
-            current_state |= (!gpio_get_level(GPIO_KEY0)) ? (1 << 0) : 0;
-            current_state |= (!gpio_get_level(GPIO_KEY1)) ? (1 << 1) : 0;
-            current_state |= (!gpio_get_level(GPIO_KEY2)) ? (1 << 2) : 0;
-            current_state |= (!gpio_get_level(GPIO_KEY3)) ? (1 << 3) : 0;
-            
-            // Check if reading is stable
-            if (current_state == last_state) {
-                stable_reads++;
-            } else {
-                stable_reads = 0;
-                last_state = current_state;
-            }
-        }
-        
-        // If noise is too bad, abort
-        if (stable_reads < 3) {
-            break;
-        }
-        
-        // Collect all pressed keys for this column.
-        for (unsigned int row = 0; row < 4; row++) {
-            if ((current_state & (1 << row)) == 0) {
-                continue;
-            }
-            const KEY_Code_t k = keyboard_matrix[col].rows[row].key;
-            if (k != KEY_INVALID) {
-                pressedMask |= (1u << static_cast<unsigned>(k));
-                if (Key == KEY_INVALID) {
-                    Key = k;
-                }
-            }
-        }
+    static KEY_Code_t lastKey = KEY_INVALID;
+    uint32_t pressedMask;
+
+#ifdef ENABLE_KEYPAD_IRQ
+    // The scan task owns the matrix; just report its debounced state
+    if (gKeypadTask) {
+        return KEYBOARD_FirstKey(__atomic_load_n(&gKeyStableMask, __ATOMIC_RELAXED));
     }
-    
-    // Restore I2C pins to HIGH (KEY4 and KEY5 are shared with I2C)
-    // This is important to not interfere with I2C communication
-    gpio_set_level(GPIO_KEY4, 1);
-    gpio_set_level(GPIO_KEY5, 1);
-    
-    // Reset other column pins
-    gpio_set_level(GPIO_KEY6, 0);
-    gpio_set_level(GPIO_KEY7, 1);
-    
-    gKeyDownMask = pressedMask;
-    return Key;
+#endif
+
+    // KEY4/KEY5 are SDA/SCL: while an I2C transaction owns the bus, keep the
+    // previous reading instead of driving the columns.
+    if (!I2CBUS_KeypadLock()) {
+        return lastKey;
+    }
+    const bool ok = KEYBOARD_ScanMatrix(&pressedMask);
+    KEYBOARD_ParkColumns();
+    I2CBUS_KeypadUnlock();
+
+    if (ok) {
+        lastKey = KEYBOARD_FirstKey(pressedMask);
+    }
+    return lastKey;
 }
 
 // Get key including PTT button check
@@ -21,8 +21,8 @@ extern "C" {
 #define GPIO_KEY3   ((gpio_num_t)17)  // Row 3
 
 // Column pins (outputs)
-#define GPIO_KEY4   ((gpio_num_t)14)  // Column 0 (Shared with I2C SDA)
-#define GPIO_KEY5   ((gpio_num_t)13)  // Column 1 (Shared with I2C SCL)
+#define GPIO_KEY4   ((gpio_num_t)14)  // Column 0 (Shared with I2C SCL)
+#define GPIO_KEY5   ((gpio_num_t)13)  // Column 1 (Shared with I2C SDA)
 #define GPIO_KEY6   ((gpio_num_t)12)  // Column 2
 #define GPIO_KEY7   ((gpio_num_t)11)  // Column 3
 #define GPIOA_PIN_VOICE_0  GPIO_KEY6
@@ -69,6 +69,14 @@ KEY_Code_t KEYBOARD_Poll(void);
 KEY_Code_t GetKey(void);
 bool KEYBOARD_IsKeyDown(KEY_Code_t key);
 
+// Debounced edges go to the key event queue (helper/keys.h).  With
+// ENABLE_KEYPAD_IRQ the matrix is idle until a row interrupt fires (or a
+// 20 ms probe of the KEY4/KEY5 columns, which are the I2C lines and stay
+// high while idle, finds a key) and a scan task feeds the queue; otherwise (and in the simulator, which pumps
+// GLFW events) KEYBOARD_Update() does it and has to be called every 10 ms.
+// KEYBOARD_Poll() returns the debounced state while the scan task runs.
+void KEYBOARD_Update(void);
+
 #ifdef __cplusplus
 }
 #endif
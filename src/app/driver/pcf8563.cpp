@@ -1,6 +1,6 @@
 #include "pcf8563.h"
 
-#include "i2c1.h"
+#include "i2c_bus.h"
 #include <Arduino.h>
 
 static inline uint8_t pcf8563_addr_write(void)
@@ -8,11 +8,6 @@ static inline uint8_t pcf8563_addr_write(void)
     return (uint8_t)((PCF8563_I2C_ADDR_7BIT << 1) | 0U);
 }
 
-static inline uint8_t pcf8563_addr_read(void)
-{
-    return (uint8_t)((PCF8563_I2C_ADDR_7BIT << 1) | 1U);
-}
-
 static inline uint8_t bcd2dec(uint8_t v)
 {
     return (uint8_t)(((v >> 4) * 10U) + (v & 0x0FU));
@@ -25,15 +20,7 @@ static inline uint8_t dec2bcd(uint8_t v)
 
 bool PCF8563_Probe(void)
 {
-    const uint8_t addr_w = pcf8563_addr_write();
-
-    noInterrupts();
-    I2C_Start();
-    const int ack = I2C_Write(addr_w);
-    I2C_Stop();
-    interrupts();
-
-    return ack == 0;
+    return I2CBUS_Probe(I2CBUS_DEV_RTC, pcf8563_addr_write());
 }
 
 bool PCF8563_ReadRaw(uint8_t reg, void *buf, uint8_t len)
@@ -42,30 +29,7 @@ bool PCF8563_ReadRaw(uint8_t reg, void *buf, uint8_t len)
         return false;
     }
 
-    const uint8_t addr_w = pcf8563_addr_write();
-    const uint8_t addr_r = pcf8563_addr_read();
-
-    noInterrupts();
-
-    I2C_Start();
-    if (I2C_Write(addr_w) < 0 || I2C_Write(reg) < 0) {
-        I2C_Stop();
-        interrupts();
-        return false;
-    }
-
-    I2C_Start();
-    if (I2C_Write(addr_r) < 0) {
-        I2C_Stop();
-        interrupts();
-        return false;
-    }
-
-    I2C_ReadBuffer(buf, len);
-    I2C_Stop();
-
-    interrupts();
-    return true;
+    return I2CBUS_Read(I2CBUS_DEV_RTC, &reg, 1, buf, len) == I2CBUS_OK;
 }
 
 bool PCF8563_WriteRaw(uint8_t reg, const void *buf, uint8_t len)
@@ -74,20 +38,7 @@ bool PCF8563_WriteRaw(uint8_t reg, const void *buf, uint8_t len)
         return false;
     }
 
-    const uint8_t addr_w = pcf8563_addr_write();
-
-    noInterrupts();
-
-    I2C_Start();
-    if (I2C_Write(addr_w) < 0 || I2C_Write(reg) < 0 || I2C_WriteBuffer(buf, len) < 0) {
-        I2C_Stop();
-        interrupts();
-        return false;
-    }
-
-    I2C_Stop();
-    interrupts();
-    return true;
+    return I2CBUS_Write(I2CBUS_DEV_RTC, &reg, 1, buf, len) == I2CBUS_OK;
 }
 
 bool PCF8563_ReadTime(pcf8563_time_t *t)
@@ -8,11 +8,10 @@
 #include "../audio.h"
 #include "eeprom.h"
 #include "i2c1.h"
+#include "i2c_bus.h"
 #include "system.h"
 #include "systick.h"
 
-static const uint8_t SI47XX_I2C_ADDR = 0x22;
-
 // SI473X Reset pin (adjust to match your hardware)
 #define SI473X_RST_PIN ((gpio_num_t)I2C_PIN_EN)
 
@@ -27,17 +26,11 @@ SI47XX_MODE si4732mode = SI47XX_FM;
 uint16_t siCurrentFreq = 10210;
 
 void SI47XX_ReadBuffer(uint8_t *buf, uint8_t size) {
-  I2C_Start();
-  I2C_Write(SI47XX_I2C_ADDR + 1);
-  I2C_ReadBuffer(buf, size);
-  I2C_Stop();
+  I2CBUS_Read(I2CBUS_DEV_SI4732, NULL, 0, buf, size);
 }
 
 void SI47XX_WriteBuffer(uint8_t *buf, uint8_t size) {
-  I2C_Start();
-  I2C_Write(SI47XX_I2C_ADDR);
-  I2C_WriteBuffer(buf, size);
-  I2C_Stop();
+  I2CBUS_Write(I2CBUS_DEV_SI4732, NULL, 0, buf, size);
 }
 
 bool SI47XX_IsSSB() {
@@ -204,20 +197,23 @@ void SI47XX_SsbSetup(SI47XX_SsbFilterBW AUDIOBW, uint8_t SBCUTFLT,
                (currentSsbMode.raw[1] << 8) | currentSsbMode.raw[0]);
 }
 
+// Spans from EEPROM_ReadStream are multiples of 8 here: the patch starts on an
+// 8-byte boundary and spans only break at 4KB sectors / the scratch size.
+static bool SI47XX_SendPatchSpan(uint32_t Address, const uint8_t *pData, uint32_t Size, void *pContext) {
+    (void)Address;
+    (void)pContext;
+    for (uint32_t i = 0; i < Size; i += 8) {
+        waitToSend();
+        SI47XX_WriteBuffer((uint8_t *)pData + i, 8);
+    }
+    return true;
+}
+
 bool SI47XX_downloadPatch() {
-    uint8_t buf[248];
-//    const uint8_t PAGE_SIZE = SETTINGS_GetPageSize();
+    uint8_t buf[256];
     const uint32_t EEPROM_SIZE = 262144;
     const uint32_t PATCH_START = EEPROM_SIZE - PATCH_SIZE;
-    for (uint16_t offset = 0; offset < PATCH_SIZE; offset += 248) {
-        uint32_t eepromN = PATCH_SIZE - offset > 248 ? 248 : PATCH_SIZE - offset;
-        EEPROM_ReadBuffer(PATCH_START + offset, buf, eepromN);
-        for (uint8_t i = 0; i < eepromN; i += 8) {
-            waitToSend();
-            SI47XX_WriteBuffer(buf + i, 8);
-        }
-    }
-    return true;
+    return EEPROM_ReadStream(PATCH_START, PATCH_SIZE, buf, sizeof(buf), SI47XX_SendPatchSpan, NULL);
 }
 void SI47XX_PatchPowerUp() {
     // Initialize RST pin as output
@@ -15,6 +15,8 @@
  */
 
 #include "st7565.h"
+#include "../helper/profiler.h"
+#include "../helper/trace.h"
 #ifndef ENABLE_OPENCV
 #include <Arduino.h>
 #include <SPI.h>
@@ -183,6 +185,8 @@ void ST7565_DrawLine(const unsigned int column, const unsigned int line, const u
 
 // 刷新整个屏幕
 void ST7565_BlitFullScreen(void) {
+    PROFILER_ZONE(LCD_BLIT);
+    TRACE(PRESENT, TRACE_PRESENT_FULL, 0);
     SPI_BEGIN();
     CS_LOW();
     ST7565_WriteByte_NoCS(0x40);  // 设置起始行
@@ -206,6 +210,8 @@ void ST7565_BlitFullScreen(void) {
 
 // 刷新单行
 void ST7565_BlitLine(unsigned line) {
+    PROFILER_ZONE(LCD_LINE);
+    TRACE(PRESENT, TRACE_PRESENT_LINE, line);
     SPI_BEGIN();
     CS_LOW();
     ST7565_WriteByte_NoCS(0x40);  // 设置起始行
@@ -224,6 +230,8 @@ void ST7565_BlitLine(unsigned line) {
 
 // 刷新状态行
 void ST7565_BlitStatusLine(void) {
+    PROFILER_ZONE(LCD_LINE);
+    TRACE(PRESENT, TRACE_PRESENT_STATUS, 0);
     SPI_BEGIN();
     CS_LOW();
     ST7565_WriteByte_NoCS(0x40);  // 设置起始行
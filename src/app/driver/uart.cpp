@@ -52,3 +52,18 @@ int UART_Read(void) {
     }
     return -1;
 }
+
+uint32_t UART_ReadBuffer(void *pBuffer, uint32_t size) {
+    if (!uart || size == 0) {
+        return 0;
+    }
+    const uint32_t available = uartAvailable(uart);
+    if (size > available) {
+        size = available;
+    }
+    return size ? (uint32_t)uartReadBytes(uart, (uint8_t *)pBuffer, size, 0) : 0;
+}
+
+uint32_t UART_TxFree(void) {
+    return uart ? uartAvailableForWrite(uart) : 0;
+}
@@ -25,6 +25,12 @@ int UART_Available(void);
 // Read one byte from UART
 int UART_Read(void);
 
+// Read up to size bytes that are already received; never waits
+uint32_t UART_ReadBuffer(void *pBuffer, uint32_t size);
+
+// Bytes UART_Send can queue right now without waiting for the TX FIFO to drain
+uint32_t UART_TxFree(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #include "app/fm.h"
 #endif
 
+#include "app/radiotask.h"
 #include "audio.h"
 #include "dcs.h"
 #include "driver/backlight.h"
@@ -102,7 +103,11 @@ void FUNCTION_Foreground(const FUNCTION_Type_t PreviousFunction) {
         RADIO_PrepareCssTX();
 #endif
     if (PreviousFunction == FUNCTION_TRANSMIT) {
-        ST7565_FixInterfGlitch();
+        // 电台任务不碰屏幕，留给主循环下一帧
+        if (RADIOTASK_IsCurrent())
+            gFixInterfGlitch = true;
+        else
+            ST7565_FixInterfGlitch();
         gVFO_RSSI_bar_level[0] = 0;
         gVFO_RSSI_bar_level[1] = 0;
     } else if (PreviousFunction != FUNCTION_RECEIVE) {
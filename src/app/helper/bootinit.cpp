@@ -0,0 +1,197 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_private/esp_clk.h>
+#include <hal/cpu_hal.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/task.h>
+#else
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include <stdio.h>
+
+#include "bootinit.h"
+
+static BOOTINIT_Trace_t gBootTrace[BOOTINIT_TRACE_MAX];
+static uint8_t gBootTraceCount;
+
+#ifndef ENABLE_OPENCV
+static inline uint32_t BOOTINIT_NowUs(void)  { return (uint32_t)esp_timer_get_time(); }
+static inline uint32_t BOOTINIT_Cycles(void) { return cpu_hal_get_cycle_count(); }
+static inline uint8_t  BOOTINIT_Core(void)   { return (uint8_t)xPortGetCoreID(); }
+static inline uint32_t BOOTINIT_Mhz(void)    { return getCpuFrequencyMhz(); }
+// RTC 计时器软件复位不清零，减去 esp_timer 即本程序在上电后多久开始运行（含 factory 那一趟）
+static inline uint32_t BOOTINIT_AppStartUs(void) { return (uint32_t)(esp_clk_rtc_time() - esp_timer_get_time()); }
+#else
+static inline uint32_t BOOTINIT_NowUs(void)  { return (uint32_t)micros(); }
+static inline uint32_t BOOTINIT_Cycles(void) { return (uint32_t)micros(); }
+static inline uint8_t  BOOTINIT_Core(void)   { return 0; }
+static inline uint32_t BOOTINIT_Mhz(void)    { return 1; }
+static inline uint32_t BOOTINIT_AppStartUs(void) { return 0; }
+#endif
+
+// 返回 BOOTINIT_TRACE_MAX 表示记录已满，End 时忽略
+static uint8_t BOOTINIT_Alloc(void)
+{
+    const uint8_t id = __atomic_fetch_add(&gBootTraceCount, 1, __ATOMIC_RELAXED);
+    if (id >= BOOTINIT_TRACE_MAX) {
+        __atomic_store_n(&gBootTraceCount, BOOTINIT_TRACE_MAX, __ATOMIC_RELAXED);
+        return BOOTINIT_TRACE_MAX;
+    }
+    return id;
+}
+
+uint8_t BOOTINIT_TraceBegin(const char *pName)
+{
+    const uint8_t id = BOOTINIT_Alloc();
+    if (id < BOOTINIT_TRACE_MAX) {
+        BOOTINIT_Trace_t *p = &gBootTrace[id];
+        p->Name = pName;
+        p->Core = BOOTINIT_Core();
+        p->StartUs = BOOTINIT_NowUs();
+        p->Cycles = BOOTINIT_Cycles();
+    }
+    return id;
+}
+
+// 须在 Begin 的同一任务里调用；初始化任务都钉在固定核上，CCOUNT 差值有效
+void BOOTINIT_TraceEnd(uint8_t Id)
+{
+    if (Id < BOOTINIT_TRACE_MAX)
+        gBootTrace[Id].Cycles = BOOTINIT_Cycles() - gBootTrace[Id].Cycles;
+}
+
+void BOOTINIT_Mark(const char *pName)
+{
+    const uint8_t id = BOOTINIT_Alloc();
+    if (id < BOOTINIT_TRACE_MAX) {
+        gBootTrace[id].Name = pName;
+        gBootTrace[id].Core = BOOTINIT_Core();
+        gBootTrace[id].StartUs = BOOTINIT_NowUs();
+        gBootTrace[id].Cycles = 0;
+    }
+}
+
+uint8_t BOOTINIT_TraceCount(void)
+{
+    return gBootTraceCount;
+}
+
+bool BOOTINIT_TraceRead(uint8_t Index, BOOTINIT_Trace_t *pTrace)
+{
+    if (Index >= gBootTraceCount)
+        return false;
+    *pTrace = gBootTrace[Index];
+    return true;
+}
+
+void BOOTINIT_Print(void)
+{
+    const uint32_t mhz = BOOTINIT_Mhz();
+    char line[64];
+
+    snprintf(line, sizeof(line), "[BOOT] app started %.1f ms after power-on", BOOTINIT_AppStartUs() / 1000.0f);
+    Serial.println(line);
+    snprintf(line, sizeof(line), "[BOOT] step            core  start_ms    dur_ms");
+    Serial.println(line);
+    for (uint8_t i = 0; i < gBootTraceCount; i++) {
+        const BOOTINIT_Trace_t *p = &gBootTrace[i];
+        if (p->Cycles == 0) {
+            snprintf(line, sizeof(line), "[BOOT] %-16s  %u  %8.1f         *", p->Name, p->Core, p->StartUs / 1000.0f);
+        } else {
+            snprintf(line, sizeof(line), "[BOOT] %-16s  %u  %8.1f  %8.2f", p->Name, p->Core, p->StartUs / 1000.0f,
+                     p->Cycles / (float)mhz / 1000.0f);
+        }
+        Serial.println(line);
+    }
+}
+
+static void BOOTINIT_RunStep(const BOOTINIT_Step_t *pStep)
+{
+    const uint8_t id = BOOTINIT_TraceBegin(pStep->Name);
+    pStep->pInit();
+    BOOTINIT_TraceEnd(id);
+}
+
+#ifndef ENABLE_OPENCV
+typedef struct {
+    const BOOTINIT_Step_t *pStep;
+    EventGroupHandle_t     Events;
+} BOOTINIT_Task_t;
+
+static void BOOTINIT_Task(void *pArg)
+{
+    const BOOTINIT_Task_t *pTask = (const BOOTINIT_Task_t *)pArg;
+    const BOOTINIT_Step_t *pStep = pTask->pStep;
+
+    if (pStep->Needs)
+        xEventGroupWaitBits(pTask->Events, pStep->Needs, pdFALSE, pdTRUE, portMAX_DELAY);
+    BOOTINIT_RunStep(pStep);
+    xEventGroupSetBits(pTask->Events, pStep->Provides);
+    vTaskDelete(NULL);
+}
+#endif
+
+void BOOTINIT_Run(const BOOTINIT_Step_t *pSteps, uint8_t Count)
+{
+#ifndef ENABLE_OPENCV
+    static BOOTINIT_Task_t tasks[BOOTINIT_TRACE_MAX];
+    EventGroupHandle_t events = xEventGroupCreate();
+    uint32_t all = 0;
+
+    if (events == NULL || Count > BOOTINIT_TRACE_MAX)
+        goto Sequential;
+
+    for (uint8_t i = 0; i < Count; i++) {
+        all |= pSteps[i].Provides;
+        if (pSteps[i].Core < 0)
+            continue;
+        tasks[i].pStep = &pSteps[i];
+        tasks[i].Events = events;
+        // 与 loopTask 同优先级，CPU 忙时轮转；多数步骤在等总线或 delay
+        if (xTaskCreatePinnedToCore(BOOTINIT_Task, pSteps[i].Name, 8192, &tasks[i], 1, NULL, pSteps[i].Core) != pdPASS) {
+            // 建不了任务就在调用者里补跑，依赖顺序由数组保证
+            tasks[i].pStep = NULL;
+        }
+    }
+
+    for (uint8_t i = 0; i < Count; i++) {
+        const BOOTINIT_Step_t *pStep = &pSteps[i];
+        if (pStep->Core >= 0 && tasks[i].pStep)
+            continue;
+        if (pStep->Needs)
+            xEventGroupWaitBits(events, pStep->Needs, pdFALSE, pdTRUE, portMAX_DELAY);
+        BOOTINIT_RunStep(pStep);
+        xEventGroupSetBits(events, pStep->Provides);
+    }
+
+    if (all)
+        xEventGroupWaitBits(events, all, pdFALSE, pdTRUE, portMAX_DELAY);
+    vEventGroupDelete(events);
+    return;
+
+Sequential:
+    if (events)
+        vEventGroupDelete(events);
+#endif
+    for (uint8_t i = 0; i < Count; i++)
+        BOOTINIT_RunStep(&pSteps[i]);
+}
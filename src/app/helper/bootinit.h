@@ -0,0 +1,66 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_BOOTINIT_H
+#define HELPER_BOOTINIT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 启动阶段跟踪：每一步记录开始时刻（esp_timer，上电后的微秒数）和
+// 所在核上的 CCOUNT 差值。步骤可在不同核的任务里并发，彼此的 CCOUNT
+// 不可比，所以时间线用 esp_timer，耗时用 CCOUNT。
+#define BOOTINIT_TRACE_MAX 32U
+
+typedef struct {
+    const char *Name;
+    uint32_t    StartUs;
+    uint32_t    Cycles;   // 0 = 里程碑
+    uint8_t     Core;
+} BOOTINIT_Trace_t;
+
+uint8_t  BOOTINIT_TraceBegin(const char *pName);
+void     BOOTINIT_TraceEnd(uint8_t Id);
+void     BOOTINIT_Mark(const char *pName);
+uint8_t  BOOTINIT_TraceCount(void);
+bool     BOOTINIT_TraceRead(uint8_t Index, BOOTINIT_Trace_t *pTrace);
+void     BOOTINIT_Print(void);
+
+// 带依赖的并行初始化。每步完成后置位 Provides；Needs 中的位全部置位后
+// 才开始。Core >= 0 的步骤在钉在该核上的独立任务里运行，Core < 0 的
+// 按数组顺序在调用者里运行（数组须按依赖排好序）。全部完成后返回。
+// 模拟器没有 FreeRTOS，全部按数组顺序在调用者里运行。
+#define BOOTINIT_CALLER (-1)
+
+typedef struct {
+    const char *Name;
+    void      (*pInit)(void);
+    uint32_t    Provides;   // 最多 24 位（FreeRTOS 事件组）
+    uint32_t    Needs;
+    int8_t      Core;
+} BOOTINIT_Step_t;
+
+void     BOOTINIT_Run(const BOOTINIT_Step_t *pSteps, uint8_t Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
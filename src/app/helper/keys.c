@@ -0,0 +1,219 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#else
+#include <pthread.h>
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include "keys.h"
+#include "timerwheel.h"
+#include "../scheduler.h"
+#include "../driver/keyboard.h"
+#include "../misc.h"
+
+#define KEYS_QUEUE_LENGTH 32U   // 2 的幂
+// KEYS_Wait 每次最多睡这么久，没有扫描任务时也按这个间隔扫描
+#define KEYS_POLL_MS      10U
+// 换键时上一个键的定时器可能已经到期在路上，早于这个余量的 HOLD 不算
+#define KEYS_SLACK_US     2000U
+
+static KEYS_Event_t gQueue[KEYS_QUEUE_LENGTH];
+static uint32_t     gHead;
+static uint32_t     gTail;
+static uint32_t     gDropped;
+static uint32_t     gDownMask;
+static uint32_t     gHeldMask;                  // 已报过 HOLD、还没松开的键
+static uint8_t      gRepeatKey = KEY_INVALID;   // 最后按下、还按着的键
+static uint32_t     gRepeatSinceUs;
+
+#ifndef ENABLE_OPENCV
+static portMUX_TYPE      gKeysMux = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t gKeysSignal;
+static StaticSemaphore_t gKeysSignalBuffer;
+#define KEYS_LOCK()   portENTER_CRITICAL(&gKeysMux)
+#define KEYS_UNLOCK() portEXIT_CRITICAL(&gKeysMux)
+
+uint32_t KEYS_NowUs(void) { return (uint32_t)esp_timer_get_time(); }
+
+static inline void KEYS_Signal(void)
+{
+    if (gKeysSignal)
+        xSemaphoreGive(gKeysSignal);
+}
+
+static inline void KEYS_Sleep(uint32_t Ms)
+{
+    if (gKeysSignal)
+        xSemaphoreTake(gKeysSignal, pdMS_TO_TICKS(Ms) ? pdMS_TO_TICKS(Ms) : 1);
+    else
+        delay(Ms);
+}
+#else
+// 模拟器的按键在主线程的 glfwPollEvents 里产生，只有连发来自时间轮线程
+static pthread_mutex_t gKeysMutex = PTHREAD_MUTEX_INITIALIZER;
+#define KEYS_LOCK()   pthread_mutex_lock(&gKeysMutex)
+#define KEYS_UNLOCK() pthread_mutex_unlock(&gKeysMutex)
+
+uint32_t KEYS_NowUs(void) { return (uint32_t)micros(); }
+
+static inline void KEYS_Signal(void) { }
+static inline void KEYS_Sleep(uint32_t Ms) { delay(Ms); }
+#endif
+
+static inline uint32_t KEYS_HoldUs(void)   { return key_repeat_delay_10ms * SCHEDULER_SYSTICK_MS * 1000U; }
+
+// 持锁调用
+static void KEYS_Push(uint8_t Key, uint8_t Action, uint32_t TimeUs)
+{
+    KEYS_Event_t *pEvent;
+
+    if (gHead - gTail >= KEYS_QUEUE_LENGTH) {
+        gDropped++;
+        return;
+    }
+    pEvent = &gQueue[gHead++ & (KEYS_QUEUE_LENGTH - 1U)];
+    pEvent->TimeUs  = TimeUs;
+    pEvent->Chord   = gDownMask;
+    pEvent->Key     = Key;
+    pEvent->Action  = Action;
+    pEvent->Held    = (gHeldMask & KEYS_MASK(Key)) ? 1 : 0;
+    pEvent->Padding = 0;
+}
+
+// 时间轮任务里执行
+static void KEYS_RepeatTick(void *pArg)
+{
+    const uint32_t now = KEYS_NowUs();
+
+    (void)pArg;
+    KEYS_LOCK();
+    if (gRepeatKey != KEY_INVALID) {
+        const uint32_t mask = KEYS_MASK(gRepeatKey);
+
+        if (gHeldMask & mask) {
+            KEYS_Push(gRepeatKey, KEYS_REPEAT, now);
+        } else if (now - gRepeatSinceUs + KEYS_SLACK_US >= KEYS_HoldUs()) {
+            gHeldMask |= mask;
+            KEYS_Push(gRepeatKey, KEYS_HOLD, now);
+        }
+    }
+    KEYS_UNLOCK();
+    KEYS_Signal();
+}
+
+static TIMERWHEEL_Timer_t gRepeatTimer = TIMERWHEEL_TIMER(KEYS_RepeatTick, NULL);
+
+void KEYS_Init(void)
+{
+#ifndef ENABLE_OPENCV
+    if (gKeysSignal == NULL)
+        gKeysSignal = xSemaphoreCreateBinaryStatic(&gKeysSignalBuffer);
+#endif
+}
+
+void KEYS_Input(uint8_t Key, bool Pressed, uint32_t TimeUs)
+{
+    const uint32_t mask = KEYS_MASK(Key);
+    bool           start = false;
+    bool           stop = false;
+
+    if (Key >= KEY_INVALID)
+        return;
+
+    KEYS_LOCK();
+    if (Pressed && (gDownMask & mask) == 0) {
+        gDownMask |= mask;
+        gHeldMask &= ~mask;
+        KEYS_Push(Key, KEYS_PRESS, TimeUs);
+        gRepeatKey     = Key;
+        gRepeatSinceUs = TimeUs;
+        start = true;
+    } else if (!Pressed && (gDownMask & mask) != 0) {
+        gDownMask &= ~mask;
+        KEYS_Push(Key, KEYS_RELEASE, TimeUs);
+        gHeldMask &= ~mask;
+        if (gRepeatKey == Key) {
+            gRepeatKey = KEY_INVALID;
+            stop = true;
+        }
+    }
+    KEYS_UNLOCK();
+
+    if (start) {
+        // 长按从电平变化算起，扣掉去抖已经用掉的时间
+        const uint32_t elapsedMs = (KEYS_NowUs() - TimeUs) / 1000U;
+        const uint32_t holdMs = key_repeat_delay_10ms * SCHEDULER_SYSTICK_MS;
+
+        TIMERWHEEL_Start(&gRepeatTimer, elapsedMs < holdMs ? holdMs - elapsedMs : 1U, key_repeat_10ms * SCHEDULER_SYSTICK_MS);
+    } else if (stop) {
+        TIMERWHEEL_Stop(&gRepeatTimer);
+    }
+    KEYS_Signal();
+}
+
+bool KEYS_Get(KEYS_Event_t *pEvent)
+{
+    bool ok = false;
+
+    KEYS_LOCK();
+    if (gTail != gHead) {
+        *pEvent = gQueue[gTail++ & (KEYS_QUEUE_LENGTH - 1U)];
+        ok = true;
+    }
+    KEYS_UNLOCK();
+    return ok;
+}
+
+bool KEYS_Wait(KEYS_Event_t *pEvent, uint32_t TimeoutMs)
+{
+    const uint32_t start = millis();
+
+    for (;;) {
+        uint32_t elapsed;
+
+        KEYBOARD_Update();
+        if (KEYS_Get(pEvent))
+            return true;
+
+        elapsed = millis() - start;
+        if (elapsed >= TimeoutMs)
+            return false;
+        KEYS_Sleep(TimeoutMs - elapsed < KEYS_POLL_MS ? TimeoutMs - elapsed : KEYS_POLL_MS);
+    }
+}
+
+void KEYS_Flush(void)
+{
+    KEYS_LOCK();
+    gTail = gHead;
+    KEYS_UNLOCK();
+}
+
+uint32_t KEYS_DownMask(void)
+{
+    return __atomic_load_n(&gDownMask, __ATOMIC_RELAXED);
+}
+
+uint32_t KEYS_Dropped(void)
+{
+    return gDropped;
+}
@@ -0,0 +1,67 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_KEYS_H
+#define HELPER_KEYS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 按键事件队列：键盘驱动（ESP 上的扫描任务、模拟器的 GLFW 回调）送来去抖后的
+// 按下/松开，这里补上长按和连发并记下当时按住的所有键（组合键）。
+// 长按和连发由时间轮定时器产生，key_repeat_delay_10ms 后一次 HOLD，之后每
+// key_repeat_10ms 一次 REPEAT，只跟最后按下的那个键；主循环忙的时候也不会漂移。
+// 队列只有一个消费者：平时是 CheckKeys，模态界面在自己的循环里取。
+#define KEYS_MASK(key) (1UL << (key))
+
+typedef enum {
+    KEYS_PRESS = 0,
+    KEYS_HOLD,
+    KEYS_REPEAT,
+    KEYS_RELEASE
+} KEYS_Action_t;
+
+typedef struct {
+    uint32_t TimeUs;    // 按下/松开：电平变化的时刻；HOLD/REPEAT：定时器到期的时刻（KEYS_NowUs）
+    uint32_t Chord;     // 此刻按住的键（KEYS_MASK），按下/长按/连发时含 Key 本身
+    uint8_t  Key;       // KEY_Code_t
+    uint8_t  Action;    // KEYS_Action_t
+    uint8_t  Held;      // 松开前已经报过 HOLD
+    uint8_t  Padding;
+} KEYS_Event_t;
+
+void     KEYS_Init(void);
+// 驱动调用：Key 已去抖的边沿，TimeUs 取自 KEYS_NowUs 的时钟
+void     KEYS_Input(uint8_t Key, bool Pressed, uint32_t TimeUs);
+uint32_t KEYS_NowUs(void);
+
+bool     KEYS_Get(KEYS_Event_t *pEvent);
+// 最多等 TimeoutMs 毫秒；没有扫描任务时顺带调用 KEYBOARD_Update 扫描
+bool     KEYS_Wait(KEYS_Event_t *pEvent, uint32_t TimeoutMs);
+// 丢掉没取走的事件（自己轮询键盘的界面退出时调用）
+void     KEYS_Flush(void);
+uint32_t KEYS_DownMask(void);
+uint32_t KEYS_Dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,199 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+
+#include "helper/lz4.h"
+
+#define LZ4_MIN_MATCH     4U
+#define LZ4_LAST_LITERALS 5U   // the last 5 bytes are always literals
+#define LZ4_MF_LIMIT      12U  // no match may start in the last 12 bytes
+#define LZ4_MAX_OFFSET    0xFFFFU
+
+static uint16_t gLz4HashTable[1U << LZ4_HASH_BITS];
+
+static inline uint32_t LZ4_Read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t LZ4_Hash(uint32_t v)
+{
+    return (v * 2654435761U) >> (32U - LZ4_HASH_BITS);
+}
+
+static uint8_t *LZ4_PutLength(uint8_t *op, const uint8_t *oend, uint32_t Length)
+{
+    while (Length >= 255U) {
+        if (op >= oend)
+            return NULL;
+        *op++ = 255U;
+        Length -= 255U;
+    }
+    if (op >= oend)
+        return NULL;
+    *op++ = (uint8_t)Length;
+    return op;
+}
+
+static uint8_t *LZ4_PutLiterals(uint8_t *op, const uint8_t *oend, const uint8_t *pLiterals, uint32_t Length)
+{
+    uint8_t *token = op;
+
+    if (op >= oend)
+        return NULL;
+    op++;
+
+    *token = (uint8_t)((Length >= 15U ? 15U : Length) << 4);
+    if (Length >= 15U) {
+        op = LZ4_PutLength(op, oend, Length - 15U);
+        if (op == NULL)
+            return NULL;
+    }
+    if ((uint32_t)(oend - op) < Length)
+        return NULL;
+    memcpy(op, pLiterals, Length);
+    return op + Length;
+}
+
+uint32_t LZ4_EncodeBlock(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstCapacity)
+{
+    const uint8_t *ip = pSrc;
+    const uint8_t *anchor = pSrc;
+    const uint8_t *const iend = pSrc + SrcSize;
+    const uint8_t *const mflimit = SrcSize > LZ4_MF_LIMIT ? iend - LZ4_MF_LIMIT : pSrc;
+    const uint8_t *const matchlimit = SrcSize > LZ4_LAST_LITERALS ? iend - LZ4_LAST_LITERALS : pSrc;
+    uint8_t *op = pDst;
+    const uint8_t *const oend = pDst + DstCapacity;
+
+    if (SrcSize == 0U || SrcSize > 0x10000U)
+        return 0;
+
+    // Positions are 16-bit offsets into the block; stale entries are caught
+    // by the byte compare below.
+    memset(gLz4HashTable, 0, sizeof(gLz4HashTable));
+
+    while (ip < mflimit) {
+        const uint32_t seq = LZ4_Read32(ip);
+        const uint32_t h = LZ4_Hash(seq);
+        const uint8_t *ref = pSrc + gLz4HashTable[h];
+
+        gLz4HashTable[h] = (uint16_t)(ip - pSrc);
+        if (ref >= ip || (uint32_t)(ip - ref) > LZ4_MAX_OFFSET || LZ4_Read32(ref) != seq) {
+            ip++;
+            continue;
+        }
+
+        while (ip > anchor && ref > pSrc && ip[-1] == ref[-1]) {
+            ip--;
+            ref--;
+        }
+
+        const uint8_t *p = ip + LZ4_MIN_MATCH;
+        const uint8_t *r = ref + LZ4_MIN_MATCH;
+        while (p < matchlimit && *p == *r) {
+            p++;
+            r++;
+        }
+
+        uint8_t *token = op;
+        op = LZ4_PutLiterals(op, oend, anchor, (uint32_t)(ip - anchor));
+        if (op == NULL || oend - op < 2)
+            return 0;
+
+        const uint32_t offset = (uint32_t)(ip - ref);
+        const uint32_t matchLength = (uint32_t)(p - ip) - LZ4_MIN_MATCH;
+        *op++ = (uint8_t)offset;
+        *op++ = (uint8_t)(offset >> 8);
+        *token |= (uint8_t)(matchLength >= 15U ? 15U : matchLength);
+        if (matchLength >= 15U) {
+            op = LZ4_PutLength(op, oend, matchLength - 15U);
+            if (op == NULL)
+                return 0;
+        }
+
+        ip = anchor = p;
+    }
+
+    op = LZ4_PutLiterals(op, oend, anchor, (uint32_t)(iend - anchor));
+    if (op == NULL)
+        return 0;
+
+    return (uint32_t)(op - pDst);
+}
+
+static const uint8_t *LZ4_GetLength(const uint8_t *ip, const uint8_t *iend, uint32_t *pLength)
+{
+    uint8_t b;
+
+    do {
+        if (ip >= iend)
+            return NULL;
+        b = *ip++;
+        *pLength += b;
+    } while (b == 255U);
+
+    return ip;
+}
+
+uint32_t LZ4_DecodeBlock(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstCapacity)
+{
+    const uint8_t *ip = pSrc;
+    const uint8_t *const iend = pSrc + SrcSize;
+    uint8_t *op = pDst;
+    const uint8_t *const oend = pDst + DstCapacity;
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+        uint32_t length = token >> 4;
+
+        if (length == 15U && (ip = LZ4_GetLength(ip, iend, &length)) == NULL)
+            return 0;
+        if (length > (uint32_t)(iend - ip) || length > (uint32_t)(oend - op))
+            return 0;
+        memcpy(op, ip, length);
+        op += length;
+        ip += length;
+
+        // The last sequence carries literals only.
+        if (ip >= iend)
+            break;
+
+        if (iend - ip < 2)
+            return 0;
+        const uint32_t offset = (uint32_t)ip[0] | ((uint32_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0U || offset > (uint32_t)(op - pDst))
+            return 0;
+
+        length = token & 15U;
+        if (length == 15U && (ip = LZ4_GetLength(ip, iend, &length)) == NULL)
+            return 0;
+        length += LZ4_MIN_MATCH;
+        if (length > (uint32_t)(oend - op))
+            return 0;
+
+        // Byte copy: the match may overlap the bytes it produces.
+        const uint8_t *ref = op - offset;
+        while (length--)
+            *op++ = *ref++;
+    }
+
+    return (uint32_t)(op - pDst);
+}
@@ -0,0 +1,42 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_LZ4_H
+#define HELPER_LZ4_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LZ4 block format (no frame header), one independent block per CPS transfer.
+// The window is the block itself, so the encoder only needs its 2 KB hash
+// table and a block of at most 64 KB.
+#define LZ4_HASH_BITS 10U
+
+// Returns the encoded size, or 0 when the result would not fit in DstCapacity
+// (pass SrcSize - 1 to keep only blocks that actually shrink).
+uint32_t LZ4_EncodeBlock(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstCapacity);
+
+// Returns the decoded size, or 0 on malformed input / output overflow.
+uint32_t LZ4_DecodeBlock(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstCapacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
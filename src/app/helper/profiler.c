@@ -0,0 +1,162 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifdef ENABLE_PROFILER
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#include <hal/cpu_hal.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include <string.h>
+
+#include "profiler.h"
+
+typedef struct {
+    uint32_t Calls;
+    uint32_t Max;
+    uint64_t Total;
+} PROFILER_Stats_t;
+
+static const char *const gZoneNames[PROFILER_ZONE_COUNT] = {
+    [PROFILER_ZONE_APP_UPDATE]    = "APP_Update",
+    [PROFILER_ZONE_RADIO_SLICE]   = "RadioSlice",
+    [PROFILER_ZONE_UI_SLICE]      = "UiSlice",
+    [PROFILER_ZONE_DISPLAY]       = "Display",
+    [PROFILER_ZONE_LCD_BLIT]      = "LcdBlit",
+    [PROFILER_ZONE_LCD_LINE]      = "LcdLine",
+    [PROFILER_ZONE_PRINT_SMALL]   = "PrintSmall",
+    [PROFILER_ZONE_BK4819_READ]   = "BK4819Rd",
+    [PROFILER_ZONE_BK4819_WRITE]  = "BK4819Wr",
+    [PROFILER_ZONE_EEPROM_READ]   = "EepromRd",
+    [PROFILER_ZONE_EEPROM_WRITE]  = "EepromWr",
+    [PROFILER_ZONE_UART_COMMAND]  = "UartCmd",
+    [PROFILER_ZONE_SPECTRUM_RSSI] = "SpecRssi",
+    [PROFILER_ZONE_AVR_RUN]       = "avr_run",
+};
+
+static PROFILER_Stats_t gStats[PROFILER_ZONE_COUNT];
+static uint32_t         gResetMs;
+
+#ifndef ENABLE_OPENCV
+static portMUX_TYPE gProfilerMux = portMUX_INITIALIZER_UNLOCKED;
+#define PROFILER_LOCK()   portENTER_CRITICAL(&gProfilerMux)
+#define PROFILER_UNLOCK() portEXIT_CRITICAL(&gProfilerMux)
+
+static inline uint32_t PROFILER_Now(void)       { return cpu_hal_get_cycle_count(); }
+static inline uint32_t PROFILER_TicksPerUs(void) { return getCpuFrequencyMhz(); }
+#else
+static pthread_mutex_t gProfilerMutex = PTHREAD_MUTEX_INITIALIZER;
+#define PROFILER_LOCK()   pthread_mutex_lock(&gProfilerMutex)
+#define PROFILER_UNLOCK() pthread_mutex_unlock(&gProfilerMutex)
+
+static inline uint32_t PROFILER_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+static inline uint32_t PROFILER_TicksPerUs(void) { return 1000U; }
+#endif
+
+PROFILER_Scope_t PROFILER_Enter(uint8_t Zone)
+{
+    PROFILER_Scope_t scope;
+
+    scope.Zone = Zone;
+    scope.Start = PROFILER_Now();
+    return scope;
+}
+
+// 32 位计数在 240MHz 下约 17.9 秒回绕，单次区段远短于此
+void PROFILER_Leave(const PROFILER_Scope_t *pScope)
+{
+    const uint32_t ticks = PROFILER_Now() - pScope->Start;
+    PROFILER_Stats_t *p = &gStats[pScope->Zone];
+
+    PROFILER_LOCK();
+    p->Calls++;
+    p->Total += ticks;
+    if (ticks > p->Max)
+        p->Max = ticks;
+    PROFILER_UNLOCK();
+}
+
+void PROFILER_Reset(void)
+{
+    PROFILER_LOCK();
+    memset(gStats, 0, sizeof(gStats));
+    PROFILER_UNLOCK();
+    gResetMs = millis();
+}
+
+uint8_t PROFILER_Top(PROFILER_Report_t *pReport, uint8_t Max)
+{
+    PROFILER_Stats_t stats[PROFILER_ZONE_COUNT];
+    const uint32_t perUs = PROFILER_TicksPerUs();
+    uint8_t n = 0;
+
+    PROFILER_LOCK();
+    memcpy(stats, gStats, sizeof(stats));
+    PROFILER_UNLOCK();
+
+    // 区段不多，插入排序
+    for (uint8_t zone = 0; zone < PROFILER_ZONE_COUNT; zone++) {
+        if (stats[zone].Calls == 0)
+            continue;
+
+        const uint64_t totalUs = stats[zone].Total / perUs;
+        PROFILER_Report_t entry;
+
+        memset(&entry, 0, sizeof(entry));
+        entry.Zone = zone;
+        entry.Calls = stats[zone].Calls;
+        entry.TotalUs = totalUs > 0xFFFFFFFFULL ? 0xFFFFFFFFU : (uint32_t)totalUs;
+        entry.MaxUs = stats[zone].Max / perUs;
+
+        uint8_t i = n < Max ? n : Max;
+        while (i > 0 && pReport[i - 1].TotalUs < entry.TotalUs) {
+            if (i < Max)
+                pReport[i] = pReport[i - 1];
+            i--;
+        }
+        if (i < Max) {
+            pReport[i] = entry;
+            if (n < Max)
+                n++;
+        }
+    }
+
+    return n;
+}
+
+const char *PROFILER_ZoneName(uint8_t Zone)
+{
+    return Zone < PROFILER_ZONE_COUNT ? gZoneNames[Zone] : "?";
+}
+
+uint32_t PROFILER_ElapsedMs(void)
+{
+    return millis() - gResetMs;
+}
+
+#endif
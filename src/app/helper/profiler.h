@@ -0,0 +1,89 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_PROFILER_H
+#define HELPER_PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 按区段统计调用次数、累计耗时和最坏耗时（ENABLE_PROFILER）。
+// ESP32-S3 上用 CCOUNT 计 CPU 周期，模拟器上用单调时钟计纳秒，报告统一换成微秒。
+// 区段在函数开头写一行 PROFILER_ZONE(XXX)，离开作用域时自动结算（GCC cleanup），
+// 中途 return 也算。耗时包含嵌套区段和被同核更高优先级任务抢占的时间；
+// 任务都钉在固定核上，CCOUNT 差值有效。
+enum PROFILER_Zone_t {
+    PROFILER_ZONE_APP_UPDATE = 0,
+    PROFILER_ZONE_RADIO_SLICE,      // APP_RadioTimeSlice10ms
+    PROFILER_ZONE_UI_SLICE,         // APP_TimeSlice10ms
+    PROFILER_ZONE_DISPLAY,          // GUI_DisplayScreen
+    PROFILER_ZONE_LCD_BLIT,         // ST7565_BlitFullScreen
+    PROFILER_ZONE_LCD_LINE,         // ST7565_BlitLine / BlitStatusLine
+    PROFILER_ZONE_PRINT_SMALL,      // UI_PrintStringSmall
+    PROFILER_ZONE_BK4819_READ,
+    PROFILER_ZONE_BK4819_WRITE,
+    PROFILER_ZONE_EEPROM_READ,
+    PROFILER_ZONE_EEPROM_WRITE,
+    PROFILER_ZONE_UART_COMMAND,     // UART_HandleCommand
+    PROFILER_ZONE_SPECTRUM_RSSI,    // spectrum GetRssi
+    PROFILER_ZONE_AVR_RUN,
+    PROFILER_ZONE_COUNT
+};
+
+typedef struct {
+    uint8_t  Zone;       // PROFILER_Zone_t
+    uint8_t  Padding[3];
+    uint32_t Calls;
+    uint32_t TotalUs;    // 饱和到 0xFFFFFFFF
+    uint32_t MaxUs;
+} PROFILER_Report_t;
+
+#ifdef ENABLE_PROFILER
+
+typedef struct {
+    uint8_t  Zone;
+    uint32_t Start;
+} PROFILER_Scope_t;
+
+PROFILER_Scope_t PROFILER_Enter(uint8_t Zone);
+void             PROFILER_Leave(const PROFILER_Scope_t *pScope);
+
+#define PROFILER_ZONE(zone) \
+    const PROFILER_Scope_t __attribute__((cleanup(PROFILER_Leave), unused)) _profilerScope = PROFILER_Enter(PROFILER_ZONE_##zone)
+
+#else
+
+#define PROFILER_ZONE(zone) do { } while (0)
+
+#endif
+
+// 清零所有区段，重新开始计
+void        PROFILER_Reset(void);
+// 按累计耗时从大到小取前 Max 个有调用的区段，返回个数
+uint8_t     PROFILER_Top(PROFILER_Report_t *pReport, uint8_t Max);
+const char *PROFILER_ZoneName(uint8_t Zone);
+// 自上次 Reset 以来的时间（毫秒），用来换算占比
+uint32_t    PROFILER_ElapsedMs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,215 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#else
+#include <pthread.h>
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include "timerwheel.h"
+
+#define TW_L0_BITS   8U
+#define TW_LN_BITS   6U
+#define TW_L0_SIZE   (1U << TW_L0_BITS)
+#define TW_LN_SIZE   (1U << TW_LN_BITS)
+#define TW_L1_SHIFT  TW_L0_BITS
+#define TW_L2_SHIFT  (TW_L0_BITS + TW_LN_BITS)
+
+enum {
+    TW_STATE_IDLE = 0,
+    TW_STATE_ARMED,     // 在轮子的某个槽里
+    TW_STATE_READY,     // 已到期，在就绪链表里等分发
+    TW_STATE_RUNNING    // 回调执行中
+};
+
+#ifndef ENABLE_OPENCV
+static portMUX_TYPE gWheelMux = portMUX_INITIALIZER_UNLOCKED;
+#define TW_IRAM          IRAM_ATTR
+#define TW_LOCK()        portENTER_CRITICAL(&gWheelMux)
+#define TW_UNLOCK()      portEXIT_CRITICAL(&gWheelMux)
+#define TW_LOCK_ISR()    portENTER_CRITICAL_ISR(&gWheelMux)
+#define TW_UNLOCK_ISR()  portEXIT_CRITICAL_ISR(&gWheelMux)
+#else
+static pthread_mutex_t gWheelMutex = PTHREAD_MUTEX_INITIALIZER;
+#define TW_IRAM
+#define TW_LOCK()        pthread_mutex_lock(&gWheelMutex)
+#define TW_UNLOCK()      pthread_mutex_unlock(&gWheelMutex)
+#define TW_LOCK_ISR()    TW_LOCK()
+#define TW_UNLOCK_ISR()  TW_UNLOCK()
+#endif
+
+static TIMERWHEEL_Timer_t  *gWheel0[TW_L0_SIZE];
+static TIMERWHEEL_Timer_t  *gWheel1[TW_LN_SIZE];
+static TIMERWHEEL_Timer_t  *gWheel2[TW_LN_SIZE];
+static TIMERWHEEL_Timer_t  *gReady;
+static TIMERWHEEL_Timer_t **gReadyTail = &gReady;
+static volatile uint32_t    gNow;
+
+static void TW_IRAM TW_Link(TIMERWHEEL_Timer_t **ppHead, TIMERWHEEL_Timer_t *pTimer)
+{
+    pTimer->pNext = *ppHead;
+    if (pTimer->pNext)
+        pTimer->pNext->ppPrev = &pTimer->pNext;
+    pTimer->ppPrev = ppHead;
+    *ppHead = pTimer;
+}
+
+static void TW_IRAM TW_Unlink(TIMERWHEEL_Timer_t *pTimer)
+{
+    if (gReadyTail == &pTimer->pNext)
+        gReadyTail = pTimer->ppPrev;
+    *pTimer->ppPrev = pTimer->pNext;
+    if (pTimer->pNext)
+        pTimer->pNext->ppPrev = pTimer->ppPrev;
+    pTimer->pNext = NULL;
+    pTimer->ppPrev = NULL;
+}
+
+// 就绪链表按到期先后排队
+static void TW_IRAM TW_Append(TIMERWHEEL_Timer_t *pTimer)
+{
+    pTimer->pNext = NULL;
+    pTimer->ppPrev = gReadyTail;
+    *gReadyTail = pTimer;
+    gReadyTail = &pTimer->pNext;
+    pTimer->State = TW_STATE_READY;
+}
+
+static void TW_IRAM TW_Insert(TIMERWHEEL_Timer_t *pTimer)
+{
+    const uint32_t expires = pTimer->Expires;
+    const uint32_t delta = expires - gNow;
+
+    if ((int32_t)delta <= 0) {
+        TW_Append(pTimer);
+        return;
+    }
+
+    pTimer->State = TW_STATE_ARMED;
+    if (delta < TW_L0_SIZE)
+        TW_Link(&gWheel0[expires & (TW_L0_SIZE - 1U)], pTimer);
+    else if (delta < (1UL << TW_L2_SHIFT))
+        TW_Link(&gWheel1[(expires >> TW_L1_SHIFT) & (TW_LN_SIZE - 1U)], pTimer);
+    else
+        TW_Link(&gWheel2[(expires >> TW_L2_SHIFT) & (TW_LN_SIZE - 1U)], pTimer);
+}
+
+// 高层槽轮到时把里面的定时器按剩余时间重新放进低层
+static void TW_IRAM TW_Cascade(TIMERWHEEL_Timer_t **ppSlot)
+{
+    while (*ppSlot) {
+        TIMERWHEEL_Timer_t *pTimer = *ppSlot;
+        TW_Unlink(pTimer);
+        TW_Insert(pTimer);
+    }
+}
+
+bool TW_IRAM TIMERWHEEL_TickFromISR(void)
+{
+    bool ready;
+
+    TW_LOCK_ISR();
+
+    const uint32_t now = gNow + 1U;
+    gNow = now;
+
+    if ((now & (TW_L0_SIZE - 1U)) == 0) {
+        if (((now >> TW_L1_SHIFT) & (TW_LN_SIZE - 1U)) == 0)
+            TW_Cascade(&gWheel2[(now >> TW_L2_SHIFT) & (TW_LN_SIZE - 1U)]);
+        TW_Cascade(&gWheel1[(now >> TW_L1_SHIFT) & (TW_LN_SIZE - 1U)]);
+    }
+
+    TIMERWHEEL_Timer_t **ppSlot = &gWheel0[now & (TW_L0_SIZE - 1U)];
+    while (*ppSlot) {
+        TIMERWHEEL_Timer_t *pTimer = *ppSlot;
+        TW_Unlink(pTimer);
+        TW_Append(pTimer);
+    }
+    ready = gReady != NULL;
+
+    TW_UNLOCK_ISR();
+
+    return ready;
+}
+
+void TIMERWHEEL_Start(TIMERWHEEL_Timer_t *pTimer, uint32_t DelayMs, uint32_t PeriodMs)
+{
+    if (DelayMs == 0)
+        DelayMs = 1;
+    if (DelayMs > TIMERWHEEL_MAX_DELAY_MS)
+        DelayMs = TIMERWHEEL_MAX_DELAY_MS;
+
+    TW_LOCK();
+    if (pTimer->State == TW_STATE_ARMED || pTimer->State == TW_STATE_READY)
+        TW_Unlink(pTimer);
+    pTimer->Period = PeriodMs;
+    pTimer->Expires = gNow + DelayMs;
+    TW_Insert(pTimer);
+    TW_UNLOCK();
+}
+
+void TIMERWHEEL_Stop(TIMERWHEEL_Timer_t *pTimer)
+{
+    TW_LOCK();
+    if (pTimer->State == TW_STATE_ARMED || pTimer->State == TW_STATE_READY)
+        TW_Unlink(pTimer);
+    pTimer->State = TW_STATE_IDLE;
+    TW_UNLOCK();
+}
+
+bool TIMERWHEEL_IsActive(const TIMERWHEEL_Timer_t *pTimer)
+{
+    const uint8_t state = pTimer->State;
+
+    return state == TW_STATE_ARMED || state == TW_STATE_READY ||
+           (state == TW_STATE_RUNNING && pTimer->Period != 0);
+}
+
+uint32_t TIMERWHEEL_Now(void)
+{
+    return gNow;
+}
+
+void TIMERWHEEL_Dispatch(void)
+{
+    for (;;) {
+        TW_LOCK();
+        TIMERWHEEL_Timer_t *pTimer = gReady;
+        if (pTimer == NULL) {
+            TW_UNLOCK();
+            return;
+        }
+        TW_Unlink(pTimer);
+        pTimer->State = TW_STATE_RUNNING;
+        TW_UNLOCK();
+
+        pTimer->pCallback(pTimer->pArg);
+
+        // 回调里可能已经 Start/Stop 过自己，那时不再自动重装
+        TW_LOCK();
+        if (pTimer->State == TW_STATE_RUNNING) {
+            if (pTimer->Period) {
+                pTimer->Expires += pTimer->Period;
+                TW_Insert(pTimer);
+            } else {
+                pTimer->State = TW_STATE_IDLE;
+            }
+        }
+        TW_UNLOCK();
+    }
+}
@@ -0,0 +1,64 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_TIMERWHEEL_H
+#define HELPER_TIMERWHEEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 1ms 分辨率的分层时间轮（256 x 1ms、64 x 256ms、64 x 16.384s，最长约 17 分钟）。
+// 硬件定时器每 1ms 调一次 TIMERWHEEL_TickFromISR，只处理当前槽里到期的
+// 定时器，把它们挂到就绪链表；回调由 TIMERWHEEL_Dispatch 在任务上下文里执行。
+#define TIMERWHEEL_MAX_DELAY_MS ((1UL << 20) - 1U)
+
+typedef void (*TIMERWHEEL_Callback_t)(void *pArg);
+
+typedef struct TIMERWHEEL_Timer_s {
+    struct TIMERWHEEL_Timer_s  *pNext;
+    struct TIMERWHEEL_Timer_s **ppPrev;
+    TIMERWHEEL_Callback_t       pCallback;
+    void                       *pArg;
+    uint32_t                    Expires;   // TIMERWHEEL_Now() 时刻
+    uint32_t                    Period;    // 0 = 单次
+    uint8_t                     State;
+} TIMERWHEEL_Timer_t;
+
+// 定时器须为静态存储：static TIMERWHEEL_Timer_t t = TIMERWHEEL_TIMER(cb, arg);
+#define TIMERWHEEL_TIMER(cb, arg) { NULL, NULL, (cb), (arg), 0, 0, 0 }
+
+// DelayMs 后第一次触发，之后每 PeriodMs 一次（0 = 单次）。已在运行则重新计时。
+// 周期定时器按计划时刻累加，分发晚了会连续补跑，不会漂移。
+void     TIMERWHEEL_Start(TIMERWHEEL_Timer_t *pTimer, uint32_t DelayMs, uint32_t PeriodMs);
+void     TIMERWHEEL_Stop(TIMERWHEEL_Timer_t *pTimer);
+bool     TIMERWHEEL_IsActive(const TIMERWHEEL_Timer_t *pTimer);
+uint32_t TIMERWHEEL_Now(void);
+
+// 由定时器中断调用，推进 1ms；返回 true 表示有回调等待分发
+bool     TIMERWHEEL_TickFromISR(void);
+// 在任务上下文里执行所有已到期的回调
+void     TIMERWHEEL_Dispatch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
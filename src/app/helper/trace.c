@@ -0,0 +1,158 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifdef ENABLE_TRACE
+
+#ifndef ENABLE_OPENCV
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <hal/cpu_hal.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include "../opencv/Arduino.hpp"
+#endif
+
+#include <string.h>
+
+#include "trace.h"
+
+volatile uint32_t gTraceMask;
+
+static TRACE_Entry_t gTrace[TRACE_LENGTH];
+static uint16_t      gTraceHead;     // 下一条写入位置
+static uint16_t      gTraceCount;
+static uint32_t      gTraceDropped;
+
+#ifndef ENABLE_OPENCV
+static portMUX_TYPE gTraceMux = portMUX_INITIALIZER_UNLOCKED;
+#define TRACE_LOCK()   portENTER_CRITICAL(&gTraceMux)
+#define TRACE_UNLOCK() portEXIT_CRITICAL(&gTraceMux)
+
+static inline uint32_t TRACE_NowUs(void)   { return (uint32_t)esp_timer_get_time(); }
+static inline uint8_t  TRACE_Core(void)    { return (uint8_t)xPortGetCoreID(); }
+static inline uint32_t TRACE_Cycles(void)  { return cpu_hal_get_cycle_count(); }
+static inline uint32_t TRACE_CpuMhz(void)  { return getCpuFrequencyMhz(); }
+#else
+static pthread_mutex_t gTraceMutex = PTHREAD_MUTEX_INITIALIZER;
+#define TRACE_LOCK()   pthread_mutex_lock(&gTraceMutex)
+#define TRACE_UNLOCK() pthread_mutex_unlock(&gTraceMutex)
+
+static inline uint32_t TRACE_NowUs(void)   { return (uint32_t)micros(); }
+static inline uint8_t  TRACE_Core(void)    { return 0; }
+static inline uint32_t TRACE_CpuMhz(void)  { return 1000U; }
+
+static inline uint32_t TRACE_Cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+#endif
+
+void TRACE_Record(uint8_t Event, uint16_t Arg0, uint32_t Arg1)
+{
+    const uint32_t now = TRACE_NowUs();
+    const uint8_t core = TRACE_Core();
+
+    TRACE_LOCK();
+    TRACE_Entry_t *p = &gTrace[gTraceHead];
+    p->TimeUs = now;
+    p->Event = Event;
+    p->Core = core;
+    p->Arg0 = Arg0;
+    p->Arg1 = Arg1;
+    gTraceHead = (uint16_t)((gTraceHead + 1U) % TRACE_LENGTH);
+    if (gTraceCount < TRACE_LENGTH)
+        gTraceCount++;
+    else
+        gTraceDropped++;
+    TRACE_UNLOCK();
+}
+
+void TRACE_SetMask(uint32_t Mask)
+{
+    gTraceMask = Mask & ((1UL << TRACE_EVENT_COUNT) - 1U);
+}
+
+uint32_t TRACE_GetMask(void)
+{
+    return gTraceMask;
+}
+
+void TRACE_Clear(void)
+{
+    TRACE_LOCK();
+    gTraceHead = 0;
+    gTraceCount = 0;
+    gTraceDropped = 0;
+    TRACE_UNLOCK();
+}
+
+uint16_t TRACE_Pending(void)
+{
+    return gTraceCount;
+}
+
+uint32_t TRACE_Dropped(void)
+{
+    return gTraceDropped;
+}
+
+uint16_t TRACE_Drain(TRACE_Entry_t *pEntries, uint16_t Max)
+{
+    uint16_t n = 0;
+
+    TRACE_LOCK();
+    uint16_t tail = (uint16_t)((gTraceHead + TRACE_LENGTH - gTraceCount) % TRACE_LENGTH);
+    while (n < Max && gTraceCount > 0) {
+        pEntries[n++] = gTrace[tail];
+        tail = (uint16_t)((tail + 1U) % TRACE_LENGTH);
+        gTraceCount--;
+    }
+    TRACE_UNLOCK();
+
+    return n;
+}
+
+// 比较空循环和放了一个未开启埋点的循环；测量期间暂停记录
+void TRACE_Benchmark(uint32_t Rounds, TRACE_Bench_t *pResult)
+{
+    const uint32_t mask = gTraceMask;
+    uint32_t start;
+
+    gTraceMask = 0;
+
+    start = TRACE_Cycles();
+    for (uint32_t i = 0; i < Rounds; i++)
+        __asm__ volatile("" ::: "memory");
+    pResult->LoopCycles = TRACE_Cycles() - start;
+
+    start = TRACE_Cycles();
+    for (uint32_t i = 0; i < Rounds; i++) {
+        TRACE(REG_WRITE, i, i);
+        __asm__ volatile("" ::: "memory");
+    }
+    pResult->DisabledCycles = TRACE_Cycles() - start;
+
+    gTraceMask = mask;
+
+    pResult->Rounds = Rounds;
+    pResult->CpuMhz = TRACE_CpuMhz();
+}
+
+#endif
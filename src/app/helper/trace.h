@@ -0,0 +1,103 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_TRACE_H
+#define HELPER_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 电台/界面事件的二进制时间线（ENABLE_TRACE），串口按需取走，用来分析扫描延迟和界面卡顿。
+// 每条 12 字节：微秒时间戳、事件、核号和两个参数。环形缓冲写满后覆盖最旧的并计丢弃数。
+// 编进固件但没开（掩码为 0）时每个埋点只多一次读内存和一次跳转，TRACE_Benchmark 可实测。
+#define TRACE_VERSION  1U
+#define TRACE_LENGTH   512U
+
+enum TRACE_Event_t {
+    TRACE_EVENT_REG_WRITE = 0,  // Arg0 = BK4819 寄存器, Arg1 = 值
+    TRACE_EVENT_SCAN_HOP,       // Arg0 = TRACE_HOP_*, Arg1 = 频率 (10Hz) 或信道号
+    TRACE_EVENT_SQUELCH,        // Arg0 = 1 打开 / 0 关闭, Arg1 = 频率 (10Hz)
+    TRACE_EVENT_KEY,            // Arg0 = KEY_Code_t, Arg1 = bit0 按下, bit1 长按
+    TRACE_EVENT_PRESENT,        // Arg0 = TRACE_PRESENT_*, Arg1 = 行号
+    TRACE_EVENT_FLASH_ERASE,    // Arg1 = 分区内偏移
+    TRACE_EVENT_COUNT
+};
+
+enum {
+    TRACE_HOP_FREQUENCY = 0,    // 频率扫描
+    TRACE_HOP_CHANNEL,          // 信道扫描
+    TRACE_HOP_SPECTRUM          // 频谱扫描一个点
+};
+
+enum {
+    TRACE_PRESENT_FULL = 0,
+    TRACE_PRESENT_LINE,
+    TRACE_PRESENT_STATUS
+};
+
+typedef struct {
+    uint32_t TimeUs;     // esp_timer，约 71 分钟回绕
+    uint8_t  Event;      // TRACE_Event_t
+    uint8_t  Core;
+    uint16_t Arg0;
+    uint32_t Arg1;
+} TRACE_Entry_t;
+
+typedef struct {
+    uint32_t Rounds;
+    uint32_t LoopCycles;      // 空循环
+    uint32_t DisabledCycles;  // 同样的循环里放一个未开启的 TRACE
+    uint32_t CpuMhz;          // 模拟器上为 1000（纳秒计）
+} TRACE_Bench_t;
+
+#ifdef ENABLE_TRACE
+
+extern volatile uint32_t gTraceMask;
+
+void TRACE_Record(uint8_t Event, uint16_t Arg0, uint32_t Arg1);
+
+#define TRACE(event, arg0, arg1) \
+    do { \
+        if (gTraceMask & (1UL << TRACE_EVENT_##event)) \
+            TRACE_Record(TRACE_EVENT_##event, (uint16_t)(arg0), (uint32_t)(arg1)); \
+    } while (0)
+
+#else
+
+#define TRACE(event, arg0, arg1) do { } while (0)
+
+#endif
+
+// Mask 的每一位对应一个 TRACE_Event_t，0 = 停止记录
+void     TRACE_SetMask(uint32_t Mask);
+uint32_t TRACE_GetMask(void);
+void     TRACE_Clear(void);
+uint16_t TRACE_Pending(void);
+// 自上次 Clear 以来被覆盖的条数
+uint32_t TRACE_Dropped(void);
+// 从最旧的开始取出最多 Max 条，取出的从缓冲里移除
+uint16_t TRACE_Drain(TRACE_Entry_t *pEntries, uint16_t Max);
+void     TRACE_Benchmark(uint32_t Rounds, TRACE_Bench_t *pResult);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
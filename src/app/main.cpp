@@ -53,6 +53,9 @@
 #ifdef ENABLE_MESSENGER
 #include "app/messenger.h"  
 #endif
+#ifdef ENABLE_ACTIVITY_LOG
+#include "app/actlog.h"
+#endif
 #include "audio.h"
 #include "board.h"
 #include "misc.h"
@@ -60,6 +63,7 @@
 #include "settings.h"
 #include "version.h"
 #include "app/app.h"
+#include "app/radiotask.h"
 #include "app/dtmf.h"
 #include "driver/backlight.h"
 #include "driver/bk4819.h"
@@ -76,6 +80,7 @@
 
 #include "helper/battery.h"
 #include "helper/boot.h"
+#include "helper/bootinit.h"
 
 #include "ui/lock.h"
 #include "ui/welcome.h"
@@ -83,6 +88,15 @@
 #include "driver/eeprom.h"
 #include "driver/st7565.h"
 #include "driver/keyboard.h"
+#include "helper/keys.h"
+#include "driver/i2c1.h"
+#include "driver/i2c_bus.h"
+#include "driver/bk1080.h"
+#include "driver/uart1.h"
+
+#ifndef UART_BAUD
+#define UART_BAUD 38400
+#endif
 
 #ifndef ENABLE_HW_TEST_MODE
 #define ENABLE_HW_TEST_MODE 1
@@ -302,8 +316,6 @@ static void ScreenFpsTest() {
     // Serial.printf("[GRAY_NO_GRAIN_TEST] duty_profile=%u/3 (MENU to cycle)\n", (unsigned)(dutyProfile + 1u));
 
     uint32_t frame_idx = 0;
-    uint32_t lastAdjustMs = 0;
-    KEY_Code_t lastKey = KEY_INVALID;
 
     // Frame pacing: use a phase-locked scheduler to reduce jitter.
     uint32_t next_frame_us = micros();
@@ -398,37 +410,41 @@ static void ScreenFpsTest() {
             last_report_ms = now_ms;
         }
 
-        // Poll key once per loop: EXIT + runtime FPS tune
-        const KEY_Code_t key = KEYBOARD_Poll();
-        if (key == KEY_EXIT) break;
-
-        const uint32_t now_ms2 = millis();
-        const bool isEdge = (key != KEY_INVALID) && (key != lastKey);
-        const bool isRepeat = (key != KEY_INVALID) && (key == lastKey);
-        const uint32_t repeatDelayMs = 80U;
+        // Drain key events once per loop: EXIT + runtime FPS tune
+        KEYS_Event_t event;
+        bool exitTest = false;
+        KEYBOARD_Update();
+        while (KEYS_Get(&event)) {
+            const KEY_Code_t key = (KEY_Code_t)event.Key;
+            const bool isPress = event.Action == KEYS_PRESS;
+
+            if (key == KEY_EXIT && isPress) {
+                exitTest = true;
+                break;
+            }
 
-        if (key == KEY_MENU && isEdge) {
-            dutyProfile = (uint8_t)((dutyProfile + 1u) % 3u);
-            Serial.printf("[GRAY_NO_GRAIN_TEST] duty_profile=%u/3\n", (unsigned)(dutyProfile + 1u));
-            lastAdjustMs = now_ms2;
-        }
+            if (key == KEY_MENU && isPress) {
+                dutyProfile = (uint8_t)((dutyProfile + 1u) % 3u);
+                Serial.printf("[GRAY_NO_GRAIN_TEST] duty_profile=%u/3\n", (unsigned)(dutyProfile + 1u));
+            }
 
-        if ((key == KEY_UP || key == KEY_DOWN) && (isEdge || ((uint32_t)(now_ms2 - lastAdjustMs) >= repeatDelayMs && isRepeat))) {
-            const uint32_t step = 20U;
-            const uint32_t minFps = 100U;
-            const uint32_t maxFps = 1500U;
+            // Auto-repeat comes from the key queue's repeat timer.
+            if ((key == KEY_UP || key == KEY_DOWN) && (isPress || event.Action == KEYS_REPEAT)) {
+                const uint32_t step = 20U;
+                const uint32_t minFps = 100U;
+                const uint32_t maxFps = 1500U;
 
-            if (key == KEY_UP) {
-                targetFps = (targetFps + step <= maxFps) ? (targetFps + step) : maxFps;
-            } else {
-                targetFps = (targetFps > minFps + step) ? (targetFps - step) : minFps;
+                if (key == KEY_UP) {
+                    targetFps = (targetFps + step <= maxFps) ? (targetFps + step) : maxFps;
+                } else {
+                    targetFps = (targetFps > minFps + step) ? (targetFps - step) : minFps;
+                }
+                Serial.printf("[GRAY_NO_GRAIN_TEST] target_fps=%lu\n", (unsigned long)targetFps);
+                // Reset scheduler phase when changing target FPS.
+                next_frame_us = micros();
             }
-            Serial.printf("[GRAY_NO_GRAIN_TEST] target_fps=%lu\n", (unsigned long)targetFps);
-            lastAdjustMs = now_ms2;
-            // Reset scheduler phase when changing target FPS.
-            next_frame_us = micros();
         }
-        lastKey = key;
+        if (exitTest) break;
 
         // Estimate work time (everything except the deliberate wait).
         const uint32_t work_us = (uint32_t)(micros() - frame_start_us);
@@ -515,9 +531,6 @@ static void ScreenCkxTest() {
         acc_inited = true;
     }
 
-    uint32_t lastAdjustMs = 0;
-    KEY_Code_t lastKey = KEY_INVALID;
-
     // Locked frame pacing.
     uint32_t next_frame_us = micros();
     uint32_t overrun_count = 0;
@@ -590,35 +603,39 @@ static void ScreenCkxTest() {
         }
 
         // Input
-        const KEY_Code_t key = KEYBOARD_Poll();
-        if (key == KEY_EXIT) break;
-
-        const uint32_t now_ms2 = millis();
-        const bool isEdge = (key != KEY_INVALID) && (key != lastKey);
-        const bool isRepeat = (key != KEY_INVALID) && (key == lastKey);
-        const uint32_t repeatDelayMs = 80U;
-
-        if (key == KEY_MENU && isEdge) {
-            dutyProfile = (uint8_t)((dutyProfile + 1u) % 3u);
-            Serial.printf("[CKX_TEST] duty_profile=%u/3\n", (unsigned)(dutyProfile + 1u));
-            lastAdjustMs = now_ms2;
-        }
+        KEYS_Event_t event;
+        bool exitTest = false;
+        KEYBOARD_Update();
+        while (KEYS_Get(&event)) {
+            const KEY_Code_t key = (KEY_Code_t)event.Key;
+            const bool isPress = event.Action == KEYS_PRESS;
+
+            if (key == KEY_EXIT && isPress) {
+                exitTest = true;
+                break;
+            }
+
+            if (key == KEY_MENU && isPress) {
+                dutyProfile = (uint8_t)((dutyProfile + 1u) % 3u);
+                Serial.printf("[CKX_TEST] duty_profile=%u/3\n", (unsigned)(dutyProfile + 1u));
+            }
 
-        if ((key == KEY_UP || key == KEY_DOWN) && (isEdge || ((uint32_t)(now_ms2 - lastAdjustMs) >= repeatDelayMs && isRepeat))) {
-            const uint32_t step = 20U;
-            const uint32_t minFps = 50U;
-            const uint32_t maxFps = 2000U;
+            // Auto-repeat comes from the key queue's repeat timer.
+            if ((key == KEY_UP || key == KEY_DOWN) && (isPress || event.Action == KEYS_REPEAT)) {
+                const uint32_t step = 20U;
+                const uint32_t minFps = 50U;
+                const uint32_t maxFps = 2000U;
 
-            if (key == KEY_UP) {
-                targetFps = (targetFps + step <= maxFps) ? (targetFps + step) : maxFps;
-            } else {
-                targetFps = (targetFps > minFps + step) ? (targetFps - step) : minFps;
+                if (key == KEY_UP) {
+                    targetFps = (targetFps + step <= maxFps) ? (targetFps + step) : maxFps;
+                } else {
+                    targetFps = (targetFps > minFps + step) ? (targetFps - step) : minFps;
+                }
+                Serial.printf("[CKX_TEST] target_fps=%lu\n", (unsigned long)targetFps);
+                next_frame_us = micros();
             }
-            Serial.printf("[CKX_TEST] target_fps=%lu\n", (unsigned long)targetFps);
-            lastAdjustMs = now_ms2;
-            next_frame_us = micros();
         }
-        lastKey = key;
+        if (exitTest) break;
 
         // Locked pacing
         const uint32_t framePeriodUs = (targetFps > 0) ? (1000000U / targetFps) : 0U;
@@ -646,54 +663,116 @@ static void ScreenCkxTest() {
 
 
  
-void setup() {
-        switch_to_factory_and_restart();
-  Serial.begin(115200);
-  Serial.println("Initializing devices...");
-  Serial.println("Probing ES8311 codec...");
+// 启动依赖图：互不相关的外设在各自任务里并行初始化，依赖用事件位表达。
+// I2C 上的设备（编解码器、EEPROM、RTC）由总线管理器串行化，可以同时跑。
+enum {
+    BOOT_I2C      = 1U << 0,
+    BOOT_LCD      = 1U << 1,
+    BOOT_BK4819   = 1U << 2,
+    BOOT_CODEC    = 1U << 3,
+    BOOT_MISC     = 1U << 4,
+    BOOT_KEYBOARD = 1U << 5,
+    BOOT_SETTINGS = 1U << 6,
+    BOOT_BATTERY  = 1U << 7,
+    BOOT_WELCOME  = 1U << 8,
+    BOOT_CALIB    = 1U << 9,
+    BOOT_RADIO    = 1U << 10
+};
+
+static void BootInitI2c(void) {
+    I2C_Init();
+    I2CBUS_Init();
+}
+
+static void BootInitLcd(void) {
+    BACKLIGHT_InitHardware();
+    ST7565_Init();
+}
+
+static void BootInitBK4819(void) {
+    BK4819_Init();
+    delay(100);  // 复位后稳定，再由 RADIO_SetupRegisters 配置
+}
+
+static void BootInitCodec(void) {
 #if ENABLE_HW_TEST_MODE
-  RunHardwareTestMode();
+    RunHardwareTestMode();
 #else
-  AUDIO_AudioPathOn();
+    AUDIO_AudioPathOn();
 
-  if (ES8311_Init()) {
-    Serial.println("ES8311 ready, playing verification tone.");
-    if (!ES8311_PlayTestTone(400)) {
-      Serial.println("ES8311 tone playback failed.");
+    if (ES8311_Init()) {
+        Serial.println("ES8311 ready, playing verification tone.");
+        if (!ES8311_PlayTestTone(400)) {
+            Serial.println("ES8311 tone playback failed.");
+        }
+    } else {
+        Serial.println("ES8311 initialization failed.");
     }
-  } else {
-    Serial.println("ES8311 initialization failed.");
-  }
-#endif
-  BOARD_Init();
-  delay(2000);
-#if ENABLE_EEPROM_TEST
-  RunEepromTest();
 #endif
-  if (!ES8311_SetReceiveMode()) {
-      Serial.println("ES8311 set receive mode failed.");
-  }
-  SCHEDULER_Init();
+    if (!ES8311_SetReceiveMode()) {
+        Serial.println("ES8311 set receive mode failed.");
+    }
+}
 
+static void BootInitMisc(void) {
+    ADC_Configure();
+    BK1080_Init(0, false);
+    UART_Init(UART_BAUD);
+}
 
-  
+// KEY4/KEY5 与 SDA/SCL 复用：和扫描一样先拿到总线，免得打断别的任务的传输
+static void BootInitKeyboard(void) {
+    while (!I2CBUS_KeypadLock()) {
+        delay(1);
+    }
+    KEYBOARD_Init();
+    I2CBUS_KeypadUnlock();
+}
+
+static void BootInitSettings(void) {
+#if ENABLE_EEPROM_TEST
+    RunEepromTest();
+#endif
     memset(gDTMF_String, '-', sizeof(gDTMF_String));
     gDTMF_String[sizeof(gDTMF_String) - 1] = 0;
 
-    BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
-
-
+    if (!EEPROM_MirrorLoad()) {
+        Serial.println("EEPROM mirror load failed, using direct I2C access.");
+    }
     SETTINGS_InitEEPROM();
 
-
-    SETTINGS_LoadCalibration();
-    #ifdef ENABLE_MESSENGER
+#ifdef ENABLE_MESSENGER
     MSG_Init();
 #endif
 #ifdef ENABLE_MDC1200
     MDC1200_init();
 #endif
+#ifdef ENABLE_ACTIVITY_LOG
+    ACTLOG_Init();
+#endif
+}
 
+static void BootInitBattery(void) {
+    BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
+    for (uint32_t i = 0; i < ARRAY_SIZE(gBatteryVoltages); i++) {
+        BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[i], &gBatteryCurrent);
+    }
+    BATTERY_GetReadings(false);
+}
+
+// 欢迎画面只要屏幕和设置就绪；射频在它显示期间继续初始化
+static void BootInitWelcome(void) {
+    UI_DisplayWelcome();
+    boot_counter_10ms = 250;
+    BOOTINIT_Mark("first screen");
+}
+
+// 校准写 BK4819 REG_3B，必须在 BK4819_Init 的软复位之后
+static void BootInitCalibration(void) {
+    SETTINGS_LoadCalibration();
+}
+
+static void BootInitRadio(void) {
     RADIO_ConfigureChannel(0, VFO_CONFIGURE_RELOAD);
     RADIO_ConfigureChannel(1, VFO_CONFIGURE_RELOAD);
 
@@ -701,14 +780,35 @@ void setup() {
 
     RADIO_SetupRegisters(true);
 
-    for (uint32_t i = 0; i < ARRAY_SIZE(gBatteryVoltages); i++) {
-        BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[i], &gBatteryCurrent);
-    }
-    BATTERY_GetReadings(false);
-
 #ifdef ENABLE_AM_FIX
     AM_fix_init();
 #endif
+}
+
+// 调用者（loopTask）在核 1；编解码器（含测试音）与屏幕放核 0，BK4819 另起任务在核 1
+static const BOOTINIT_Step_t kBootSteps[] = {
+    {"i2c",      BootInitI2c,         BOOT_I2C,      0,                                       BOOTINIT_CALLER},
+    {"lcd",      BootInitLcd,         BOOT_LCD,      0,                                       0},
+    {"bk4819",   BootInitBK4819,      BOOT_BK4819,   0,                                       1},
+    {"codec",    BootInitCodec,       BOOT_CODEC,    BOOT_I2C,                                0},
+    {"misc",     BootInitMisc,        BOOT_MISC,     0,                                       BOOTINIT_CALLER},
+    {"keyboard", BootInitKeyboard,    BOOT_KEYBOARD, BOOT_I2C,                                BOOTINIT_CALLER},
+    {"settings", BootInitSettings,    BOOT_SETTINGS, BOOT_I2C,                                BOOTINIT_CALLER},
+    {"battery",  BootInitBattery,     BOOT_BATTERY,  BOOT_SETTINGS | BOOT_MISC,               BOOTINIT_CALLER},
+    {"welcome",  BootInitWelcome,     BOOT_WELCOME,  BOOT_LCD | BOOT_SETTINGS | BOOT_BATTERY, BOOTINIT_CALLER},
+    {"calib",    BootInitCalibration, BOOT_CALIB,    BOOT_SETTINGS | BOOT_BK4819,             BOOTINIT_CALLER},
+    {"radio",    BootInitRadio,       BOOT_RADIO,    BOOT_CALIB | BOOT_CODEC | BOOT_KEYBOARD, BOOTINIT_CALLER},
+};
+
+void setup() {
+        switch_to_factory_and_restart();
+  Serial.begin(115200);
+  BOOTINIT_Mark("setup");
+  Serial.println("Initializing devices...");
+
+  SCHEDULER_Init();
+
+  BOOTINIT_Run(kBootSteps, ARRAY_SIZE(kBootSteps));
 
 #if ENABLE_CHINESE_FULL == 0
     gMenuListCount = 54;
@@ -722,6 +822,8 @@ void setup() {
     gKeyReading1 = KEY_INVALID;
     gDebounceCounter = 0;
 
+  BOOTINIT_Mark("setup done");
+
 #if ENABLE_SCREEN_FPS_TEST
     // Auto-run LCD FPS test on boot.
 #if ENABLE_SCREEN_CKX_TEST && !defined(ENABLE_OPENCV)
@@ -737,15 +839,12 @@ void setup() {
 
 
 void loop() {
-     UI_DisplayWelcome();
-
-
-
-    boot_counter_10ms = 250;
+    // 欢迎画面已在启动依赖图里显示，这里等满剩余时间（或按 EXIT 跳过），
+    // 按着的键松开之前不进主界面；睡在按键事件上，不空转
+    while (boot_counter_10ms > 0 || KEYS_DownMask() != 0) {
+        KEYS_Event_t event;
 
-    while (boot_counter_10ms > 0 || (KEYBOARD_Poll() != KEY_INVALID)) {
-
-        if (KEYBOARD_Poll() == KEY_EXIT
+        if ((KEYS_Wait(&event, 10) && event.Key == KEY_EXIT && event.Action == KEYS_PRESS)
 #if ENABLE_CHINESE_FULL == 4
             || gEeprom.POWER_ON_DISPLAY_MODE == POWER_ON_DISPLAY_MODE_NONE
 #endif
@@ -763,6 +862,9 @@ void loop() {
     GUI_SelectNextDisplay(DISPLAY_MAIN);
     gpio_set_level(GPIOA_PIN_VOICE_0 , 0);
 
+    BOOTINIT_Mark("main screen");
+    BOOTINIT_Print();
+
     gUpdateStatus = true;
 
 #if defined(ENABLE_OPENCV) && defined(ENABLE_ARDUBOY_AVR) && (ENABLE_ARDUBOY_AVR)
@@ -799,9 +901,14 @@ void loop() {
     RADIO_ConfigureNOAA();
 #endif
 
-    while (1) {
+    // BK4819、静噪和扫描交给核 0 上的电台任务，本循环只管按键、CPS 和画屏
+    RADIOTASK_Start();
 
-        APP_Update();
+    // 没有事件时阻塞在 SCHEDULER_Wait：systick 节拍总会唤醒，驱动也可以用
+    // SCHEDULER_Notify 提前唤醒。先跑时间片再跑 APP_Update，让它立刻看到
+    // 时间片里置的标志。
+    while (1) {
+        SCHEDULER_Wait();
 
         if (gNextTimeslice) {
             APP_TimeSlice10ms();
@@ -811,6 +918,8 @@ void loop() {
             APP_TimeSlice500ms();
         }
 
-
+        // 电台任务建不起来时退回原来的单循环
+        if (!RADIOTASK_IsRunning())
+            APP_Update();
     }
 }
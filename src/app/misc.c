@@ -42,6 +42,7 @@ const uint16_t key_repeat_10ms = 80 / 10;   // 80ms .. MUST be less than 'key_re
 const uint16_t key_debounce_10ms = 20 / 10;   // 20ms
 
 const uint8_t scan_delay_10ms = 210 / 10;   // 210ms
+const uint8_t scan_css_confirm_delay_10ms = 100 / 10;   // 100ms
 
 const uint16_t dual_watch_count_after_tx_10ms = 3600 / 10;   // 3.6 sec after TX ends
 const uint16_t dual_watch_count_after_rx_10ms = 1000 / 10;   // 1 sec after RX ends ?
@@ -224,6 +225,7 @@ bool          gIsNoaaMode;
 #endif
 
 volatile bool gUpdateDisplay;
+volatile bool gFixInterfGlitch;
 
 
 uint8_t gShowChPrefix;
@@ -231,9 +233,6 @@ uint8_t gShowChPrefix;
 volatile bool gNextTimeslice;
 volatile uint8_t gFoundCDCSSCountdown_10ms;
 volatile uint8_t gFoundCTCSSCountdown_10ms;
-#ifdef ENABLE_VOX
-volatile uint16_t gVoxStopCountdown_10ms;
-#endif
 volatile bool gNextTimeslice40ms;
 #ifdef ENABLE_NOAA
 volatile uint16_t gNOAACountdown_10ms = 0;
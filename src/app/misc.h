@@ -100,6 +100,7 @@ extern const uint16_t        key_repeat_10ms;
 extern const uint16_t        key_debounce_10ms;
 
 extern const uint8_t         scan_delay_10ms;
+extern const uint8_t         scan_css_confirm_delay_10ms;
 
 extern const uint16_t        battery_save_count_10ms;
 
@@ -305,15 +306,14 @@ extern bool              gIsNoaaMode;
 #endif
 extern volatile bool         gNextTimeslice;
 extern volatile bool         gUpdateDisplay;
+// 发射结束后重发屏幕初始化命令，由主循环在画屏前执行
+extern volatile bool         gFixInterfGlitch;
 #ifdef ENABLE_FMRADIO
 extern uint8_t           gFM_ChannelPosition;
 #endif
 extern uint8_t               gShowChPrefix;
 extern volatile uint8_t      gFoundCDCSSCountdown_10ms;
 extern volatile uint8_t      gFoundCTCSSCountdown_10ms;
-#ifdef ENABLE_VOX
-extern volatile uint16_t gVoxStopCountdown_10ms;
-#endif
 extern volatile bool         gNextTimeslice40ms;
 #ifdef ENABLE_NOAA
 extern volatile uint16_t gNOAACountdown_10ms;
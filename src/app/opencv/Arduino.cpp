@@ -2,6 +2,12 @@
 #include "../scheduler.h"
 #include <unistd.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
 void digitalWrite(uint8_t pin, uint8_t val)
 {
     (void)pin;
@@ -38,8 +44,31 @@ int digitalRead(uint8_t pin)
     return HIGH;
 }
 
-void SCHEDULER_Init(void)
+static std::mutex gSchedulerMutex;
+static std::condition_variable gSchedulerCond;
+static uint32_t gSchedulerEvents;
+
+void SCHEDULER_Notify(uint32_t Events)
 {
+    {
+        std::lock_guard<std::mutex> lock(gSchedulerMutex);
+        gSchedulerEvents |= Events;
+    }
+    gSchedulerCond.notify_one();
+}
+
+void SCHEDULER_NotifyFromISR(uint32_t Events)
+{
+    SCHEDULER_Notify(Events);
+}
+
+uint32_t OPENCV_SchedulerBlock(void)
+{
+    std::unique_lock<std::mutex> lock(gSchedulerMutex);
+    gSchedulerCond.wait(lock, [] { return gSchedulerEvents != 0; });
+    const uint32_t events = gSchedulerEvents;
+    gSchedulerEvents = 0;
+    return events;
 }
 
 esp_err_t gpio_config(const gpio_config_t *pGPIOConfig)
@@ -82,22 +111,57 @@ uart_t* uartBegin(uint8_t uart_nr, uint32_t baudrate, uint32_t config, int8_t rx
     return uart;
 }
 
+// Host UART: RX comes from OPENCV_UartFeed (recorded CPS sessions), TX is
+// only counted.  The pending RX is capped at a 1 KB driver FIFO per read.
+static std::vector<uint8_t> gUartRx;
+static size_t gUartRxPos = 0;
+static size_t gUartTxCount = 0;
+
+void OPENCV_UartFeed(const uint8_t *pData, size_t size)
+{
+    gUartRx.erase(gUartRx.begin(), gUartRx.begin() + (ptrdiff_t)gUartRxPos);
+    gUartRxPos = 0;
+    gUartRx.insert(gUartRx.end(), pData, pData + size);
+}
+
+size_t OPENCV_UartTxCount(void)
+{
+    return gUartTxCount;
+}
+
 void uartWrite(uart_t* uart, uint8_t c)
 {
     (void)uart;
     (void)c;
+    gUartTxCount++;
+}
+
+uint32_t uartAvailableForWrite(uart_t* uart)
+{
+    (void)uart;
+    return 1024;
 }
 
 uint32_t uartAvailable(uart_t* uart)
 {
     (void)uart;
-    return 0;
+    const size_t pending = gUartRx.size() - gUartRxPos;
+    return (uint32_t)(pending < 1024 ? pending : 1024);
 }
 
 uint8_t uartRead(uart_t* uart)
 {
     (void)uart;
-    return 0;
+    return gUartRxPos < gUartRx.size() ? gUartRx[gUartRxPos++] : 0;
+}
+
+size_t uartReadBytes(uart_t* uart, uint8_t *buffer, size_t size, uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    const size_t n = std::min<size_t>(size, uartAvailable(uart));
+    memcpy(buffer, gUartRx.data() + gUartRxPos, n);
+    gUartRxPos += n;
+    return n;
 }
 
 esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
@@ -176,10 +176,15 @@ int digitalRead(uint8_t pin);
 
 
 void uartWrite(uart_t* uart, uint8_t c);
+uint32_t uartAvailableForWrite(uart_t* uart);
 
 
 uint32_t uartAvailable(uart_t* uart);
 uint8_t uartRead(uart_t* uart);
+size_t uartReadBytes(uart_t* uart, uint8_t *buffer, size_t size, uint32_t timeout_ms);
+// Host: bytes queued here are returned by uartRead*/uartAvailable (CPS replay).
+void OPENCV_UartFeed(const uint8_t *pData, size_t size);
+size_t OPENCV_UartTxCount(void);
 esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level);
 void OPENCV_ShutdownDisplay(void);
 void OPENCV_SetRestartArgs(int argc, char **argv);
@@ -278,6 +283,10 @@ struct EspRestartException {};
   static inline void delayMicroseconds(unsigned us) {
       usleep((useconds_t)us);
   }
+
+  // C translation units get real symbols (opencv/linker_stubs.c).
+  unsigned long millis(void);
+  unsigned long micros(void);
 #endif
 #define ets_delay_us(us) delayMicroseconds(us)
 #define esp_rom_delay_us(us) delayMicroseconds(us)
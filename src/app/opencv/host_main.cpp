@@ -1,23 +1,74 @@
 #include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <thread>
+#include <vector>
 #include "Arduino.hpp"
+#include "driver/uart1.h"
+#include "helper/timerwheel.h"
+#include "scheduler.h"
+
+extern "C" {
+#include "app/uart.h"
+}
 
-extern "C" void SystickHandler(void);
 
 void setup(void);
 void loop(void);
 
+// --cps-bench FILE [ROUNDS]: feed a recorded CPS session (the raw bytes a
+// host tool sent, e.g. from scripts/cps_session_gen.py) through the UART
+// parser and command handlers, and report the throughput.
+static int CpsBench(const char *path, unsigned rounds)
+{
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        fprintf(stderr, "cps-bench: cannot open %s\n", path);
+        return 1;
+    }
+    const std::vector<uint8_t> session((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+    UART_Init(38400);
+
+    size_t frames = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned r = 0; r < rounds; r++) {
+        OPENCV_UartFeed(session.data(), session.size());
+        for (;;) {
+            if (UART_IsCommandAvailable()) {
+                UART_HandleCommand();
+                frames++;
+            } else if (UART_Available() == 0) {
+                break;
+            }
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double bytes = (double)session.size() * rounds;
+
+    printf("cps-bench: %zu frames, %.0f bytes in, %zu bytes out, %.3f s, %.0f frames/s, %.2f MB/s\n",
+           frames, bytes, OPENCV_UartTxCount(), seconds, frames / seconds, bytes / seconds / 1e6);
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
+    if (argc >= 3 && strcmp(argv[1], "--cps-bench") == 0)
+        return CpsBench(argv[2], argc >= 4 ? (unsigned)strtoul(argv[3], nullptr, 0) : 1U);
+
     OPENCV_SetRestartArgs(argc, argv);
 
     std::thread([] {
         using namespace std::chrono;
         auto next = steady_clock::now();
         while (true) {
-            next += 10ms;
+            next += 1ms;
             std::this_thread::sleep_until(next);
-            SystickHandler();
+            if (TIMERWHEEL_TickFromISR())
+                TIMERWHEEL_Dispatch();
             // 若严重落后，可选择 next = steady_clock::now(); 防止疯狂补课
         }
     }).detach();
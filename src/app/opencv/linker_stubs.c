@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <time.h>
 
 #ifdef ENABLE_OPENCV
 uint32_t __bss_start__[1];
@@ -7,3 +8,27 @@ uint8_t flash_data_start[1];
 uint8_t sram_data_start[1];
 uint8_t sram_data_end[1];
 #endif
+
+#ifdef ENABLE_OPENCV
+static uint64_t OPENCV_ElapsedUs(void)
+{
+    static uint64_t start;
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+    const uint64_t now = (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+    if (start == 0)
+        start = now;
+    return now - start;
+}
+
+unsigned long millis(void)
+{
+    return (unsigned long)(OPENCV_ElapsedUs() / 1000U);
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)OPENCV_ElapsedUs();
+}
+#endif
@@ -14,6 +14,7 @@ static int gTargetW = 0;
 static int gTargetH = 0;
 static std::atomic<int> gLastKey{-1};
 static std::atomic<int> gHeldKey{-1};
+static void (*gKeyHandler)(int key, int pressed) = nullptr;
 static std::vector<uint8_t> gLcdCanvas;
 static std::vector<uint8_t> gLcdRgba;
 static GLuint gTexture = 0;
@@ -71,6 +72,21 @@ static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, i
       gHeldKey.store(-1);
     }
   }
+  if (gKeyHandler && action != GLFW_REPEAT) {
+    gKeyHandler(key, action == GLFW_PRESS ? 1 : 0);
+  }
+}
+
+void OPENCV_SetKeyHandler(void (*pHandler)(int key, int pressed))
+{
+  gKeyHandler = pHandler;
+}
+
+void OPENCV_PumpEvents(void)
+{
+  if (gWindow) {
+    glfwPollEvents();
+  }
 }
 
 int OPENCV_PollKey(void)
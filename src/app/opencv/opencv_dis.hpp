@@ -13,5 +13,8 @@
 bool getScreenSize(int& width, int& height);
 int OPENCV_PollKey(void);
 int OPENCV_IsKeyDown(int key);
+// Called from glfwPollEvents for every press/release (GLFW repeats dropped)
+void OPENCV_SetKeyHandler(void (*pHandler)(int key, int pressed));
+void OPENCV_PumpEvents(void);
 
 
@@ -14,6 +14,7 @@
 #include "driver/system.h"
 #include "frequencies.h"
 #include "helper/battery.h"
+#include "helper/keys.h"
 #include "misc.h"
 #include "radio.h"
 #include "scheduler.h"
@@ -86,8 +87,10 @@ void loop() {
 
     boot_counter_10ms = 250;
 
-    while (boot_counter_10ms > 0 || (KEYBOARD_Poll() != KEY_INVALID)) {
-        if (KEYBOARD_Poll() == KEY_EXIT
+    while (boot_counter_10ms > 0 || KEYS_DownMask() != 0) {
+        KEYS_Event_t event;
+
+        if ((KEYS_Wait(&event, 10) && event.Key == KEY_EXIT && event.Action == KEYS_PRESS)
 #if ENABLE_CHINESE_FULL == 4
             || gEeprom.POWER_ON_DISPLAY_MODE == POWER_ON_DISPLAY_MODE_NONE
 #endif
@@ -103,7 +106,7 @@ void loop() {
     gUpdateStatus = true;
 
     while (1) {
-        APP_Update();
+        SCHEDULER_Wait();
 
         if (gNextTimeslice) {
             APP_TimeSlice10ms();
@@ -112,5 +115,7 @@ void loop() {
         if (gNextTimeslice_500ms) {
             APP_TimeSlice500ms();
         }
+
+        APP_Update();
     }
 }
@@ -1050,6 +1050,34 @@ void RADIO_SendCssTail(void) {
     SYSTEM_DelayMs(200);
 }
 
+// The BK4819 only matches the RX VFO's own CTCSS/DCS code (found/lost
+// interrupts, DCS polarity in REG_0C) and never measures an arbitrary tone,
+// so what it decoded is the configured code once the chip has matched it.
+DCS_CodeType_t RADIO_GetDecodedCode(bool CtcssFound, bool CdcssFound, uint8_t *pCode) {
+    *pCode = gRxVfo->pRX->Code;
+
+    switch (gCurrentCodeType) {
+        case CODE_TYPE_CONTINUOUS_TONE:
+            if (CtcssFound)
+                return CODE_TYPE_CONTINUOUS_TONE;
+            break;
+        case CODE_TYPE_DIGITAL:
+        case CODE_TYPE_REVERSE_DIGITAL:
+            if (CdcssFound) {
+                // An inverted code word was received
+                if (gCDCSSCodeType == CDCSS_NEGATIVE_CODE)
+                    return gCurrentCodeType == CODE_TYPE_DIGITAL ? CODE_TYPE_REVERSE_DIGITAL : CODE_TYPE_DIGITAL;
+                return gCurrentCodeType;
+            }
+            break;
+        default:
+            break;
+    }
+
+    *pCode = 0;
+    return CODE_TYPE_OFF;
+}
+
 void RADIO_PrepareCssTX(void) {
     RADIO_PrepareTX();
 
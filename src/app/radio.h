@@ -169,6 +169,7 @@ void     RADIO_SetVfoState(VfoState_t State);
 void     RADIO_PrepareTX(void);
 void     RADIO_SendCssTail(void);
 void     RADIO_PrepareCssTX(void);
+DCS_CodeType_t RADIO_GetDecodedCode(bool CtcssFound, bool CdcssFound, uint8_t *pCode);
 void     RADIO_SendEndOfTransmission(void);
 void RADIO_SetupAGC(bool listeningAM, bool disable);
 
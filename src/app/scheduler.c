@@ -16,10 +16,12 @@
 
 #ifndef ENABLE_OPENCV
 #include <Arduino.h>
+#include <esp_timer.h>
 #else
 #include "opencv/Arduino.hpp"
 #endif
 #include "app/chFrScanner.h"
+#include "app/radiotask.h"
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
 #endif
@@ -27,7 +29,9 @@
 #include "audio.h"
 #include "functions.h"
 #include "helper/battery.h"
+#include "helper/timerwheel.h"
 #include "misc.h"
+#include "scheduler.h"
 #include "settings.h"
 
 #include "driver/backlight.h"
@@ -47,44 +51,159 @@
 
 static volatile uint32_t gGlobalSysTickCounter;
 void SystickHandler(void);
-void SCHEDULER_Init(void);
+
+// SystickHandler 是时间轮上的 SCHEDULER_SYSTICK_MS 周期定时器，在任务上下文里运行
+static void SCHEDULER_Systick(void *pArg)
+{
+	(void)pArg;
+	SystickHandler();
+	SCHEDULER_Notify(SCHEDULER_EVENT_TICK);
+}
+
+static TIMERWHEEL_Timer_t gSystickTimer = TIMERWHEEL_TIMER(SCHEDULER_Systick, NULL);
+
+// 1ms 节拍相对标称周期的最大偏差（硬件定时器中断实际到达时刻）
+static volatile uint32_t gTickJitterMaxUs;
 
 #ifndef ENABLE_OPENCV
+#define SCHEDULER_TICK_US 1000U
+
 // ESP32-S3 硬件定时器
 static hw_timer_t *timer = NULL;
-static portMUX_TYPE timerMux = portMUX_INITIALIZER_UNLOCKED;
 
+// 主循环任务，事件以通知位的形式发给它
+static TaskHandle_t gSchedulerTask;
+// 执行时间轮回调的任务
+static TaskHandle_t gTimerTask;
+static uint32_t gTickLastUs;
 
-// 定时器中断回调函数 (在 ISR 上下文中执行)
+// 定时器中断回调函数 (在 ISR 上下文中执行)：只推进时间轮，
+// 工作量与本节拍到期的定时器个数成正比
 void IRAM_ATTR onTimer(void)
 {
-	portENTER_CRITICAL_ISR(&timerMux);
-	SystickHandler();
-	portEXIT_CRITICAL_ISR(&timerMux);
+	const uint32_t now = (uint32_t)esp_timer_get_time();
+
+	if (gTickLastUs) {
+		const uint32_t period = now - gTickLastUs;
+		const uint32_t jitter = period > SCHEDULER_TICK_US ? period - SCHEDULER_TICK_US : SCHEDULER_TICK_US - period;
+		if (jitter > gTickJitterMaxUs)
+			gTickJitterMaxUs = jitter;
+	}
+	gTickLastUs = now;
+
+	if (TIMERWHEEL_TickFromISR() && gTimerTask) {
+		BaseType_t woken = pdFALSE;
+		vTaskNotifyGiveFromISR(gTimerTask, &woken);
+		if (woken)
+			portYIELD_FROM_ISR();
+	}
+}
+
+static void SCHEDULER_TimerTask(void *pArg)
+{
+	(void)pArg;
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		TIMERWHEEL_Dispatch();
+	}
+}
+
+void IRAM_ATTR SCHEDULER_NotifyFromISR(uint32_t Events)
+{
+	BaseType_t woken = pdFALSE;
+
+	if (gSchedulerTask == NULL)
+		return;
+	xTaskNotifyFromISR(gSchedulerTask, Events, eSetBits, &woken);
+	if (woken)
+		portYIELD_FROM_ISR();
+}
+
+void SCHEDULER_Notify(uint32_t Events)
+{
+	if (gSchedulerTask)
+		xTaskNotify(gSchedulerTask, Events, eSetBits);
+}
+
+static uint32_t SCHEDULER_Block(void)
+{
+	uint32_t events = 0;
+
+	// 没有事件时主循环所在核进入空闲任务（WAITI 停时钟），不再空转
+	xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+	return events;
 }
 
 // 初始化调度器定时器
 void SCHEDULER_Init(void)
 {
+	gSchedulerTask = xTaskGetCurrentTaskHandle();
+
+	// 回调任务钉在主循环所在核、优先级高于它：与原先在中断里运行一样，
+	// 只会抢占主循环，不会与它并发
+	xTaskCreatePinnedToCore(SCHEDULER_TimerTask, "timerwheel", 4096, NULL, 10, &gTimerTask, xPortGetCoreID());
+	TIMERWHEEL_Start(&gSystickTimer, SCHEDULER_SYSTICK_MS, SCHEDULER_SYSTICK_MS);
+
 	// 配置硬件定时器
-	// ESP32-S3 主频 240MHz
-	// 定时器 0, 分频器 240 (240MHz / 240 = 1MHz, 每个计数 = 1us)
+	// 定时器时钟是 APB（80MHz，与 CPU 主频无关），分频到 1MHz，每个计数 = 1us
 	// 参数: timer_num, divider, count_up
-	timer = timerBegin(0, 240, true);
+	timer = timerBegin(0, getApbFrequency() / 1000000U, true);
 	
 	// 绑定中断回调函数
 	timerAttachInterrupt(timer, &onTimer, true);
 	
-	// 设置定时器报警值: 10000us = 10ms
+	// 设置定时器报警值: 1000us = 1ms（时间轮分辨率）
 	// 参数: timer, alarm_value, auto_reload
-	timerAlarmWrite(timer, 10000, true);
+	timerAlarmWrite(timer, SCHEDULER_TICK_US, true);
 	
 	// 启动定时器
 	timerAlarmEnable(timer);
 }
+#else
+uint32_t OPENCV_SchedulerBlock(void);
+#define SCHEDULER_Block OPENCV_SchedulerBlock
+
+// 模拟器：host_main 的节拍线程每 1ms 推进并分发时间轮
+void SCHEDULER_Init(void)
+{
+	TIMERWHEEL_Start(&gSystickTimer, SCHEDULER_SYSTICK_MS, SCHEDULER_SYSTICK_MS);
+}
 #endif
 
-// we come here every 10ms
+uint16_t SCHEDULER_TickJitterUs(void)
+{
+	const uint32_t jitter = gTickJitterMaxUs;
+
+	gTickJitterMaxUs = 0;
+	return (uint16_t)(jitter > 0xFFFFU ? 0xFFFFU : jitter);
+}
+
+static uint32_t gSchedulerIdleUs;
+static uint32_t gSchedulerIdleSinceUs;
+
+uint32_t SCHEDULER_Wait(void)
+{
+	const uint32_t start = micros();
+	const uint32_t events = SCHEDULER_Block();
+
+	gSchedulerIdleUs += micros() - start;
+	return events;
+}
+
+uint16_t SCHEDULER_IdlePermille(void)
+{
+	const uint32_t now = micros();
+	const uint32_t span = now - gSchedulerIdleSinceUs;
+	const uint32_t idle = gSchedulerIdleUs;
+
+	gSchedulerIdleUs = 0;
+	gSchedulerIdleSinceUs = now;
+	if (span == 0)
+		return 0;
+	return (uint16_t)(idle >= span ? 1000U : (uint64_t)idle * 1000U / span);
+}
+
+// we come here every SCHEDULER_SYSTICK_MS (the "10ms" tick)
 void SystickHandler(void)
 {
 	gGlobalSysTickCounter++;
@@ -95,13 +214,31 @@ void SystickHandler(void)
 	{
 		gNextTimeslice_500ms = true;
 		
-		DECREMENT_AND_TRIGGER(gTxTimerCountdown_500ms, gTxTimeoutReached);
 		DECREMENT(gSerialConfigCountDown_500ms);
 	}
 
 	if ((gGlobalSysTickCounter & 3) == 0)
 		gNextTimeslice40ms = true;
 
+	DECREMENT(boot_counter_10ms);
+
+	// 电台任务运行时由它在自己的节拍里持锁推进，这里不碰
+	if (!RADIOTASK_IsRunning())
+		SCHEDULER_RadioSystick();
+}
+
+// 电台相关的倒计时和标志：和读写它们的静噪、扫描、双守代码在同一个上下文里改，
+// 不会与核 0 上的电台任务并发读改写
+void SCHEDULER_RadioSystick(void)
+{
+	static uint8_t ticks;
+
+	if (++ticks >= 50)
+	{
+		ticks = 0;
+		DECREMENT_AND_TRIGGER(gTxTimerCountdown_500ms, gTxTimeoutReached);
+	}
+
 	#ifdef ENABLE_NOAA
 		DECREMENT(gNOAACountdown_10ms);
 	#endif
@@ -142,10 +279,4 @@ void SystickHandler(void)
 			if (gCurrentFunction != FUNCTION_TRANSMIT && gCurrentFunction != FUNCTION_RECEIVE)
 				DECREMENT_AND_TRIGGER(gFmPlayCountdown_10ms, gScheduleFM);
 	#endif
-
-	#ifdef ENABLE_VOX
-		DECREMENT(gVoxStopCountdown_10ms);
-	#endif
-
-	DECREMENT(boot_counter_10ms);
 }
@@ -17,6 +17,8 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -24,13 +26,79 @@ extern "C" {
 /**
  * @brief Initialize the scheduler timer
  * 
- * This function sets up a hardware timer on ESP32-S3 that triggers 
- * every 10ms to call the SystickHandler function.
+ * This function sets up a 1ms hardware timer on ESP32-S3 that drives
+ * the timer wheel (helper/timerwheel.h), and registers SystickHandler
+ * on it as a SCHEDULER_SYSTICK_MS periodic timer.  Wheel callbacks run
+ * in a task pinned to the calling core, not in the interrupt.
  * 
  * Must be called once during system initialization (in setup()).
  */
 void SCHEDULER_Init(void);
 
+/**
+ * @brief SystickHandler period, i.e. the real length of one "_10ms" tick
+ *
+ * The original ESP32-S3 timer setup divided the 80MHz APB clock by 240
+ * and fired every 30ms, and every *_10ms / *_500ms constant in the
+ * firmware (key repeat, scan pause, backlight, VOX, squelch tail, ...)
+ * has been tuned on hardware at that rate.  The simulator ticks every
+ * 10ms as it always did.
+ */
+#ifndef ENABLE_OPENCV
+#define SCHEDULER_SYSTICK_MS 30U
+#else
+#define SCHEDULER_SYSTICK_MS 10U
+#endif
+
+/**
+ * @brief Largest deviation of a 1ms hardware tick from its nominal period
+ *
+ * @return microseconds since the previous call (0 in the simulator)
+ */
+uint16_t SCHEDULER_TickJitterUs(void);
+
+/**
+ * @brief Main loop wake-up reasons
+ *
+ * Interrupt handlers and drivers post these to the task that called
+ * SCHEDULER_Init(); the main loop sleeps in SCHEDULER_Wait() until one
+ * arrives.  Posting the same event twice before the loop runs has the
+ * same effect as posting it once.
+ */
+enum {
+    SCHEDULER_EVENT_TICK  = 1U << 0,   // systick (SCHEDULER_SYSTICK_MS)
+    SCHEDULER_EVENT_RADIO = 1U << 1,   // BK4819 interrupt pending, radio task only
+    SCHEDULER_EVENT_KEY   = 1U << 2,   // keypad state changed
+    SCHEDULER_EVENT_UART  = 1U << 3    // CPS bytes received
+};
+
+void SCHEDULER_Notify(uint32_t Events);
+
+/**
+ * @brief Advance the radio countdowns (squelch tail, scan pause, dual
+ *        watch, power save, TX timeout, ...) by one systick
+ *
+ * SystickHandler does this itself unless the radio task is running; the
+ * radio task then calls it once per elapsed tick while holding
+ * RADIOTASK_Lock, so only one context ever modifies those variables.
+ */
+void SCHEDULER_RadioSystick(void);
+void SCHEDULER_NotifyFromISR(uint32_t Events);
+
+/**
+ * @brief Block until at least one event has been posted
+ *
+ * @return the events posted since the previous call
+ */
+uint32_t SCHEDULER_Wait(void);
+
+/**
+ * @brief Share of time spent blocked in SCHEDULER_Wait()
+ *
+ * @return permille of the time since the previous call
+ */
+uint16_t SCHEDULER_IdlePermille(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,7 +38,7 @@ static const uint32_t gDefaultFrequencyTable[] =
 EEPROM_Config_t gEeprom={0};
  int               key_dir;
 
-void SETTINGS_InitEEPROM(void)
+static void SETTINGS_LoadGeneral(void)
 {
     uint8_t Data[16] = {0};
     // 0E70..0E77
@@ -84,33 +84,6 @@ void SETTINGS_InitEEPROM(void)
 	gEeprom.NoaaChannel[1] = IS_NOAA_CHANNEL(Data[7])  ? Data[7] : NOAA_CHANNEL_FIRST;
 #endif
 
-#ifdef ENABLE_FMRADIO
-    {	// 0E88..0E8F
-		struct
-		{
-			uint16_t SelectedFrequency;
-			uint8_t  SelectedChannel;
-			uint8_t  IsMrMode;
-			uint8_t  Padding[8];
-		} __attribute__((packed)) FM;
-
-		EEPROM_ReadBuffer(0x0E88, &FM, 8);
-		gEeprom.FM_LowerLimit = 640;
-		gEeprom.FM_UpperLimit = 1080;
-		if (FM.SelectedFrequency < gEeprom.FM_LowerLimit || FM.SelectedFrequency > gEeprom.FM_UpperLimit)
-			gEeprom.FM_SelectedFrequency = 960;
-		else
-			gEeprom.FM_SelectedFrequency = FM.SelectedFrequency;
-
-		gEeprom.FM_SelectedChannel = FM.SelectedChannel;
-		gEeprom.FM_IsMrMode        = (FM.IsMrMode < 2) ? FM.IsMrMode : false;
-	}
-
-	// 0E40..0E67
-	EEPROM_ReadBuffer(0x0E40, gFM_Channels, sizeof(gFM_Channels));
-	FM_ConfigureChannelState();
-#endif
-
     // 0E90..0E97
     EEPROM_ReadBuffer(0x0E90, Data, 8);
     gEeprom.BEEP_CONTROL                 = Data[0] & 1;
@@ -166,6 +139,79 @@ void SETTINGS_InitEEPROM(void)
     gEeprom.TX_VFO                         = (Data[3] <  2) ? Data[3] : 0;
     gEeprom.BATTERY_TYPE                   = (Data[4] < BATTERY_TYPE_UNKNOWN) ? Data[4] : BATTERY_TYPE_1600_MAH;
 
+    // 0F18..0F1F
+    EEPROM_ReadBuffer(0x0F18, Data, 8);
+    gEeprom.SCAN_LIST_DEFAULT = (Data[0] < 3) ? Data[0] : 0;  // we now have 'all' channel scan option
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        const unsigned int j = 1 + (i * 3);
+        gEeprom.SCAN_LIST_ENABLED[i]     = (Data[j + 0] < 2) ? Data[j] : false;
+        gEeprom.SCANLIST_PRIORITY_CH1[i] =  Data[j + 1];
+        gEeprom.SCANLIST_PRIORITY_CH2[i] =  Data[j + 2];
+    }
+
+    // 0F40..0F47
+    EEPROM_ReadBuffer(0x0F40, Data, 8);
+    gSetting_F_LOCK            = (Data[0] < F_LOCK_LEN) ? Data[0] : F_LOCK_DEF;
+//    gSetting_350TX             = (Data[1] < 2) ? Data[1] : false;  // was true
+#ifdef ENABLE_DTMF_CALLING
+    gSetting_KILLED            = (Data[2] < 2) ? Data[2] : false;
+#endif
+//    gSetting_200TX             = (Data[3] < 2) ? Data[3] : false;
+//    gSetting_500TX             = (Data[4] < 2) ? Data[4] : false;
+//    gSetting_350EN             = (Data[5] < 2) ? Data[5] : true;
+    gSetting_ScrambleEnable    = (Data[6] < 2) ? Data[6] : true;
+    //gSetting_TX_EN             = (Data[7] & (1u << 0)) ? true : false;
+    gSetting_live_DTMF_decoder = !!(Data[7] & (1u << 1));
+    //gSetting_battery_text      = (((Data[7] >> 2) & 3u) <= 2) ? (Data[7] >> 2) & 3 : 2;
+//#ifdef ENABLE_AUDIO_BAR
+    //gSetting_mic_bar       = (Data[7] & (1u << 4)) ? true : false;
+//#endif
+#ifdef ENABLE_AM_FIX
+    gSetting_AM_fix = !!(Data[7] & (1u << 5));
+#endif
+  //  gSetting_backlight_on_tx_rx = (Data[7] >> 6) & 3u;
+
+    if (!gEeprom.VFO_OPEN)
+    {
+        gEeprom.ScreenChannel[0] = gEeprom.MrChannel[0];
+        gEeprom.ScreenChannel[1] = gEeprom.MrChannel[1];
+    }
+}
+
+#ifdef ENABLE_FMRADIO
+static void SETTINGS_LoadFM(void)
+{
+    {	// 0E88..0E8F
+		struct
+		{
+			uint16_t SelectedFrequency;
+			uint8_t  SelectedChannel;
+			uint8_t  IsMrMode;
+			uint8_t  Padding[8];
+		} __attribute__((packed)) FM;
+
+		EEPROM_ReadBuffer(0x0E88, &FM, 8);
+		gEeprom.FM_LowerLimit = 640;
+		gEeprom.FM_UpperLimit = 1080;
+		if (FM.SelectedFrequency < gEeprom.FM_LowerLimit || FM.SelectedFrequency > gEeprom.FM_UpperLimit)
+			gEeprom.FM_SelectedFrequency = 960;
+		else
+			gEeprom.FM_SelectedFrequency = FM.SelectedFrequency;
+
+		gEeprom.FM_SelectedChannel = FM.SelectedChannel;
+		gEeprom.FM_IsMrMode        = (FM.IsMrMode < 2) ? FM.IsMrMode : false;
+	}
+
+	// 0E40..0E67
+	EEPROM_ReadBuffer(0x0E40, gFM_Channels, sizeof(gFM_Channels));
+	FM_ConfigureChannelState();
+}
+#endif
+
+static void SETTINGS_LoadDTMF(void)
+{
+    uint8_t Data[16] = {0};
     // 0ED0..0ED7
     EEPROM_ReadBuffer(0x0ED0, Data, 8);
     gEeprom.DTMF_SIDE_TONE               = (Data[0] <   2) ? Data[0] : true;
@@ -229,46 +275,10 @@ EEPROM_ReadBuffer(0x0EF0, Data, sizeof(gEeprom.REVIVE_CODE));
     } else {
         strcpy(gEeprom.DTMF_DOWN_CODE, "54321");
     }
+}
 
-    // 0F18..0F1F
-    EEPROM_ReadBuffer(0x0F18, Data, 8);
-    gEeprom.SCAN_LIST_DEFAULT = (Data[0] < 3) ? Data[0] : 0;  // we now have 'all' channel scan option
-    for (unsigned int i = 0; i < 2; i++)
-    {
-        const unsigned int j = 1 + (i * 3);
-        gEeprom.SCAN_LIST_ENABLED[i]     = (Data[j + 0] < 2) ? Data[j] : false;
-        gEeprom.SCANLIST_PRIORITY_CH1[i] =  Data[j + 1];
-        gEeprom.SCANLIST_PRIORITY_CH2[i] =  Data[j + 2];
-    }
-
-    // 0F40..0F47
-    EEPROM_ReadBuffer(0x0F40, Data, 8);
-    gSetting_F_LOCK            = (Data[0] < F_LOCK_LEN) ? Data[0] : F_LOCK_DEF;
-//    gSetting_350TX             = (Data[1] < 2) ? Data[1] : false;  // was true
-#ifdef ENABLE_DTMF_CALLING
-    gSetting_KILLED            = (Data[2] < 2) ? Data[2] : false;
-#endif
-//    gSetting_200TX             = (Data[3] < 2) ? Data[3] : false;
-//    gSetting_500TX             = (Data[4] < 2) ? Data[4] : false;
-//    gSetting_350EN             = (Data[5] < 2) ? Data[5] : true;
-    gSetting_ScrambleEnable    = (Data[6] < 2) ? Data[6] : true;
-    //gSetting_TX_EN             = (Data[7] & (1u << 0)) ? true : false;
-    gSetting_live_DTMF_decoder = !!(Data[7] & (1u << 1));
-    //gSetting_battery_text      = (((Data[7] >> 2) & 3u) <= 2) ? (Data[7] >> 2) & 3 : 2;
-//#ifdef ENABLE_AUDIO_BAR
-    //gSetting_mic_bar       = (Data[7] & (1u << 4)) ? true : false;
-//#endif
-#ifdef ENABLE_AM_FIX
-    gSetting_AM_fix = !!(Data[7] & (1u << 5));
-#endif
-  //  gSetting_backlight_on_tx_rx = (Data[7] >> 6) & 3u;
-
-    if (!gEeprom.VFO_OPEN)
-    {
-        gEeprom.ScreenChannel[0] = gEeprom.MrChannel[0];
-        gEeprom.ScreenChannel[1] = gEeprom.MrChannel[1];
-    }
-
+static void SETTINGS_LoadChannelAttributes(void)
+{
     // 0D60..0E27
     EEPROM_ReadBuffer(0x0D60, gMR_ChannelAttributes, sizeof(gMR_ChannelAttributes));
     for(uint16_t i = 0; i < sizeof(gMR_ChannelAttributes); i++) {
@@ -278,7 +288,10 @@ EEPROM_ReadBuffer(0x0EF0, Data, sizeof(gEeprom.REVIVE_CODE));
             att->band = 0xf;
         }
     }
+}
 
+static void SETTINGS_LoadAesKey(void)
+{
     // 0F30..0F3F
     char B[8];
     memset(B,0XFF,8);
@@ -298,6 +311,67 @@ EEPROM_ReadBuffer(0x0EF0, Data, sizeof(gEeprom.REVIVE_CODE));
     }
 }
 
+// CPS 写入地址 -> 受影响的配置区域；信道名 / DTMF、MDC 联系人是用到时才读的，
+// 写入它们不需要重载任何东西。
+static const struct {
+    uint16_t Start;
+    uint16_t End;       // exclusive
+    uint8_t  Regions;
+} SETTINGS_RegionMap[] = {
+    {0x0000, 0x0D60, SETTINGS_REGION_CHANNELS},      // MR + VFO channel data
+    {0x0D60, 0x0E28, SETTINGS_REGION_ATTRIBUTES},
+    {0x0E40, 0x0E70, SETTINGS_REGION_FM},            // FM channels
+    {0x0E70, 0x0E88, SETTINGS_REGION_GENERAL},
+    {0x0E88, 0x0E90, SETTINGS_REGION_FM},            // FM state
+    {0x0E90, 0x0ED0, SETTINGS_REGION_GENERAL},
+    {0x0ED0, 0x0F18, SETTINGS_REGION_DTMF},
+    {0x0F18, 0x0F48, SETTINGS_REGION_GENERAL},       // scan lists, AES key, F-lock
+    {0x0F50, 0x1BD0, SETTINGS_REGION_NAMES},
+    {0x1C00, 0x1D00, SETTINGS_REGION_CONTACTS},      // DTMF contacts
+    {0x1D00, 0x1E00, SETTINGS_REGION_CONTACTS},      // MDC contacts
+    {0x1EC0, 0x1F90, SETTINGS_REGION_CALIBRATION},
+    {0x1F90, 0x1FF8, SETTINGS_REGION_CONTACTS},      // MDC contacts (cont.)
+    {0x1FF8, 0x2000, SETTINGS_REGION_GENERAL | SETTINGS_REGION_CONTACTS},  // side keys, MDC count
+};
+
+uint8_t SETTINGS_RegionsForRange(uint32_t Address, uint32_t Size)
+{
+    uint8_t Regions = 0;
+
+    if (Size == 0)
+        return 0;
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(SETTINGS_RegionMap); i++) {
+        if (Address < SETTINGS_RegionMap[i].End && Address + Size > SETTINGS_RegionMap[i].Start)
+            Regions |= SETTINGS_RegionMap[i].Regions;
+    }
+
+    return Regions;
+}
+
+void SETTINGS_Reload(uint8_t Regions)
+{
+    if (Regions & SETTINGS_REGION_GENERAL) {
+        SETTINGS_LoadGeneral();
+        SETTINGS_LoadAesKey();
+    }
+#ifdef ENABLE_FMRADIO
+    if (Regions & SETTINGS_REGION_FM)
+        SETTINGS_LoadFM();
+#endif
+    if (Regions & SETTINGS_REGION_DTMF)
+        SETTINGS_LoadDTMF();
+    if (Regions & SETTINGS_REGION_ATTRIBUTES)
+        SETTINGS_LoadChannelAttributes();
+    if (Regions & SETTINGS_REGION_CALIBRATION)
+        SETTINGS_LoadCalibration();
+}
+
+void SETTINGS_InitEEPROM(void)
+{
+    SETTINGS_Reload(SETTINGS_REGION_GENERAL | SETTINGS_REGION_FM | SETTINGS_REGION_DTMF | SETTINGS_REGION_ATTRIBUTES);
+}
+
 void SETTINGS_LoadCalibration(void)
 {
 //	uint8_t Mic;
@@ -279,6 +279,22 @@ typedef struct {
 
 extern EEPROM_Config_t gEeprom;
 
+
+// Configuration areas of the logical EEPROM, used to reload only what a CPS
+// write actually touched.
+enum {
+    SETTINGS_REGION_CHANNELS    = 1U << 0,  // 0000..0D5F, read on demand; VFOs need reconfiguring
+    SETTINGS_REGION_ATTRIBUTES  = 1U << 1,  // 0D60..0E27
+    SETTINGS_REGION_FM          = 1U << 2,  // 0E40..0E6F, 0E88..0E8F
+    SETTINGS_REGION_GENERAL     = 1U << 3,  // 0E70..0ECF, 0F18..0F47, 1FF8..1FFF
+    SETTINGS_REGION_DTMF        = 1U << 4,  // 0ED0..0F17
+    SETTINGS_REGION_NAMES       = 1U << 5,  // 0F50..1BCF, read on demand
+    SETTINGS_REGION_CONTACTS    = 1U << 6,  // DTMF / MDC contacts, read on demand
+    SETTINGS_REGION_CALIBRATION = 1U << 7   // 1EC0..1F8F
+};
+
+uint8_t  SETTINGS_RegionsForRange(uint32_t Address, uint32_t Size);
+void     SETTINGS_Reload(uint8_t Regions);
 void     SETTINGS_InitEEPROM(void);
 void     SETTINGS_LoadCalibration(void);
 uint32_t SETTINGS_FetchChannelFrequency(const int channel);
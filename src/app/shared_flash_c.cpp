@@ -2,6 +2,14 @@
 
 #if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
 #include "../lib/shared_flash.h"
+#include "helper/trace.h"
+
+// 共享分区的擦除记进跟踪环
+extern "C" void shared_flash_erase_hook(size_t offset)
+{
+    (void)offset;
+    TRACE(FLASH_ERASE, 0, offset);
+}
 
 extern "C" bool shared_read_c(uint32_t offset, void *out, size_t len)
 {
@@ -13,6 +21,16 @@ extern "C" bool shared_write_c(uint32_t offset, const void *data, size_t len)
     return shared_write((size_t)offset, data, len);
 }
 
+extern "C" bool shared_erase_c(uint32_t offset, size_t len)
+{
+    return shared_erase((size_t)offset, len);
+}
+
+extern "C" bool shared_program_c(uint32_t offset, const void *data, size_t len)
+{
+    return shared_program((size_t)offset, data, len);
+}
+
 extern "C" uint32_t shared_size_c(void)
 {
     const esp_partition_t *p = shared_part();
@@ -31,6 +49,16 @@ extern "C" bool shared_write_c(uint32_t, const void *, size_t)
     return false;
 }
 
+extern "C" bool shared_erase_c(uint32_t, size_t)
+{
+    return false;
+}
+
+extern "C" bool shared_program_c(uint32_t, const void *, size_t)
+{
+    return false;
+}
+
 extern "C" uint32_t shared_size_c(void)
 {
     return 0U;
@@ -13,6 +13,12 @@ extern "C" {
 bool shared_read_c(uint32_t offset, void *out, size_t len);
 bool shared_write_c(uint32_t offset, const void *data, size_t len);
 
+// Erase whole 4KB sectors; offset and len must be sector aligned.
+bool shared_erase_c(uint32_t offset, size_t len);
+// Write into already-erased flash without the sector read-modify-write
+// (bits only go 1 -> 0), for append-only data.
+bool shared_program_c(uint32_t offset, const void *data, size_t len);
+
 // Returns the size (bytes) of the ESP32 "shared" partition.
 // Returns 0 if the partition can't be found.
 uint32_t shared_size_c(void);
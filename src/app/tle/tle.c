@@ -270,6 +270,7 @@ static inline void beijingToUtcTime(uint8_t t[6])
 
 static void TLE_SystemReset(void)
 {
+    EEPROM_MirrorFlush();
 #if defined(ARDUINO_ARCH_ESP32)
     esp_restart();
 #else
@@ -782,12 +783,12 @@ void drawcircle(uint8_t center_x, uint8_t center_y, uint8_t r) {
 }
 
 
-void Read_TLE(uint8_t num, sat_parm *now_sat) {
-    uint32_t base_add = 0x1E200 + num * 160;
-    char c[160];
-    EEPROM_ReadBuffer(base_add, c, 160);
-
+#define TLE_BASE_ADD     0x1E200
+#define TLE_RECORD_SIZE  160
+#define TLE_RECORD_NUM   45
+#define TLE_CHECK_BATCH  5   // tle_check() 每次批量读取的记录数
 
+static void TLE_ParseRecord(const char *c, sat_parm *now_sat) {
     memcpy(now_sat->name, c, 9); //卫星名字9B不包含结束0
     memcpy(now_sat->line1, c + 9, 69); //卫星TLE第一行 69B不包含结束0
     memcpy(now_sat->line2, c + 9 + 69, 69); //卫星TLE第二行 69B不包含结束0
@@ -802,14 +803,23 @@ void Read_TLE(uint8_t num, sat_parm *now_sat) {
     now_sat->name[9] = 0;
 }
 
+void Read_TLE(uint8_t num, sat_parm *now_sat) {
+    char c[TLE_RECORD_SIZE];
+    EEPROM_ReadBulk(TLE_BASE_ADD + num * TLE_RECORD_SIZE, c, TLE_RECORD_SIZE);
+    TLE_ParseRecord(c, now_sat);
+}
+
 uint8_t tle_check() {
     sate_info.num = 0;
     sat_parm now_sat;
+    char c[TLE_CHECK_BATCH * TLE_RECORD_SIZE];
     int cnt_num = 0;
-    for (int i = 0; i < 45; i++) {
+    for (int i = 0; i < TLE_RECORD_NUM; i++) {
         cnt_num = i;
 
-        Read_TLE(i, &now_sat);
+        if (i % TLE_CHECK_BATCH == 0)
+            EEPROM_ReadBulk(TLE_BASE_ADD + i * TLE_RECORD_SIZE, c, sizeof(c));
+        TLE_ParseRecord(c + (i % TLE_CHECK_BATCH) * TLE_RECORD_SIZE, &now_sat);
 
         tle_data data;
         uint8_t judge = tle_parse(now_sat.name, now_sat.line1, now_sat.line2, &data);
@@ -832,7 +842,7 @@ void SELECT_DISPLAY() {
         if (show_num > sate_info.num)
             break;
         char str1[14];
-        EEPROM_ReadBuffer(0x1e200 + 160 * (sate_info.list[show_num - 1]), str1, 9);
+        EEPROM_ReadBulk(TLE_BASE_ADD + TLE_RECORD_SIZE * (sate_info.list[show_num - 1]), str1, 9);
         str1[9] = 0;
         sprintf(str, "%02d.%s", show_num, str1);
         UI_PrintStringSmall(str, 8, 0, i);
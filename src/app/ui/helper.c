@@ -21,6 +21,7 @@
 #include "menu.h"
 #include "helper.h"
 #include "inputbox.h"
+#include "../helper/profiler.h"
 #include "../misc.h"
 #include "../chinese.h"
 #include "../font_blob.h"
@@ -122,6 +123,7 @@ void UI_GenerateChannelStringEx(char *pString, const bool bShowPrefix, const uin
 //}
 
 void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_t Line) {
+    PROFILER_ZONE(PRINT_SMALL);
 
 #ifdef ENABLE_ENGLISH
     const size_t Length = strlen(pString);
@@ -147,7 +147,7 @@ void UI_DisplayLock(void)
             gKeyReading0     = Key;
         }
 #ifdef ENABLE_UART
-        if (UART_IsCommandAvailable())
+        for (unsigned int frames = 0; frames < UART_MAX_FRAMES_PER_POLL && UART_IsCommandAvailable(); frames++)
         {
             __disable_irq();
             UART_HandleCommand();
@@ -22,6 +22,7 @@
 #include "../app/dtmf.h"
 #include "../font.h"
 #include "../app/chFrScanner.h"
+#include "../app/radiotask.h"
 
 #ifdef ENABLE_AM_FIX
 #include "../am_fix.h"
@@ -156,7 +157,9 @@ void UI_DisplayAudioBar(void) {
     if (gAlarmState != ALARM_STATE_OFF)
         return;
 #endif
-    const unsigned int voice_amp = BK4819_GetVoiceAmplitudeOut();  // 15:0
+    RADIOTASK_Snapshot_t snapshot;
+    RADIOTASK_ReadSnapshot(&snapshot);
+    const unsigned int voice_amp = snapshot.AfLevel;  // 15:0
 
     // make non-linear to make more sensitive at low values
     const unsigned int level = MIN(voice_amp * 8, 65535u);
@@ -227,13 +230,16 @@ void DisplayRSSIBar(const bool now) {
     }
 
 
+    RADIOTASK_Snapshot_t snapshot;
+    RADIOTASK_ReadSnapshot(&snapshot);
+
     const int16_t s0_dBm = -gEeprom.S0_LEVEL; // S0 .. base level
     const int16_t rssi_dBm =
-        BK4819_GetRSSI_dBm()
+        (int16_t)(snapshot.Rssi / 2) - 160    // 同 BK4819_GetRSSI_dBm()
 #ifdef ENABLE_AM_FIX
         + ((gSetting_AM_fix && gRxVfo->Modulation == MODULATION_AM) ? AM_fix_get_gain_diff() : 0)
 #endif
-        + dBmCorrTable[gRxVfo->Band];
+        + dBmCorrTable[snapshot.Band];        // 采样时的波段，双守切换后不会配错
 
     int s0_9 = gEeprom.S0_LEVEL - gEeprom.S9_LEVEL;
     const uint8_t s_level = MIN(MAX((int32_t)(rssi_dBm - s0_dBm)*100 / (s0_9*100/9), 0), 9); // S0 - S9
@@ -251,17 +257,20 @@ void DisplayRSSIBar(const bool now) {
     if (now)
         ST7565_BlitLine(line);
 #else
-    int16_t rssi = BK4819_GetRSSI();
+    RADIOTASK_Snapshot_t snapshot;
+    RADIOTASK_ReadSnapshot(&snapshot);
+    int16_t rssi = snapshot.Rssi;
+    const uint8_t band = snapshot.Band;   // 采样时的波段
 
     uint8_t Level;
 
-    if (rssi >= gEEPROM_RSSI_CALIB[gRxVfo->Band][3]) {
+    if (rssi >= gEEPROM_RSSI_CALIB[band][3]) {
         Level = 6;
-    } else if (rssi >= gEEPROM_RSSI_CALIB[gRxVfo->Band][2]) {
+    } else if (rssi >= gEEPROM_RSSI_CALIB[band][2]) {
         Level = 4;
-    } else if (rssi >= gEEPROM_RSSI_CALIB[gRxVfo->Band][1]) {
+    } else if (rssi >= gEEPROM_RSSI_CALIB[band][1]) {
         Level = 2;
-    } else if (rssi >= gEEPROM_RSSI_CALIB[gRxVfo->Band][0]) {
+    } else if (rssi >= gEEPROM_RSSI_CALIB[band][0]) {
         Level = 1;
     } else {
         Level = 0;
@@ -62,6 +62,10 @@ void UI_DisplayScanner(void) {
         pPrintStr = String;
     }
     UI_PrintStringSmall(pPrintStr, 2, 0, 3);
+    if (gScanCssState == SCAN_CSS_STATE_FOUND && gScanUseCssResult && gScanCssDetectMs) {
+        sprintf(String, "%ums", gScanCssDetectMs);
+        GUI_DisplaySmallest(String, 127 - 4 * strlen(String), 33, false, true);
+    }
     memset(String, 0, sizeof(String));
 
     if (gScannerSaveState == SCAN_SAVE_CHANNEL) {
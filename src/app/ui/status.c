@@ -29,6 +29,7 @@
 #include "../app/fm.h"
 #endif
 
+#include "../app/radiotask.h"
 #include "../app/scanner.h"
 #include "../bitmaps.h"
 #include "../driver/keyboard.h"
@@ -43,6 +44,10 @@
 #include "status.h"
 
 void UI_DisplayStatus() {
+    if (RADIOTASK_IsCurrent()) {
+        gUpdateStatus = true;
+        return;
+    }
     gUpdateStatus = false;
 #ifdef ENABLE_ARDUBOY
     if (gScreenToDisplay == DISPLAY_ARDUBOY)
@@ -23,12 +23,14 @@
 
 #include "app/chFrScanner.h"
 #include "app/dtmf.h"
+#include "app/radiotask.h"
 
 #ifdef ENABLE_FMRADIO
 #include "app/fm.h"
 #endif
 
 #include "driver/keyboard.h"
+#include "helper/profiler.h"
 #include "misc.h"
 
 #ifdef ENABLE_AIRCOPY
@@ -89,6 +91,12 @@ _Static_assert(ARRAY_SIZE(UI_DisplayFunctions) == DISPLAY_N_ELEM,""
               "UI_DisplayFunctions size mismatch with GUI_DisplayType_t enum");
 
 void GUI_DisplayScreen(void) {
+    // 电台任务只置标志，由主循环画，免得等屏幕
+    if (RADIOTASK_IsCurrent()) {
+        gUpdateDisplay = true;
+        return;
+    }
+    PROFILER_ZONE(DISPLAY);
     if (gScreenToDisplay != DISPLAY_INVALID) {
         UI_DisplayFunctions[gScreenToDisplay]();
     }
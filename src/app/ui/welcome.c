@@ -27,38 +27,11 @@
 #include "../version.h"
 #include "../driver/system.h"
 
-#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
-#include "../shared_flash_c.h"
-#endif
-
-static void Welcome_ReadBuffer(uint32_t address, void *buffer, uint8_t size)
+// The welcome window [0x02000..0x02FFF] is mapped onto the shared partition
+// by the EEPROM driver, so plain bulk reads land in the right place.
+static void Welcome_ReadBuffer(uint32_t address, void *buffer, uint32_t size)
 {
-#if defined(ARDUINO_ARCH_ESP32) && !defined(ENABLE_OPENCV)
-    // Map the welcome resources from the radio's logical EEPROM window
-    // [0x02000..0x02FFF] into ESP32's shared partition (use the first 4KB).
-    const uint32_t max = shared_size_c();
-    const uint32_t window = (max > 0x1000U) ? 0x1000U : max;
-    if (window > 0U && address >= 0x02000) {
-        const uint32_t off = address - 0x02000U;
-        if (off < window) {
-            uint32_t rd = (uint32_t)size;
-            if (rd > (window - off)) {
-                rd = (window - off);
-            }
-            if (rd > 0U && !shared_read_c(off, buffer, (size_t)rd)) {
-                memset(buffer, 0, (size_t)rd);
-            }
-            if (rd < (uint32_t)size) {
-                memset((uint8_t *)buffer + rd, 0, (size_t)((uint32_t)size - rd));
-            }
-            return;
-        }
-    }
-
-    EEPROM_ReadBuffer(address, buffer, size);
-#else
-    EEPROM_ReadBuffer(address, buffer, size);
-#endif
+    EEPROM_ReadBulk(address, buffer, size);
 }
 
 
@@ -92,10 +65,11 @@ void UI_DisplayWelcome(void) {
     }
     else if (gEeprom.POWER_ON_DISPLAY_MODE == POWER_ON_DISPLAY_MODE_PIC)
     {
-        Welcome_ReadBuffer(0x02080, gStatusLine, 128);
-        for (int i = 0; i < 7; ++i) {
-            Welcome_ReadBuffer(0x02080 + 128 + 128 * i, &gFrameBuffer[i], 128);
-        }
+        const EEPROM_Segment_t picture[] = {
+                {0x02080,       gStatusLine,  128},
+                {0x02080 + 128, gFrameBuffer, 128 * 7},
+        };
+        EEPROM_ReadSegments(picture, ARRAY_SIZE(picture));
     }
 
 #elif ENABLE_CHINESE_FULL == 0
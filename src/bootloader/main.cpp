@@ -6,6 +6,13 @@
 #include <base64.h>
 #include "esp_ota_ops.h"
 #include "esp_partition.h"
+#include "esp_image_format.h"
+#include "esp_flash_partitions.h"
+#include "esp_rom_crc.h"
+#include "esp_rom_sys.h"
+#include "driver/gpio.h"
+#include "nvs.h"
+#include <Preferences.h>
 #include <WiFi.h>
 #include "esp_wifi.h"
 #include "../app/driver/st7565.h"
@@ -17,6 +24,12 @@ static constexpr int UART0_TX_PIN = 43;
 static constexpr int UART0_RX_PIN = 44;
 static constexpr uint32_t UART0_FLASH_BAUD = 115200;
 
+// 原生 USB（HWCDC，即 Serial）也可以跑同一套烧录协议：两个口同时发 READY，
+// 先回 GO 的口成为本次会话的传输口。USB 全速不受波特率限制，允许更大的分块。
+#if ARDUINO_USB_MODE && ARDUINO_USB_CDC_ON_BOOT
+#define BL_USB_FLASH 1
+#endif
+
 // LCD backlight (simple always-on for bootloader UI)
 static constexpr int BACKLIGHT_IO = 8;
 
@@ -259,6 +272,232 @@ static void jump_to_app0_and_restart()
     esp_ota_set_boot_partition(app0);
   esp_restart();
 }
+
+// ---- CRC32 (0xEDB88320) ----
+static uint32_t crc32_update(uint32_t crc, const uint8_t *d, size_t n)
+{
+  crc = ~crc;
+  while (n--)
+  {
+    crc ^= *d++;
+    for (int i = 0; i < 8; ++i)
+      crc = (crc >> 1) ^ (0xEDB88320u & (-(int32_t)(crc & 1)));
+  }
+  return ~crc;
+}
+
+// ====== 断点续传：进度记录（NVS 命名空间 "upd"）======
+// rec : UpdProgress，镜像标识 + 已连续校验的偏移
+// crc : 每个 4KB 块的 CRC32（仅 [0, verified) 部分）
+// 每写满 PROG_SAVE_BLOCKS 块保存一次；续传前先把 flash 上的已写块与记录的
+// CRC 逐块比对，遇到第一个不一致的块就从那里重新开始。
+static const uint32_t PROG_MAGIC = 0x47525055;  // 'U''P''R''G' 小端
+static const uint32_t PROG_BLOCK = 4096;        // = flash 扇区，按块擦除
+static const uint32_t PROG_SAVE_BLOCKS = 16;    // 每 64KB 落盘一次
+static const uint32_t PROG_ERASE_BIG = 65536;   // 对齐时按 64KB 块擦除，比 16 次扇区擦除快得多
+static const uint32_t PROG_MAX_BLOCKS = (3 * 1024 * 1024) / PROG_BLOCK;
+
+enum UpdSource : uint8_t
+{
+  UPD_SRC_UART = 1
+};
+
+struct UpdProgress
+{
+  uint32_t magic;
+  uint8_t source;     // UpdSource
+  uint8_t reserved[3];
+  uint32_t total;     // 镜像总长
+  uint32_t verified;  // 已连续写入并校验的字节数（PROG_BLOCK 的整数倍，或 total）
+  uint8_t id[32];     // 主机给的镜像 SHA-256
+};
+
+struct FwWriter
+{
+  const esp_partition_t *part;
+  UpdProgress rec;
+  uint32_t *crcs;     // PROG_MAX_BLOCKS 项
+  uint32_t offset;    // 下一个要写的字节
+  uint32_t erased;    // [0, erased) 已擦除
+  uint32_t blockCrc;  // 当前块的累计 CRC
+  uint32_t unsaved;   // 上次落盘后新完成的块数
+  bool resumable;     // 无镜像标识（旧 UPD2 主机）时不记录进度
+};
+
+static bool prog_load(UpdProgress &rec, uint32_t *crcs)
+{
+  Preferences prefs;
+  if (!prefs.begin("upd", true))
+    return false;
+  bool ok = prefs.getBytes("rec", &rec, sizeof(rec)) == sizeof(rec) && rec.magic == PROG_MAGIC &&
+            rec.total <= PROG_MAX_BLOCKS * PROG_BLOCK && rec.verified <= rec.total;
+  if (ok && crcs)
+  {
+    const size_t n = (rec.verified + PROG_BLOCK - 1) / PROG_BLOCK;
+    // CRC 先于记录落盘，可能比记录多出几块
+    ok = prefs.getBytes("crc", crcs, PROG_MAX_BLOCKS * sizeof(uint32_t)) >= n * sizeof(uint32_t);
+  }
+  prefs.end();
+  return ok;
+}
+
+static void prog_save(const FwWriter &w)
+{
+  if (!w.resumable)
+    return;
+  Preferences prefs;
+  if (!prefs.begin("upd", false))
+    return;
+  const size_t n = (w.rec.verified + PROG_BLOCK - 1) / PROG_BLOCK;
+  // 先写 CRC 再写记录：中途掉电时记录只会落后，不会指向不存在的 CRC
+  if (n)
+    prefs.putBytes("crc", w.crcs, n * sizeof(uint32_t));
+  prefs.putBytes("rec", &w.rec, sizeof(w.rec));
+  // 开机快速通道只读这一个字节
+  prefs.putUChar("pend", w.rec.verified < w.rec.total ? w.rec.source : 0);
+  prefs.end();
+}
+
+static void prog_clear()
+{
+  Preferences prefs;
+  if (prefs.begin("upd", false))
+  {
+    prefs.clear();
+    prefs.end();
+  }
+}
+
+// 从 flash 回读 [0, verified)，逐块比对记录的 CRC，返回仍然可信的长度
+static uint32_t prog_check_flash(const esp_partition_t *part, const UpdProgress &rec, const uint32_t *crcs)
+{
+  uint8_t *buf = (uint8_t *)malloc(PROG_BLOCK);
+  if (!buf)
+    return 0;
+  uint32_t good = 0;
+  while (good < rec.verified)
+  {
+    const uint32_t n = (rec.verified - good) < PROG_BLOCK ? (rec.verified - good) : PROG_BLOCK;
+    if (esp_partition_read(part, good, buf, n) != ESP_OK || crc32_update(0, buf, n) != crcs[good / PROG_BLOCK])
+      break;
+    good += n;
+    lcd_update_throttled("UVE5 BL", "VERIFY", (int)((good * 100ULL) / rec.verified));
+  }
+  free(buf);
+  return good;
+}
+
+// 打开写入器。id 为 NULL 表示不可续传（整包重写，且不记录进度）。
+// 返回后 w.offset 即续传起点（0 = 从头开始）。
+static bool fw_writer_begin(FwWriter &w, uint32_t total, const uint8_t *id, uint8_t source)
+{
+  memset(&w, 0, sizeof(w));
+  w.part = find_app0();
+  if (!w.part || total < 16 || total > w.part->size || total > PROG_MAX_BLOCKS * PROG_BLOCK)
+    return false;
+  w.crcs = (uint32_t *)calloc(PROG_MAX_BLOCKS, sizeof(uint32_t));
+  if (!w.crcs)
+    return false;
+  w.resumable = id != NULL;
+
+  if (w.resumable && prog_load(w.rec, w.crcs) && w.rec.source == source && w.rec.total == total &&
+      memcmp(w.rec.id, id, sizeof(w.rec.id)) == 0)
+  {
+    const uint32_t good = prog_check_flash(w.part, w.rec, w.crcs);
+    if (good != w.rec.verified)
+    {
+      w.rec.verified = good;
+      prog_save(w);
+    }
+  }
+  else
+  {
+    memset(&w.rec, 0, sizeof(w.rec));
+    w.rec.magic = PROG_MAGIC;
+    w.rec.source = source;
+    w.rec.total = total;
+    if (id)
+      memcpy(w.rec.id, id, sizeof(w.rec.id));
+    // 旧记录描述的是另一个镜像，先作废再开始擦写
+    prog_clear();
+    prog_save(w);
+  }
+
+  w.offset = w.rec.verified;
+  w.erased = w.offset;
+  return true;
+}
+
+static bool fw_writer_write(FwWriter &w, const uint8_t *data, size_t len)
+{
+  if (len > w.rec.total - w.offset)
+    return false;
+  // 与 esp_ota_write 相同的镜像头检查
+  if (w.offset == 0 && data[0] != ESP_IMAGE_HEADER_MAGIC)
+    return false;
+
+  while (w.erased < w.offset + len)
+  {
+    const uint32_t step = (w.erased % PROG_ERASE_BIG == 0 && w.erased + PROG_ERASE_BIG <= w.part->size)
+                              ? PROG_ERASE_BIG
+                              : PROG_BLOCK;
+    if (esp_partition_erase_range(w.part, w.erased, step) != ESP_OK)
+      return false;
+    w.erased += step;
+  }
+  if (esp_partition_write(w.part, w.offset, data, len) != ESP_OK)
+    return false;
+
+  // 块 CRC 按 PROG_BLOCK 边界切分，和传输分块大小无关
+  while (len)
+  {
+    const uint32_t room = PROG_BLOCK - (w.offset % PROG_BLOCK);
+    const uint32_t n = len < room ? len : room;
+    w.blockCrc = crc32_update(w.blockCrc, data, n);
+    w.offset += n;
+    data += n;
+    len -= n;
+    if (w.offset % PROG_BLOCK == 0 || w.offset == w.rec.total)
+    {
+      w.crcs[(w.offset - 1) / PROG_BLOCK] = w.blockCrc;
+      w.blockCrc = 0;
+      w.rec.verified = w.offset;
+      if (++w.unsaved >= PROG_SAVE_BLOCKS)
+      {
+        prog_save(w);
+        w.unsaved = 0;
+      }
+    }
+  }
+  return true;
+}
+
+static void fw_writer_abort(FwWriter &w)
+{
+  if (w.unsaved)
+    prog_save(w);
+  free(w.crcs);
+  w.crcs = NULL;
+}
+
+// 全部写完：校验镜像并设为启动分区。无论成败进度都作废——
+// 校验失败说明镜像本身有问题，续传也没有意义。
+static esp_err_t fw_writer_finish(FwWriter &w)
+{
+  const esp_err_t err = esp_ota_set_boot_partition(w.part);
+  prog_clear();
+  free(w.crcs);
+  w.crcs = NULL;
+  return err;
+}
+
+// app0 是否停在一次未完成的串口更新中间
+static bool prog_uart_pending()
+{
+  UpdProgress rec;
+  return prog_load(rec, NULL) && rec.source == UPD_SRC_UART && rec.verified < rec.total;
+}
+
 void connectToWiFi()
 {
   WiFi.mode(WIFI_STA);
@@ -448,7 +687,14 @@ static const uint32_t MAX_FW_SIZE = 3 * 1024 * 1024; // 最大镜像大小（防
 // =================================
 
 static const uint32_t MAGIC = 0x32445055; // 'U''P''D''2' 小端
+// 可续传的头：MAGIC_RESUME + total + chunk + SHA-256(镜像)。设备回 "STRT <offset>"，
+// 主机从 offset 起重新编号（seq 仍从 0 开始）发送剩余部分。
+static const uint32_t MAGIC_RESUME = 0x52445055; // 'U''P''D''R' 小端
 static const size_t MAX_CHUNK = 2048;     // 允许的最大单块（PC端可 <= 这个值）
+static const size_t USB_MAX_CHUNK = 16384; // USB CDC 会话允许的最大单块
+static const size_t USB_RX_BUF = 32768;    // HWCDC 接收队列，默认 256 字节装不下一个分块
+static const size_t UART_RX_BUF = 4096;
+static const uint32_t UPD_IDLE_ABORT_MS = 20000; // 传输中主机静默超过此时长即结束会话
 
 // ===== 键盘矩阵：按住 MENU 开机进入串口烧录 =====
 // 来自主固件的键盘定义：
@@ -510,19 +756,6 @@ enum Err : uint8_t
   E_TIMEOUT = 7
 };
 
-// ---- CRC32 (0xEDB88320) ----
-static uint32_t crc32_update(uint32_t crc, const uint8_t *d, size_t n)
-{
-  crc = ~crc;
-  while (n--)
-  {
-    crc ^= *d++;
-    for (int i = 0; i < 8; ++i)
-      crc = (crc >> 1) ^ (0xEDB88320u & (-(int32_t)(crc & 1)));
-  }
-  return ~crc;
-}
-
 // ---- 串口辅助 ----
 static void drain_input(Stream &s, uint32_t quiet_ms = 20, uint32_t max_ms = 150)
 {
@@ -568,52 +801,187 @@ static void wait_serial_ready(Stream &s, uint32_t max_wait_ms = 10000)
   drain_input(s, 30, 200);
 }
 
-// 设备端循环发 READY，直到收到 GO（大小写/CRLF 都接受）
-static bool wait_go(Stream &s, uint32_t max_wait_ms = 60000)
+// 回复 STAT：PROG <total> <verified> <sha256hex>，无记录时 PROG NONE
+static void report_progress(Stream &s)
 {
-  wait_serial_ready(s);
+  UpdProgress rec;
+  if (!prog_load(rec, NULL) || rec.source != UPD_SRC_UART)
+  {
+    s.println("PROG NONE");
+    return;
+  }
+  char hex[65];
+  for (size_t i = 0; i < sizeof(rec.id); i++)
+    snprintf(&hex[i * 2], 3, "%02x", rec.id[i]);
+  s.printf("PROG %u %u %s\n", (unsigned)rec.total, (unsigned)rec.verified, hex);
+}
+
+// 设备端在所有口上循环发 READY，直到某个口收到 GO（大小写/CRLF 都接受），
+// 返回该口；期间收到 STAT 则在同一个口回报续传进度，继续等待 GO
+static Stream *wait_go(Stream *const *ports, size_t n, uint32_t max_wait_ms = 60000)
+{
+  for (size_t i = 0; i < n; i++)
+    wait_serial_ready(*ports[i]);
   uint32_t last = 0, start = millis();
   String line;
   while (true)
   {
     lcd_update_throttled("UVE5 BL", "WAIT GO", 0);
-    if (millis() - last > 300)
-    {
-      s.println("READY");
-      s.flush();
+    const bool announce = millis() - last > 300;
+    if (announce)
       last = millis();
-    }
-    if (s.available())
+    for (size_t i = 0; i < n; i++)
     {
-      line = s.readStringUntil('\n');
-      line.trim();
-      line.toUpperCase();
-      if (line == "GO")
-        return true;
+      Stream &s = *ports[i];
+      if (announce)
+      {
+        s.println("READY");
+        s.flush();
+      }
+      if (s.available())
+      {
+        line = s.readStringUntil('\n');
+        line.trim();
+        line.toUpperCase();
+        if (line == "GO")
+          return &s;
+        if (line == "STAT")
+          report_progress(s);
+      }
     }
     delay(5);
   }
 }
 
+// ---- 双缓冲写入 ----
+// 主循环校验完 CRC 就把缓冲交给写入任务并 ACK，自己去收下一块；
+// flash 擦写（尤其是擦除）与传输重叠。写入失败在下一次取缓冲时报告。
+struct WriteJob
+{
+  uint8_t *buf;
+  uint16_t len;  // 0 = 结束
+};
+
+struct WritePipe
+{
+  FwWriter *w;
+  QueueHandle_t full;      // 待写的 WriteJob
+  QueueHandle_t idle;      // 空闲缓冲
+  SemaphoreHandle_t done;  // 写入任务退出
+  uint8_t *bufs[2];
+  volatile bool failed;
+};
+
+static void write_task(void *arg)
+{
+  WritePipe *p = (WritePipe *)arg;
+  WriteJob job;
+  while (xQueueReceive(p->full, &job, portMAX_DELAY) == pdTRUE && job.len)
+  {
+    if (!p->failed && !fw_writer_write(*p->w, job.buf, job.len))
+      p->failed = true;
+    xQueueSend(p->idle, &job.buf, portMAX_DELAY);
+  }
+  xSemaphoreGive(p->done);
+  vTaskDelete(NULL);
+}
+
+static void pipe_release(WritePipe &p)
+{
+  if (p.full)
+    vQueueDelete(p.full);
+  if (p.idle)
+    vQueueDelete(p.idle);
+  if (p.done)
+    vSemaphoreDelete(p.done);
+  free(p.bufs[0]);
+  free(p.bufs[1]);
+  memset(&p, 0, sizeof(p));
+}
+
+static bool pipe_begin(WritePipe &p, FwWriter &w, size_t chunk)
+{
+  memset(&p, 0, sizeof(p));
+  p.w = &w;
+  p.full = xQueueCreate(2, sizeof(WriteJob));
+  p.idle = xQueueCreate(2, sizeof(uint8_t *));
+  p.done = xSemaphoreCreateBinary();
+  p.bufs[0] = (uint8_t *)malloc(chunk);
+  p.bufs[1] = (uint8_t *)malloc(chunk);
+  if (!p.full || !p.idle || !p.done || !p.bufs[0] || !p.bufs[1])
+  {
+    pipe_release(p);
+    return false;
+  }
+  xQueueSend(p.idle, &p.bufs[0], 0);
+  xQueueSend(p.idle, &p.bufs[1], 0);
+  // loopTask 在核 1 收数据，写入放到核 0（串口烧录时 WiFi 未启动）
+  if (xTaskCreatePinnedToCore(write_task, "fw_write", 6144, &p, 2, NULL, 0) != pdPASS)
+  {
+    pipe_release(p);
+    return false;
+  }
+  return true;
+}
+
+// 取一个空闲缓冲；两个都在写时阻塞，直到写入任务让出一个
+static uint8_t *pipe_acquire(WritePipe &p)
+{
+  uint8_t *buf = NULL;
+  xQueueReceive(p.idle, &buf, portMAX_DELAY);
+  return buf;
+}
+
+static void pipe_submit(WritePipe &p, uint8_t *buf, uint16_t len)
+{
+  const WriteJob job = {buf, len};
+  xQueueSend(p.full, &job, portMAX_DELAY);
+}
+
+// 等已提交的块全部写完再收尾，返回是否全部写入成功
+static bool pipe_end(WritePipe &p)
+{
+  const WriteJob stop = {NULL, 0};
+  xQueueSend(p.full, &stop, portMAX_DELAY);
+  xSemaphoreTake(p.done, portMAX_DELAY);
+  const bool ok = !p.failed;
+  pipe_release(p);
+  return ok;
+}
+
 // ====== 核心流程：握手 + 头 + 擦除 + START + 分块 + ACK/NAK ======
-static bool receive_and_flash_app0(Stream &s)
+static bool receive_and_flash_app0()
 {
   lcd_init_once();
-  lcd_update_throttled("UVE5 BL", "UART MODE", 0);
-
-  if (!wait_go(s, 60000))
+  lcd_update_throttled("UVE5 BL", "WAIT GO", 0);
+
+  // Flash over UART0 (GPIO43/44) or native USB, whichever host says GO first.
+#ifdef BL_USB_FLASH
+  Stream *const ports[] = {&Uart0, &Serial};
+#else
+  Stream *const ports[] = {&Uart0};
+#endif
+  Stream *picked = wait_go(ports, sizeof(ports) / sizeof(ports[0]), 60000);
+  if (!picked)
   {
-    s.println("ERR: no GO");
     lcd_update_throttled("UVE5 BL", "ERR NO GO", 0);
     return false;
   }
+  Stream &s = *picked;
+#ifdef BL_USB_FLASH
+  const bool usb = picked == (Stream *)&Serial;
+#else
+  const bool usb = false;
+#endif
+  const size_t maxChunk = usb ? USB_MAX_CHUNK : MAX_CHUNK;
 
-  lcd_update_throttled("UVE5 BL", "HDR", 0);
+  lcd_update_throttled("UVE5 BL", usb ? "USB HDR" : "UART HDR", 0);
 
-  // 头：MAGIC + total + chunk
+  // 头：MAGIC + total + chunk [+ SHA-256]
   uint32_t magic = 0, total = 0;
   uint16_t chunk = 0;
-  if (!read_exact(s, (uint8_t *)&magic, 4, 10000) || magic != MAGIC)
+  uint8_t id[32];
+  if (!read_exact(s, (uint8_t *)&magic, 4, 10000) || (magic != MAGIC && magic != MAGIC_RESUME))
   {
     s.println("ERR: magic");
     lcd_update_throttled("UVE5 BL", "ERR MAGIC", 0);
@@ -625,12 +993,19 @@ static bool receive_and_flash_app0(Stream &s)
     lcd_update_throttled("UVE5 BL", "ERR SIZE", 0);
     return false;
   }
-  if (!read_exact(s, (uint8_t *)&chunk, 2, 5000) || chunk == 0 || chunk > MAX_CHUNK)
+  if (!read_exact(s, (uint8_t *)&chunk, 2, 5000) || chunk == 0 || chunk > maxChunk)
   {
     s.println("ERR: chunk");
     lcd_update_throttled("UVE5 BL", "ERR CHUNK", 0);
     return false;
   }
+  const bool resumable = magic == MAGIC_RESUME;
+  if (resumable && !read_exact(s, id, sizeof(id), 5000))
+  {
+    s.println("ERR: hash");
+    lcd_update_throttled("UVE5 BL", "ERR HASH", 0);
+    return false;
+  }
 
   const esp_partition_t *part = find_app0();
   if (!part)
@@ -646,26 +1021,30 @@ static bool receive_and_flash_app0(Stream &s)
     return false;
   }
 
-  // 擦除需要的区域（可能耗时数秒）
-  esp_ota_handle_t h = 0;
-  lcd_update_throttled("UVE5 BL", "ERASE", 0);
-  if (esp_ota_begin(part, total, &h) != ESP_OK)
+  // 续传时先回读校验已写部分；扇区在写入前才逐个擦除
+  FwWriter w;
+  lcd_update_throttled("UVE5 BL", resumable ? "VERIFY" : "ERASE", 0);
+  if (!fw_writer_begin(w, total, resumable ? id : NULL, UPD_SRC_UART))
   {
     s.println("ERR: begin");
     lcd_update_throttled("UVE5 BL", "ERR BEGIN", 0);
     return false;
   }
 
-  // 擦除完成 → 告知 PC 可以发第 0 块
+  // 准备完成 → 告知 PC 可以发第 0 块
   // 用 "STRT" 避免包含 'A'/'E' 字节，防止主机误判 ACK/NAK。
   // 并在首包到来前重复发送，降低主机漏读导致的卡死概率。
+  // 可续传的会话附带续传起点：“STRT <offset>”。
   uint32_t lastStartMs = 0;
   const uint32_t startAnnounceBegin = millis();
   while (!s.available() && (millis() - startAnnounceBegin) < 5000)
   {
     if (millis() - lastStartMs > 300)
     {
-      s.println("STRT");
+      if (resumable)
+        s.printf("STRT %u\n", (unsigned)w.offset);
+      else
+        s.println("STRT");
       s.flush();
       lastStartMs = millis();
     }
@@ -676,30 +1055,48 @@ static bool receive_and_flash_app0(Stream &s)
   // Draining here can accidentally consume the beginning of chunk0 and cause
   // a predictable first-chunk retry (E_TIMEOUT / E_SEQ_HDR).
 
-  lcd_update_throttled("UVE5 BL", "WRITE", 0);
+  lcd_update_throttled("UVE5 BL", "WRITE", (int)((w.offset * 100ULL) / total));
 
-  uint8_t *buf = (uint8_t *)malloc(chunk);
-  if (!buf)
+  WritePipe pipe;
+  if (!pipe_begin(pipe, w, chunk))
   {
     s.println("ERR: malloc");
-    esp_ota_end(h);
+    fw_writer_abort(w);
     return false;
   }
 
-  uint32_t expect_seq = 0, written = 0;
+  // w.offset 归写入任务所有；这里只统计已收到并交付写入的字节
+  uint32_t received = w.offset;
+  uint32_t expect_seq = 0;
   int lastPct = -1;
+  uint8_t *buf = NULL;
 
-  while (written < total)
+  while (received < total)
   {
     uint32_t seq = 0, crc_rx = 0;
     uint16_t len = 0;
 
-    if (!read_exact(s, (uint8_t *)&seq, 4, 20000))
+    if (!buf)
     {
-      s.write('E');
-      s.write((uint8_t)E_SEQ_HDR);
-      drain_input(s);
-      continue;
+      buf = pipe_acquire(pipe);
+      if (pipe.failed)
+      {
+        pipe_end(pipe);
+        fw_writer_abort(w);
+        s.println("ERR: write");
+        lcd_update_throttled("UVE5 BL", "ERR WRITE", (int)((w.offset * 100ULL) / total));
+        return false;
+      }
+    }
+
+    // 主机长时间无数据：结束会话并保存进度，回到 READY 等待重连续传
+    if (!read_exact(s, (uint8_t *)&seq, 4, UPD_IDLE_ABORT_MS))
+    {
+      pipe_end(pipe);
+      fw_writer_abort(w);
+      s.println("ERR: idle");
+      lcd_update_throttled("UVE5 BL", "ERR IDLE", (int)((w.offset * 100ULL) / total));
+      return false;
     }
     if (!read_exact(s, (uint8_t *)&len, 2, 20000) || len == 0 || len > chunk)
     {
@@ -708,7 +1105,7 @@ static bool receive_and_flash_app0(Stream &s)
       drain_input(s);
       continue;
     }
-    if ((uint32_t)len > total - written)
+    if ((uint32_t)len > total - received)
     {
       s.write('E');
       s.write((uint8_t)E_OVER);
@@ -754,18 +1151,13 @@ static bool receive_and_flash_app0(Stream &s)
       continue;
     }
 
-    if (esp_ota_write(h, buf, len) != ESP_OK)
-    {
-      s.write('E');
-      s.write((uint8_t)E_WRITE);
-      drain_input(s);
-      continue;
-    }
-
-    written += len;
+    // ACK 表示已收妥并排队写入；真正的写入错误在下一块取缓冲时报告并结束会话
+    pipe_submit(pipe, buf, len);
+    buf = NULL;
+    received += len;
     expect_seq++;
 
-    const int pct = (int)((written * 100ULL) / total);
+    const int pct = (int)((received * 100ULL) / total);
     if (pct != lastPct)
     {
       lcd_update_throttled("UVE5 BL", "WRITE", pct);
@@ -776,15 +1168,15 @@ static bool receive_and_flash_app0(Stream &s)
     delay(0);
   }
 
-  free(buf);
-
-  if (esp_ota_end(h) != ESP_OK)
+  if (!pipe_end(pipe))
   {
-    s.println("ERR: end");
-    lcd_update_throttled("UVE5 BL", "ERR END", 100);
+    fw_writer_abort(w);
+    s.println("ERR: write");
+    lcd_update_throttled("UVE5 BL", "ERR WRITE", (int)((w.offset * 100ULL) / total));
     return false;
   }
-  if (esp_ota_set_boot_partition(part) != ESP_OK)
+
+  if (fw_writer_finish(w) != ESP_OK)
   {
     s.println("ERR: set");
     lcd_update_throttled("UVE5 BL", "ERR SET", 100);
@@ -811,24 +1203,132 @@ void disableAMPDU()
   esp_wifi_deinit();
   esp_wifi_init(&cfg);
 }
+// ====== 开机快速通道 ======
+// 每次开机都先进 factory（app 启动时会把 otadata 擦掉）。没按 MENU、也没有
+// 未完成的串口更新时，什么都不初始化，几十微秒内把 otadata 指向 app0 并重启。
+static bool gApp0Rejected = false;  // otadata 已选 app0 却仍进了 factory：二级引导拒绝了 app0
+
+// 与 is_menu_held_on_boot 相同的矩阵位置，只是不用毫秒级的 delay 去抖：
+// 开机时按住的键是稳定的，内部上拉几微秒就能拉到位
+static bool fast_menu_held()
+{
+  static const gpio_num_t ROW0 = GPIO_NUM_48;
+  static const gpio_num_t COLS[] = {GPIO_NUM_14, GPIO_NUM_13, GPIO_NUM_12, GPIO_NUM_11};
+
+  gpio_set_direction(ROW0, GPIO_MODE_INPUT);
+  gpio_set_pull_mode(ROW0, GPIO_PULLUP_ONLY);
+  for (size_t i = 0; i < sizeof(COLS) / sizeof(COLS[0]); i++)
+  {
+    gpio_set_level(COLS[i], i == 0 ? 0 : 1);
+    gpio_set_direction(COLS[i], GPIO_MODE_OUTPUT);
+  }
+  esp_rom_delay_us(10);
+
+  int low_cnt = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    if (gpio_get_level(ROW0) == 0)
+      low_cnt++;
+    esp_rom_delay_us(2);
+  }
+  gpio_set_level(COLS[0], 1);
+  return low_cnt == 4;
+}
+
+static bool fast_update_pending()
+{
+  nvs_handle_t h;
+  uint8_t pend = 0;
+  if (nvs_open("upd", NVS_READONLY, &h) != ESP_OK)
+    return false;
+  nvs_get_u8(h, "pend", &pend);
+  nvs_close(h);
+  return pend == UPD_SRC_UART;
+}
+
+static bool ota_entry_valid(const esp_ota_select_entry_t &e)
+{
+  return e.ota_seq != UINT32_MAX &&
+         e.crc == esp_rom_crc32_le(UINT32_MAX, (const uint8_t *)&e.ota_seq, sizeof(e.ota_seq));
+}
+
+static bool ota_entry_blank(const esp_ota_select_entry_t &e)
+{
+  const uint8_t *p = (const uint8_t *)&e;
+  for (size_t i = 0; i < sizeof(e); i++)
+    if (p[i] != 0xFF)
+      return false;
+  return true;
+}
+
+// 让下次启动进 app0。otadata 是空的（app 擦过）时直接在已擦除的第一个扇区
+// 写入一条选择 app0 的记录：不擦除，也不像 esp_ota_set_boot_partition 那样
+// 把整个 app0 镜像重新校验一遍——二级引导加载时本来就会校验。
+// 其它情况交给 esp_ota_set_boot_partition。
+static bool fast_select_app0()
+{
+  const esp_partition_t *app0 = find_app0();
+  const esp_partition_t *otadata =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_OTA, NULL);
+  if (!app0 || !otadata)
+    return false;
+
+  esp_ota_select_entry_t e[2];
+  if (esp_partition_read(otadata, 0, &e[0], sizeof(e[0])) != ESP_OK ||
+      esp_partition_read(otadata, SPI_FLASH_SEC_SIZE, &e[1], sizeof(e[1])) != ESP_OK)
+    return false;
+
+  if (ota_entry_blank(e[0]) && ota_entry_blank(e[1]))
+  {
+    e[0].ota_seq = 1;  // (seq - 1) % OTA 槽数 = 0 → ota_0
+    e[0].ota_state = ESP_OTA_IMG_UNDEFINED;
+    e[0].crc = esp_rom_crc32_le(UINT32_MAX, (const uint8_t *)&e[0].ota_seq, sizeof(e[0].ota_seq));
+    return esp_partition_write(otadata, 0, &e[0], sizeof(e[0])) == ESP_OK;
+  }
+
+  const bool v0 = ota_entry_valid(e[0]), v1 = ota_entry_valid(e[1]);
+  if (v0 || v1)
+  {
+    const uint32_t seq = (v0 && v1) ? (e[0].ota_seq > e[1].ota_seq ? e[0].ota_seq : e[1].ota_seq)
+                                    : (v0 ? e[0].ota_seq : e[1].ota_seq);
+    if ((seq - 1) % esp_ota_get_app_partition_count() == 0)
+    {
+      gApp0Rejected = true;
+      return false;
+    }
+  }
+  return esp_ota_set_boot_partition(app0) == ESP_OK;
+}
+
 void setup()
 {
+  if (!fast_menu_held() && !fast_update_pending() && fast_select_app0())
+    esp_restart();
 
   psramInit();
 
+#ifdef BL_USB_FLASH
+  Serial.setRxBufferSize(USB_RX_BUF); // 须在 begin 之前
+#endif
   Serial.begin(115200);
+  Uart0.setRxBufferSize(UART_RX_BUF);
   Uart0.begin(UART0_FLASH_BAUD, SERIAL_8N1, UART0_RX_PIN, UART0_TX_PIN);
   pinMode(3, INPUT_PULLDOWN);
   pinMode(2, INPUT_PULLDOWN);
     Serial.println("引导已经启动....");
 
 
-   if (is_menu_held_on_boot())
+  // 上次串口烧录被打断（app0 不完整）时不按 MENU 也直接进入，等待续传
+  const bool pending = prog_uart_pending();
+   if (is_menu_held_on_boot() || pending || gApp0Rejected)
   {
-    Serial.println("检测到MENU按住：进入串口烧录...");
+    Serial.println(pending ? "上次串口烧录未完成：等待续传..."
+                   : gApp0Rejected ? "app0 无法启动：等待串口烧录..."
+                                   : "检测到MENU按住：进入串口烧录...");
 
-      // Flash over UART0 (GPIO43/44). Keep Serial (USB CDC) for logs.
-      (void)receive_and_flash_app0(Uart0);
+      // 会话中断后只要 app0 仍不完整，就回到 READY 等主机重连
+      while (!receive_and_flash_app0() && prog_uart_pending())
+        delay(100);
     delay(100); // 等待串口稳定
   }
   else
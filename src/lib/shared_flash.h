@@ -16,6 +16,14 @@
 
 static constexpr size_t FLASH_SECTOR = 0x1000; // 4KB
 
+// 每擦一个扇区前回调一次（分区内偏移）。弱符号：应用不定义就什么都不做，
+// 库不必认识应用的头文件
+extern "C" void shared_flash_erase_hook(size_t offset) __attribute__((weak));
+
+static inline void shared_notify_erase(size_t offset) {
+  if (shared_flash_erase_hook) shared_flash_erase_hook(offset);
+}
+
 // 查找共享分区
 inline const esp_partition_t* shared_part() {
   static const esp_partition_t* cached = nullptr;
@@ -79,6 +87,7 @@ inline bool shared_write(size_t offset, const void* data, size_t len) {
     memcpy(sector_buf + lo, src + written, span);
 
     // 擦除该扇区
+    shared_notify_erase(sec_off_flash);
     if (esp_partition_erase_range(p, sec_off_flash, FLASH_SECTOR) != ESP_OK) {
       free(sector_buf); return false;
     }
@@ -95,6 +104,26 @@ inline bool shared_write(size_t offset, const void* data, size_t len) {
   free(sector_buf);
   return true;
 }
+
+// 擦除整扇区（offset、len 按 4KB 对齐）
+inline bool shared_erase(size_t offset, size_t len) {
+  const esp_partition_t* p = shared_part();
+  if (!p || len == 0) return false;
+  if ((offset % FLASH_SECTOR) || (len % FLASH_SECTOR) || offset + len > p->size) return false;
+  for (size_t sec = offset; sec < offset + len; sec += FLASH_SECTOR) {
+    shared_notify_erase(sec);
+    if (esp_partition_erase_range(p, sec, FLASH_SECTOR) != ESP_OK) return false;
+  }
+  return true;
+}
+
+// 直接写入已擦除的区域，不做扇区 RMW（位只能 1 -> 0），用于追加写
+inline bool shared_program(size_t offset, const void* data, size_t len) {
+  const esp_partition_t* p = shared_part();
+  if (!p || !data || len == 0) return false;
+  if (offset + len > p->size) return false;
+  return esp_partition_write(p, offset, data, len) == ESP_OK;
+}
 static inline void switch_to_factory_and_restart() {
   const esp_partition_t* part = esp_partition_find_first(
       ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_FACTORY, "factory");
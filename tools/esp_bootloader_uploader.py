@@ -5,19 +5,29 @@ ESP bootloader uploader
 - 按照 `src/bootloader/main.cpp` 的协议发送：
   - 等待 READY -> 发送 "GO"
   - 发送 header: MAGIC (0x32445055) + total(uint32 LE) + chunk(uint16 LE)
-  - 等待 START
+    续传（默认）: MAGIC_RESUME (0x52445055) + total + chunk + SHA-256(固件)
+  - 等待 STRT（续传时为 "STRT <offset>"，从 offset 起发送剩余部分）
   - 按块发送: seq(uint32 LE) + len(uint16 LE) + data + crc32(uint32 LE)
   - 等待设备返回 'A' (ACK) 或 'E'<code> (NAK)
 
+中断后重新运行同一命令即可续传；设备在 app0 不完整时开机自动进入等待。
+
+设备同时在 UART0 和原生 USB（CDC）上等待，先回 GO 的口即为传输口。
+--usb 走原生 USB：自动选 Espressif 的 USB 口，默认 16KB 分块，速度只受 USB 全速限制。
+
 Usage:
   python3 tools/esp_bootloader_uploader.py --file firmware.bin
+  python3 tools/esp_bootloader_uploader.py --file firmware.bin --usb      # 原生 USB 快速烧录
+  python3 tools/esp_bootloader_uploader.py --file firmware.bin --status   # 只查询续传进度
 """
 
 import argparse
+import hashlib
 import os
 import struct
 import sys
 import time
+import zlib
 
 try:
     import serial
@@ -27,21 +37,16 @@ except Exception as e:
     raise
 
 MAX_CHUNK = 2048
+MAX_CHUNK_USB = 16384
+ESPRESSIF_VID = 0x303A
 MAGIC = 0x32445055
+MAGIC_RESUME = 0x52445055
 MAX_FW_SIZE = 3 * 1024 * 1024
 
 
-# CRC32 (与设备实现一致)
+# CRC32 (与设备实现一致：0xEDB88320，初值/结果取反，即标准 CRC-32)
 def crc32(data: bytes) -> int:
-    crc = 0xFFFFFFFF
-    for b in data:
-        crc ^= b
-        for _ in range(8):
-            if crc & 1:
-                crc = (crc >> 1) ^ 0xEDB88320
-            else:
-                crc >>= 1
-    return (~crc) & 0xFFFFFFFF
+    return zlib.crc32(data) & 0xFFFFFFFF
 
 
 def list_serial_ports():
@@ -54,6 +59,14 @@ def list_serial_ports():
     return ports
 
 
+def find_usb_port():
+    """原生 USB 口：Espressif VID（USB Serial/JTAG）。"""
+    for p in serial.tools.list_ports.comports():
+        if p.vid == ESPRESSIF_VID:
+            return p.device
+    return None
+
+
 def read_line(ser, timeout=30.0):
     end = time.time() + timeout
     line = b""
@@ -79,9 +92,51 @@ def read_byte(ser, timeout=10.0):
     return None
 
 
-def upload(port, baud, file_path, chunk_size=1024, max_retries=5):
-    if chunk_size <= 0 or chunk_size > MAX_CHUNK:
-        print(f"chunk must be between 1 and {MAX_CHUNK}")
+def wait_ready(ser, timeout=60.0):
+    t0 = time.time()
+    while time.time() - t0 < timeout:
+        line = read_line(ser, timeout=1.0)
+        if line:
+            print("<", line)
+            if "READY" in str(line).upper():
+                return True
+    return False
+
+
+def query_status(port, baud, file_path):
+    """发送 STAT，打印设备记录的续传进度，并与本地文件比对。"""
+    with open(file_path, 'rb') as f:
+        digest = hashlib.sha256(f.read()).hexdigest()
+    ser = serial.Serial(port, baudrate=baud, timeout=0.5)
+    try:
+        if not wait_ready(ser, timeout=30.0):
+            print("未收到 READY")
+            return 1
+        ser.write(b"STAT\n")
+        ser.flush()
+        t0 = time.time()
+        while time.time() - t0 < 5:
+            line = read_line(ser, timeout=1.0)
+            if not line or not line.startswith("PROG"):
+                continue
+            parts = line.split()
+            if len(parts) < 4:
+                print("设备无续传记录")
+                return 0
+            total, verified, remote = int(parts[1]), int(parts[2]), parts[3]
+            same = remote == digest and total == os.path.getsize(file_path)
+            print(f"设备进度 {verified}/{total} 字节，{'与本地文件一致，可续传' if same else '不是本地这个文件'}")
+            return 0
+        print("未收到 PROG")
+        return 1
+    finally:
+        ser.close()
+
+
+def upload(port, baud, file_path, chunk_size=1024, max_retries=5, resume=True, usb=False):
+    max_chunk = MAX_CHUNK_USB if usb else MAX_CHUNK
+    if chunk_size <= 0 or chunk_size > max_chunk:
+        print(f"chunk must be between 1 and {max_chunk}")
         return 2
 
     size = os.path.getsize(file_path)
@@ -93,22 +148,14 @@ def upload(port, baud, file_path, chunk_size=1024, max_retries=5):
         print("固件超过最大允许大小")
         return 2
 
-    print(f"打开串口 {port} @ {baud} ...")
+    print(f"打开{'USB' if usb else '串口'} {port} @ {baud} ...")
     ser = serial.Serial(port, baudrate=baud, timeout=0.5)
     time.sleep(0.1)
     ser.reset_input_buffer()
     ser.reset_output_buffer()
 
     print("等待设备发 READY（最长 60s）...")
-    ready_seen = False
-    t0 = time.time()
-    while time.time() - t0 < 60:
-        line = read_line(ser, timeout=1.0)
-        if line:
-            print("<", line)
-            if "READY" in str(line).upper():
-                ready_seen = True
-                break
+    ready_seen = wait_ready(ser, timeout=60.0)
     if not ready_seen:
         print("未收到 READY，仍会尝试发送 GO（你可以手动按下 boot 按钮再次尝试）")
 
@@ -118,29 +165,45 @@ def upload(port, baud, file_path, chunk_size=1024, max_retries=5):
     ser.flush()
 
     # 发送 header
-    print(f"发送 header: magic=0x{MAGIC:08X}, total={size}, chunk={chunk_size}")
-    header = struct.pack('<I I H', MAGIC, size, chunk_size)
+    magic = MAGIC_RESUME if resume else MAGIC
+    print(f"发送 header: magic=0x{magic:08X}, total={size}, chunk={chunk_size}")
+    header = struct.pack('<I I H', magic, size, chunk_size)
+    if resume:
+        with open(file_path, 'rb') as f:
+            header += hashlib.sha256(f.read()).digest()
     ser.write(header)
     ser.flush()
 
-    # 等待 START
-    print("等待设备 START...")
+    # 等待 STRT（续传前设备要回读校验已写部分，最长可能需要数秒）
+    print("等待设备 STRT...")
     start_seen = False
+    offset = 0
     t0 = time.time()
-    while time.time() - t0 < 10:
+    while time.time() - t0 < 30:
         line = read_line(ser, timeout=1.0)
         if line:
             print("<", line)
-            if "START" in str(line).upper():
+            upper = str(line).upper()
+            if upper.startswith("STRT") or "START" in upper:
                 start_seen = True
+                parts = upper.split()
+                if resume and len(parts) > 1 and parts[1].isdigit():
+                    offset = int(parts[1])
                 break
+            if upper.startswith("ERR"):
+                ser.close()
+                return 3
     if not start_seen:
-        print("未收到 START，继续尝试（设备可能已进入 START 但超时）")
+        print("未收到 STRT，继续尝试（设备可能已进入 START 但超时）")
+    if offset:
+        print(f"续传：设备已有 {offset}/{size} 字节，发送剩余部分")
 
     # 开始传输
+    t_start = time.time()
+    sent = 0
+    last_pct = -1
     with open(file_path, 'rb') as f:
         total = size
-        offset = 0
         seq = 0
         while offset < total:
             f.seek(offset)
@@ -163,12 +226,21 @@ def upload(port, baud, file_path, chunk_size=1024, max_retries=5):
                     continue
                 if rsp == b'A':
                     offset += len(data)
+                    sent += len(data)
                     seq += 1
                     pct = (offset * 100) // total
-                    print(f"已写 {offset}/{total} 字节 ({pct}%)")
+                    if pct != last_pct:
+                        rate = sent / max(time.time() - t_start, 1e-6) / 1024
+                        print(f"已写 {offset}/{total} 字节 ({pct}%) {rate:.0f} KB/s")
+                        last_pct = pct
                     break
                 elif rsp == b'E':
                     code = read_byte(ser, timeout=1.0)
+                    if code == b'R':
+                        # 不是 NAK 而是 "ERR: ..."（写入失败等），会话已结束
+                        print("< ER" + (read_line(ser, timeout=2.0) or ""))
+                        ser.close()
+                        return 3
                     code_val = code[0] if code else None
                     print(f"设备返回错误 E code={code_val}（第 {seq} 包），重试 {attempt}/{max_retries}")
                     # 读掉任何残余
@@ -182,7 +254,8 @@ def upload(port, baud, file_path, chunk_size=1024, max_retries=5):
                 ser.close()
                 return 3
 
-    print("数据发送完成，等待设备 OK...")
+    elapsed = max(time.time() - t_start, 1e-6)
+    print(f"数据发送完成（{sent} 字节，{elapsed:.1f}s，{sent / elapsed / 1024:.0f} KB/s），等待设备 OK...")
     # 读取直到看到 OK 或 ERR
     t0 = time.time()
     while time.time() - t0 < 10:
@@ -206,7 +279,10 @@ def main():
     p.add_argument('--file', '-f', required=True, help='固件文件路径')
     p.add_argument('--port', '-p', help='串口设备，比如 /dev/ttyUSB0')
     p.add_argument('--baud', '-b', type=int, default=115200)
-    p.add_argument('--chunk', type=int, default=1024, help=f'分块大小（<= {MAX_CHUNK}）')
+    p.add_argument('--chunk', type=int, help=f'分块大小（串口 <= {MAX_CHUNK}，默认 1024；USB <= {MAX_CHUNK_USB}，默认 {MAX_CHUNK_USB}）')
+    p.add_argument('--usb', action='store_true', help='通过原生 USB（CDC）烧录')
+    p.add_argument('--no-resume', action='store_true', help='使用旧的 UPD2 头，总是从头整包发送')
+    p.add_argument('--status', action='store_true', help='只查询设备记录的续传进度')
     args = p.parse_args()
 
     if not os.path.exists(args.file):
@@ -214,6 +290,10 @@ def main():
         sys.exit(2)
 
     port = args.port
+    if not port and args.usb:
+        port = find_usb_port()
+        if port:
+            print(f"使用 USB 口 {port}")
     if not port:
         ports = list_serial_ports()
         if not ports:
@@ -226,7 +306,10 @@ def main():
             print('选择无效')
             sys.exit(1)
 
-    rc = upload(port, args.baud, args.file, chunk_size=args.chunk)
+    if args.status:
+        sys.exit(query_status(port, args.baud, args.file))
+    chunk = args.chunk or (MAX_CHUNK_USB if args.usb else 1024)
+    rc = upload(port, args.baud, args.file, chunk_size=chunk, resume=not args.no_resume, usb=args.usb)
     sys.exit(rc)
 
 
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Generate the DCS Golay codeword tables and the received-word perfect hash.
+
+Reads DCS_Options from src/app/dcs.c and emits a C header with:
+- DCS_GolayWords / DCS_GolayWordsReverse: the 23-bit codeword of every option,
+  normal and inverted polarity (what BK4819_SetCDCSSCodeWord is given).
+- DCS_HashDisplace / DCS_HashTable: a hash-and-displace perfect hash over all
+  23 rotations of every codeword, so DCS_GetCdcssCode resolves a received word
+  with exactly one table probe.
+
+A word that is a rotation of several codes maps to the option the original
+rotate-and-search loop returned: rotation 0 of every code first, then
+rotation 1, ... and the first owner of a word keeps it.
+
+Usage:
+  python3 tools/gen_dcs_tables.py \
+    --dcs src/app/dcs.c \
+    --out src/app/dcs_table.h
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+from pathlib import Path
+
+WORD_MASK = 0x7FFFFF
+BUCKET_BITS = 10
+SLOT_BITS = 12
+BUCKET_MUL = 0x9E3779B1
+SLOT_MUL = 0x85EBCA6B
+
+
+def golay(code: int) -> int:
+    word = code
+    for _ in range(12):
+        word <<= 1
+        if word & 0x1000:
+            word ^= 0x08EA
+    return code | ((word & 0x0FFE) << 11)
+
+
+def rotl(word: int) -> int:
+    return ((word << 1) | (word >> 22)) & WORD_MASK
+
+
+def bucket_of(word: int) -> int:
+    return ((word * BUCKET_MUL) & 0xFFFFFFFF) >> (32 - BUCKET_BITS)
+
+
+def slot_of(word: int) -> int:
+    return ((word * SLOT_MUL) & 0xFFFFFFFF) >> (32 - SLOT_BITS)
+
+
+def read_options(path: Path) -> list[int]:
+    text = path.read_text()
+    m = re.search(r"DCS_Options\[\d+\]\s*=\s*\{(.*?)\}", text, re.S)
+    if not m:
+        raise SystemExit(f"DCS_Options not found in {path}")
+    return [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", m.group(1))]
+
+
+def build_hash(words: list[int]) -> tuple[list[int], list[int]]:
+    owner: dict[int, int] = {}
+    rot = list(words)
+    for _ in range(23):
+        for j, w in enumerate(rot):
+            owner.setdefault(w, j)
+        rot = [rotl(w) for w in rot]
+
+    buckets: list[list[int]] = [[] for _ in range(1 << BUCKET_BITS)]
+    for w in owner:
+        buckets[bucket_of(w)].append(w)
+
+    size = 1 << SLOT_BITS
+    table = [0] * size
+    displace = [0] * len(buckets)
+    for b in sorted(range(len(buckets)), key=lambda i: -len(buckets[i])):
+        keys = buckets[b]
+        if not keys:
+            continue
+        for d in range(size):
+            slots = {slot_of(w) ^ d for w in keys}
+            if len(slots) == len(keys) and all(table[s] == 0 for s in slots):
+                break
+        else:
+            raise SystemExit(f"no displacement for bucket {b}")
+        displace[b] = d
+        for w in keys:
+            table[slot_of(w) ^ d] = w | ((owner[w] + 1) << 24)
+    return displace, table
+
+
+def emit(name: str, ctype: str, values: list[int], per_line: int, width: int) -> str:
+    out = [f"static const {ctype} {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), per_line):
+        out.append("    " + " ".join(f"0x{v:0{width}X}," for v in values[i:i + per_line]))
+    out.append("};")
+    return "\n".join(out)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--dcs", default="src/app/dcs.c")
+    ap.add_argument("--out", default="src/app/dcs_table.h")
+    args = ap.parse_args()
+
+    options = read_options(Path(args.dcs))
+    words = [golay(code + 0x800) for code in options]
+    displace, table = build_hash(words)
+
+    text = "\n".join([
+        "/* Generated offline by tools/gen_dcs_tables.py from DCS_Options in dcs.c; rerun it after editing them. Do not edit. */",
+        "#ifndef DCS_TABLE_H",
+        "#define DCS_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define DCS_HASH_BUCKET_BITS {BUCKET_BITS}U",
+        f"#define DCS_HASH_SLOT_BITS   {SLOT_BITS}U",
+        f"#define DCS_HASH_BUCKET_MUL  0x{BUCKET_MUL:08X}U",
+        f"#define DCS_HASH_SLOT_MUL    0x{SLOT_MUL:08X}U",
+        "",
+        emit("DCS_GolayWords", "uint32_t", words, 8, 6),
+        "",
+        emit("DCS_GolayWordsReverse", "uint32_t", [w ^ WORD_MASK for w in words], 8, 6),
+        "",
+        "// Bucket -> displacement XORed into the slot hash.",
+        emit("DCS_HashDisplace", "uint16_t", displace, 12, 3),
+        "",
+        "// Slot -> codeword | (option + 1) << 24, 0 = no code.",
+        emit("DCS_HashTable", "uint32_t", table, 8, 8),
+        "",
+        "#endif",
+        "",
+    ])
+    Path(args.out).write_text(text)
+    used = sum(1 for v in table if v)
+    print(f"{len(options)} codes, {used} words in {len(table)} slots -> {args.out}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())